@@ -87,6 +87,10 @@ struct DefaultConnect<Cell, 2> : public Connect2D<Cell> {
 /// @brief labelClusters
 ///
 /// In-place connected component labelling using the Hoshen-Kopelman algorithm.
+/// With the default 2-D connectivity, the neighbours of a cell are looked up
+/// in a window of the previous column instead of a backward search, which
+/// keeps the labelling linear in the number of cells after sorting. The
+/// resulting labels are the same as with any equivalent connection type.
 /// The `Cell` type must have the following functions defined:
 ///   int  getCellRow(const Cell&),
 ///   int  getCellColumn(const Cell&)
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <type_traits>
 #include <vector>
 
 #include <boost/pending/disjoint_sets.hpp>
@@ -131,6 +132,89 @@ Connections<GridDim> getConnections(typename std::vector<Cell>::iterator it,
   return seen;
 }
 
+// Label cells on a 2-D grid with the default connectivity. Cells need to be
+// sorted column-wise (see Compare). The connected cells are collected in the
+// same order as the backward search in getConnections, such that the labels,
+// and with them the order of the clusters, are identical to the generic path.
+// Only the preceding cells of the same column and a window of at most three
+// rows in the previous column can be connected. The window is tracked with a
+// forward sweep, which makes the labelling linear in the number of cells.
+template <typename CellCollection>
+void labelClusters2D(CellCollection& cells, bool commonCorner) {
+  const std::size_t nCells = std::ranges::size(cells);
+  auto cell = std::ranges::begin(cells);
+
+  DisjointSets ds{};
+
+  // First cell of the current column
+  std::size_t columnBegin = 0;
+  // Cells of the previous column if it is adjacent, empty otherwise
+  std::size_t prevBegin = 0;
+  std::size_t prevEnd = 0;
+
+  // First pass: Allocate labels and record equivalences
+  for (std::size_t i = 0; i < nCells; ++i) {
+    const int column = getCellColumn(cell[i]);
+    const int row = getCellRow(cell[i]);
+    if (i == 0 || getCellColumn(cell[columnBegin]) != column) {
+      const bool adjacent =
+          i != 0 && getCellColumn(cell[columnBegin]) + 1 == column;
+      prevBegin = adjacent ? columnBegin : i;
+      prevEnd = i;
+      columnBegin = i;
+    }
+
+    Connections<2> seen;
+    auto connect = [&](std::size_t j) {
+      seen.buf[seen.nconn] = getCellLabel(cell[j]);
+      seen.nconn += 1;
+      return seen.nconn < seen.buf.size();
+    };
+
+    // Preceding cells of the same column in the same or the previous row
+    bool searching = true;
+    for (std::size_t j = i; searching && j > columnBegin &&
+                            getCellRow(cell[j - 1]) + 1 >= row;
+         --j) {
+      searching = connect(j - 1);
+    }
+    // Cells of the previous column in the neighbouring rows, starting with
+    // the highest row. Rows increase within a column, so cells skipped at the
+    // beginning of the window cannot touch later cells either.
+    while (prevBegin < prevEnd && getCellRow(cell[prevBegin]) + 1 < row) {
+      ++prevBegin;
+    }
+    std::size_t windowEnd = prevBegin;
+    while (windowEnd < prevEnd && getCellRow(cell[windowEnd]) <= row + 1) {
+      ++windowEnd;
+    }
+    for (std::size_t j = windowEnd; searching && j > prevBegin; --j) {
+      if (commonCorner || getCellRow(cell[j - 1]) == row) {
+        searching = connect(j - 1);
+      }
+    }
+
+    if (seen.nconn == 0) {
+      // Allocate new label
+      getCellLabel(cell[i]) = ds.makeSet();
+    } else {
+      for (std::size_t k = 1; k < seen.nconn; ++k) {
+        if (seen.buf[0] != seen.buf[k]) {
+          ds.unionSet(seen.buf[0], seen.buf[k]);
+        }
+      }
+      // Set label for current cell
+      getCellLabel(cell[i]) = seen.buf[0];
+    }
+  }
+
+  // Second pass: Merge labels based on recorded equivalences
+  for (std::size_t i = 0; i < nCells; ++i) {
+    Label& lbl = getCellLabel(cell[i]);
+    lbl = ds.findSet(lbl);
+  }
+}
+
 template <typename CellCollection, typename ClusterCollection>
   requires(
       Acts::Ccl::HasRetrievableLabelInfo<typename CellCollection::value_type> &&
@@ -227,11 +311,21 @@ template <typename CellCollection, std::size_t GridDim, typename Connect>
 void labelClusters(CellCollection& cells, Connect connect) {
   using Cell = typename CellCollection::value_type;
 
-  internal::DisjointSets ds{};
-
   // Sort cells by position to enable in-order scan
   std::ranges::sort(cells, internal::Compare<Cell, GridDim>());
 
+  // The default 2-D connectivity only depends on the neighbouring rows and
+  // columns, which can be found without a backward search per cell
+  if constexpr (GridDim == 2) {
+    if constexpr (std::is_same_v<Connect, DefaultConnect<Cell, 2>> ||
+                  std::is_same_v<Connect, Connect2D<Cell>>) {
+      internal::labelClusters2D(cells, connect.conn8);
+      return;
+    }
+  }
+
+  internal::DisjointSets ds{};
+
   // First pass: Allocate labels and record equivalences
   for (auto it = std::ranges::begin(cells); it != std::ranges::end(cells);
        ++it) {
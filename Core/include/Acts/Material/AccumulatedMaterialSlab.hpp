@@ -71,6 +71,17 @@ class AccumulatedMaterialSlab {
   /// unless explicitly requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Add the total average of another accumulator to this one.
+  ///
+  /// @param other the accumulator to be merged into this one
+  ///
+  /// This allows to accumulate disjoint sets of tracks separately, e.g. in
+  /// different threads, and to combine them afterwards. Each track keeps
+  /// contributing equally to the total average. Only the total stores are
+  /// merged, i.e. the per-track store of @p other must have been finished with
+  /// `.trackAverage(...)` before.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
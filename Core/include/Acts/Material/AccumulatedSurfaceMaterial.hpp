@@ -134,6 +134,14 @@ class AccumulatedSurfaceMaterial {
   /// @param emptyHit indicator if this is an empty assignment
   void trackAverage(const Vector3& gp, bool emptyHit = false);
 
+  /// Merge the material accumulated from other tracks into this one
+  ///
+  /// @param other the accumulated material of the same surface, e.g.
+  /// filled in another thread
+  ///
+  /// @note the binning of @p other has to be the same as this one
+  void merge(const AccumulatedSurfaceMaterial& other);
+
   /// Total average creates SurfaceMaterial
   std::unique_ptr<const ISurfaceMaterial> totalAverage();
 
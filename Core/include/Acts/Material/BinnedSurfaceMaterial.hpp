@@ -10,10 +10,14 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 
+#include <array>
+#include <cstddef>
 #include <iosfwd>
+#include <vector>
 
 namespace Acts {
 
@@ -22,6 +26,10 @@ namespace Acts {
 /// It extends the @c ISurfaceMaterial base class and is an array pf
 /// MaterialSlab. This is not memory optimised as every bin
 /// holds one material property object.
+///
+/// Next to the material matrix, the derived material constants of every bin
+/// that are needed by the interaction formulas are stored in a single
+/// contiguous array.
 
 class BinnedSurfaceMaterial : public ISurfaceMaterial {
  public:
@@ -92,21 +100,50 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   /// @brief Retrieve the entire material slab matrix
   const MaterialSlabMatrix& fullMaterial() const;
 
+  /// Return the material slab of a single bin
+  ///
+  /// @param bin0 is the bin along the first binning direction
+  /// @param bin1 is the bin along the second binning direction
+  const MaterialSlab& materialSlab(std::size_t bin0, std::size_t bin1) const;
+
   /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
   const MaterialSlab& materialSlab(const Vector2& lp) const final;
 
   /// @copydoc ISurfaceMaterial::materialSlab(const Vector3&) const
   const MaterialSlab& materialSlab(const Vector3& gp) const final;
 
+  /// @copydoc ISurfaceMaterial::materialSlabWithConstants
+  const MaterialSlab& materialSlabWithConstants(
+      const Vector3& gp, MaterialSlabConstants& constants) const final;
+
   /// Output Method for std::ostream, to be overloaded by child classes
   std::ostream& toStream(std::ostream& sl) const final;
 
  private:
+  /// Fill the material constants from the material matrix
+  void fill();
+
+  /// Bin indices of the bin containing the position
+  template <typename position_t>
+  std::array<std::size_t, 2> bins(const position_t& pos) const {
+    std::size_t ibin0 = m_binUtility.bin(pos, 0);
+    std::size_t ibin1 =
+        m_binUtility.max(1) != 0u ? m_binUtility.bin(pos, 1) : 0;
+    return {ibin0, ibin1};
+  }
+
   /// The helper for the bin finding
   BinUtility m_binUtility;
 
   /// The five different MaterialSlab
   MaterialSlabMatrix m_fullMaterial;
+
+  /// The number of bins along the first binning direction
+  std::size_t m_nBins0 = 0;
+
+  /// The derived material constants, one entry per bin, with the first bin
+  /// index running fastest
+  std::vector<MaterialSlabConstants> m_constants;
 };
 
 inline const BinUtility& BinnedSurfaceMaterial::binUtility() const {
@@ -117,4 +154,9 @@ inline const MaterialSlabMatrix& BinnedSurfaceMaterial::fullMaterial() const {
   return m_fullMaterial;
 }
 
+inline const MaterialSlab& BinnedSurfaceMaterial::materialSlab(
+    std::size_t bin0, std::size_t bin1) const {
+  return m_fullMaterial[bin1][bin0];
+}
+
 }  // namespace Acts
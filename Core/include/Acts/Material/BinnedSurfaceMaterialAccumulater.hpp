@@ -13,6 +13,10 @@
 #include "Acts/Material/interface/ISurfaceMaterialAccumulater.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
 namespace Acts {
 
 /// @brief The binned surface material accumulater
@@ -35,10 +39,17 @@ class BinnedSurfaceMaterialAccumulater final
   };
 
   /// @brief Nested state struct
+  ///
+  /// The material surfaces are indexed densely in the order of the
+  /// configuration, so that states filled in different threads can be merged
+  /// entry by entry.
   struct State final : public ISurfaceMaterialAccumulater::State {
-    /// The accumulated material per geometry ID
-    std::map<GeometryIdentifier, AccumulatedSurfaceMaterial>
-        accumulatedMaterial;
+    /// The accumulated material per material surface
+    std::vector<AccumulatedSurfaceMaterial> accumulatedMaterial;
+    /// The geometry ID of each material surface
+    std::vector<GeometryIdentifier> geometryIds;
+    /// The dense index of each material surface
+    std::unordered_map<GeometryIdentifier, std::size_t> surfaceIndices;
   };
 
   /// Constructor
@@ -66,6 +77,13 @@ class BinnedSurfaceMaterialAccumulater final
                   const std::vector<IAssignmentFinder::SurfaceAssignment>&
                       surfacesWithoutAssignment) const override;
 
+  /// @brief Merge the material accumulated in another state
+  ///
+  /// @param state is the state of the accumulater to merge into
+  /// @param other is a state filled with other tracks, e.g. in another thread
+  void merge(ISurfaceMaterialAccumulater::State& state,
+             const ISurfaceMaterialAccumulater::State& other) const override;
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
@@ -75,6 +93,12 @@ class BinnedSurfaceMaterialAccumulater final
   finalizeMaterial(ISurfaceMaterialAccumulater::State& state) const override;
 
  private:
+  /// Find the dense index of a material surface
+  ///
+  /// @param state the state of the accumulater
+  /// @param geoID the geometry ID of the surface
+  std::size_t surfaceIndex(const State& state, GeometryIdentifier geoID) const;
+
   /// Access method to the logger
   const Logger& logger() const { return *m_logger; }
 
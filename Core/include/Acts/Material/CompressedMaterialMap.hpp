@@ -0,0 +1,196 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Acts {
+
+/// @class CompressedMaterialMap
+///
+/// Compact, read-only description of a 3D volume material grid.
+///
+/// Instead of one material record per grid point, the distinct materials of
+/// the grid are collected in a dictionary and every grid point only stores a
+/// 16 bit (or 32 bit for more than 65536 distinct materials) index into it.
+/// The material parameters can optionally be rounded to a reduced number of
+/// mantissa bits before building the dictionary, such that nearly identical
+/// averaged materials share a dictionary entry.
+///
+/// The map is a view on a single flat, position independent buffer:
+///
+///     Header
+///     float    materials[nMaterials][5]   the material parameters vectors
+///     uint16_t indices[nPoints]           or uint32_t, see Header::indexBytes
+///
+/// where the grid points include the under- and overflow bins of the axes,
+/// in the same order as the `MaterialGrid3D`. All values are stored in native
+/// byte order. The buffer can be written to a file as-is and be memory
+/// mapped by several processes which then share the same physical pages.
+///
+/// Lookups give the same results as the `InterpolatedMaterialMap` the map
+/// was encoded from: `material(...)` returns the closest grid point or, if
+/// requested at construction, the trilinear interpolation between the eight
+/// surrounding grid points.
+class CompressedMaterialMap final : public IVolumeMaterial {
+ public:
+  /// The file identifier
+  static constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                                  'V', 'M', 'A', 'P'};
+  /// The format version
+  static constexpr std::uint32_t s_version = 1;
+  /// The number of stored parameters per material
+  static constexpr std::size_t s_nParameters = 5;
+
+  /// The buffer header
+  struct Header {
+    std::array<char, 8> magic = s_magic;
+    std::uint32_t version = s_version;
+    /// Number of dictionary entries
+    std::uint32_t nMaterials = 0;
+    /// Size of a single grid point index, 2 or 4
+    std::uint32_t indexBytes = 0;
+    std::uint32_t reserved = 0;
+    /// Number of bins per axis, without under- and overflow bins
+    std::array<std::uint32_t, 3> nBins{};
+    /// The axis directions, only x, y, z, r and phi are allowed
+    std::array<std::uint32_t, 3> axisDirections{};
+    /// Lower axis limits
+    std::array<double, 3> min{};
+    /// Upper axis limits
+    std::array<double, 3> max{};
+    /// Global to local transform, column-major 3x4 affine matrix
+    std::array<double, 12> transform{};
+  };
+
+  static_assert(sizeof(Header) == 192);
+
+  /// Encode a material grid into the compressed buffer format.
+  ///
+  /// @param grid is the averaged material grid, e.g. from `mapMaterialPoints`
+  /// @param binUtility is the binning the grid was created from, it provides
+  ///        the axis directions and the global to local transform
+  /// @param mantissaBits is the number of mantissa bits kept for the material
+  ///        parameters, the full single precision is kept by default
+  ///
+  /// @throws std::invalid_argument for an unsupported binning
+  /// @return the encoded buffer
+  static std::vector<std::byte> encode(const MaterialGrid3D& grid,
+                                       const BinUtility& binUtility,
+                                       unsigned int mantissaBits = 23);
+
+  /// Encode an interpolated material map into the compressed buffer format.
+  ///
+  /// @param map is the interpolated material map, it needs a bin utility
+  /// @param mantissaBits is the number of mantissa bits kept for the material
+  ///        parameters, the full single precision is kept by default
+  ///
+  /// @throws std::invalid_argument for an unsupported binning
+  /// @return the encoded buffer
+  static std::vector<std::byte> encode(
+      const InterpolatedMaterialMap<MaterialMapper<MaterialGrid3D>>& map,
+      unsigned int mantissaBits = 23);
+
+  /// Constructor owning its buffer
+  ///
+  /// @param buffer is the encoded buffer
+  /// @param interpolate whether `material(...)` interpolates between the
+  ///        grid points or returns the closest grid point
+  ///
+  /// @throws std::invalid_argument if the buffer is not a valid map
+  explicit CompressedMaterialMap(std::vector<std::byte> buffer,
+                                 bool interpolate = false);
+
+  /// Constructor viewing an external buffer, e.g. a memory mapped file
+  ///
+  /// @param buffer is the encoded buffer, aligned to 8 bytes
+  /// @param storage keeps the memory of @p buffer alive
+  /// @param interpolate whether `material(...)` interpolates between the
+  ///        grid points or returns the closest grid point
+  ///
+  /// @throws std::invalid_argument if the buffer is not a valid map
+  CompressedMaterialMap(std::span<const std::byte> buffer,
+                        std::shared_ptr<const void> storage,
+                        bool interpolate = false);
+
+  /// Access to actual material
+  ///
+  /// @param position is the request position for the material call
+  const Material material(const Vector3& position) const final;
+
+  /// Material of the closest grid point
+  ///
+  /// @param position is the global position
+  Material closestMaterial(const Vector3& position) const;
+
+  /// Trilinear interpolation of the material between the grid points
+  ///
+  /// @param position is the global position
+  Material getMaterial(const Vector3& position) const;
+
+  /// Check whether the position is inside the grid limits
+  ///
+  /// @param position is the global position
+  bool isInside(const Vector3& position) const;
+
+  /// The number of distinct materials in the dictionary
+  std::size_t nMaterials() const { return m_header.nMaterials; }
+
+  /// The encoded buffer
+  std::span<const std::byte> buffer() const { return m_buffer; }
+
+  /// Output Method for std::ostream
+  ///
+  /// @param sl The outoput stream
+  std::ostream& toStream(std::ostream& sl) const final;
+
+ private:
+  /// Constructor sharing an owned buffer
+  CompressedMaterialMap(
+      const std::shared_ptr<const std::vector<std::byte>>& buffer,
+      bool interpolate);
+
+  /// Transform a global position into the grid coordinates
+  Vector3 toLocal(const Vector3& position) const;
+
+  /// The bin of a grid coordinate, including under- and overflow bins
+  std::size_t bin(std::size_t axis, double x) const;
+
+  /// The material index of the grid point with the given global bin
+  std::size_t materialIndex(std::size_t globalBin) const;
+
+  /// The parameters of the grid point with the given global bin
+  const float* parameters(std::size_t globalBin) const;
+
+  std::shared_ptr<const void> m_storage;
+  std::span<const std::byte> m_buffer;
+  bool m_interpolate = false;
+
+  Header m_header;
+  Transform3 m_transform = Transform3::Identity();
+  std::array<double, 3> m_width{};
+  std::array<std::size_t, 3> m_strides{};
+  const float* m_materials = nullptr;
+  const std::byte* m_indices = nullptr;
+};
+
+}  // namespace Acts
@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Utilities/AnyGridView.hpp"
 #include "Acts/Utilities/Delegate.hpp"
@@ -47,6 +48,44 @@ struct GridMaterialAccessor : public IGridMaterialAccessor {
     return grid.atPosition(point);
   }
 
+  /// @brief The derived constants of the material, one per global grid bin,
+  /// precomputed by `precompute` and kept in sync by `scale`
+  std::vector<MaterialSlabConstants> constants;
+
+  /// @brief  Const access to the material slab and its derived constants
+  /// @tparam grid_type the type of the grid, also defines the point type
+  /// @param grid the grid
+  /// @param point the lookup point (already casted from global, or filled from local)
+  /// @param mconstants is set to the precomputed constants
+  ///
+  /// @return the material slab from the grid bin associated to the lookup point
+  template <typename grid_type>
+  inline const MaterialSlab& slab(const grid_type& grid,
+                                  const typename grid_type::point_t& point,
+                                  MaterialSlabConstants& mconstants) const {
+    std::size_t bin = grid.globalBinFromPosition(point);
+    const MaterialSlab& materialSlab = grid.at(bin);
+    // fall back to on-the-fly computation if the grid was not precomputed
+    mconstants = bin < constants.size() ? constants[bin]
+                                        : MaterialSlabConstants(materialSlab);
+    return materialSlab;
+  }
+
+  /// @brief Precompute the derived constants of all grid bins
+  ///
+  /// @param grid the grid holding the material
+  template <typename grid_type>
+  void precompute(const grid_type& grid) {
+    constants.clear();
+    constants.reserve(grid.size());
+    for (std::size_t ib = 0; ib < grid.size(); ++ib) {
+      constants.emplace_back(grid.at(ib));
+    }
+  }
+
+  /// @brief Drop the precomputed constants, e.g. before the grid is modified
+  void invalidate() { constants.clear(); }
+
   /// @brief Scale the material (by scaling the thickness)
   ///
   /// @param grid the grid (ignored)
@@ -59,6 +98,9 @@ struct GridMaterialAccessor : public IGridMaterialAccessor {
     for (std::size_t ib = 0; ib < grid.size(); ++ib) {
       grid.at(ib).scaleThickness(static_cast<float>(scale));
     }
+    for (auto& c : constants) {
+      c.scaleThickness(static_cast<float>(scale));
+    }
   }
 };
 
@@ -70,10 +112,15 @@ struct IndexedMaterialAccessor : public IGridMaterialAccessor {
 
   /// @brief The internal storage of the material
   explicit IndexedMaterialAccessor(std::vector<MaterialSlab>&& mmaterial)
-      : IGridMaterialAccessor(), material(std::move(mmaterial)) {}
+      : IGridMaterialAccessor(),
+        material(std::move(mmaterial)),
+        constants(material.begin(), material.end()) {}
 
   /// @brief The internal storage of the material
   std::vector<MaterialSlab> material;
+  /// @brief The derived constants of the material, precomputed on
+  /// construction and kept in sync by `scale`
+  std::vector<MaterialSlabConstants> constants;
   /// @brief  Direct const access to the material slap sorted in the grid
   /// @tparam grid_type the type of the grid, also defines the point type
   /// @param grid the grid
@@ -87,6 +134,33 @@ struct IndexedMaterialAccessor : public IGridMaterialAccessor {
     return material[index];
   }
 
+  /// @brief  Const access to the material slab and its derived constants
+  /// @tparam grid_type the type of the grid, also defines the point type
+  /// @param grid the grid
+  /// @param point the lookup point (already casted from global, or filled from local)
+  /// @param mconstants is set to the precomputed constants
+  ///
+  /// @return the material slab from the grid bin associated to the lookup point
+  template <typename grid_type>
+  inline const MaterialSlab& slab(const grid_type& grid,
+                                  const typename grid_type::point_t& point,
+                                  MaterialSlabConstants& mconstants) const {
+    auto index = grid.atPosition(point);
+    // fall back to on-the-fly computation if material was added afterwards
+    mconstants = index < constants.size()
+                     ? constants[index]
+                     : MaterialSlabConstants(material[index]);
+    return material[index];
+  }
+
+  /// @brief The constants are keyed by the material index, not by the grid
+  /// bin, they are computed on construction already
+  template <typename grid_type>
+  void precompute(const grid_type& /*grid*/) {}
+
+  /// @brief The constants do not depend on the grid content, nothing to drop
+  void invalidate() {}
+
   /// @brief Scale the material (by scaling the thickness)
   ///
   /// @param scale the amount of the scaling
@@ -95,6 +169,9 @@ struct IndexedMaterialAccessor : public IGridMaterialAccessor {
     for (auto& m : material) {
       m.scaleThickness(static_cast<float>(scale));
     }
+    for (auto& c : constants) {
+      c.scaleThickness(static_cast<float>(scale));
+    }
   }
 };
 
@@ -119,6 +196,13 @@ struct GloballyIndexedMaterialAccessor : public IGridMaterialAccessor {
   /// It is the responsibility of the user to set this flag correctly.
   bool sharedEntries = false;
 
+  /// @brief The derived constants of the material, one per global grid bin,
+  /// precomputed by `precompute` and kept in sync by `scale`
+  ///
+  /// @note changes to the global material vector made elsewhere are not
+  /// reflected, `precompute` has to be called again in that case
+  std::vector<MaterialSlabConstants> constants;
+
   /// @brief  Direct const access to the material slap sorted in the grid
   ///
   /// @tparam grid_type the type of the grid, also defines the point type
@@ -134,6 +218,46 @@ struct GloballyIndexedMaterialAccessor : public IGridMaterialAccessor {
     return (*globalMaterial)[index];
   }
 
+  /// @brief  Const access to the material slab and its derived constants
+  ///
+  /// @tparam grid_type the type of the grid, also defines the point type
+  ///
+  /// @param grid the grid holding the indices into the global material vector
+  /// @param point the lookup point (already casted from global, or filled from local)
+  /// @param mconstants is set to the precomputed constants
+  ///
+  /// @return the material slab from the grid bin associated to the lookup point
+  template <typename grid_type>
+  inline const MaterialSlab& slab(const grid_type& grid,
+                                  const typename grid_type::point_t& point,
+                                  MaterialSlabConstants& mconstants) const {
+    std::size_t bin = grid.globalBinFromPosition(point);
+    const MaterialSlab& materialSlab = (*globalMaterial)[grid.at(bin)];
+    // fall back to on-the-fly computation if the grid was not precomputed
+    mconstants = bin < constants.size() ? constants[bin]
+                                        : MaterialSlabConstants(materialSlab);
+    return materialSlab;
+  }
+
+  /// @brief Precompute the derived constants of the material referenced
+  /// by all grid bins
+  ///
+  /// The constants are stored per grid bin, so that they are not duplicated
+  /// for the entries of the global material vector used by other grids.
+  ///
+  /// @param grid the grid holding the indices into the global material vector
+  template <typename grid_type>
+  void precompute(const grid_type& grid) {
+    constants.clear();
+    constants.reserve(grid.size());
+    for (std::size_t ib = 0; ib < grid.size(); ++ib) {
+      constants.emplace_back((*globalMaterial)[grid.at(ib)]);
+    }
+  }
+
+  /// @brief Drop the precomputed constants, e.g. before the grid is modified
+  void invalidate() { constants.clear(); }
+
   /// @brief Scale the material (by scaling the thickness)
   ///
   /// @param grid the grid holding the indices into the global material vector
@@ -155,6 +279,9 @@ struct GloballyIndexedMaterialAccessor : public IGridMaterialAccessor {
       auto index = grid.at(ib);
       (*globalMaterial)[index].scaleThickness(static_cast<float>(scale));
     }
+    for (auto& c : constants) {
+      c.scaleThickness(static_cast<float>(scale));
+    }
   }
 };
 
@@ -235,6 +362,7 @@ class GridSurfaceMaterialT
       throw std::invalid_argument(
           "GridSurfaceMaterialT: BoundToGridLocalDelegate is not connected.");
     }
+    m_materialAccessor.precompute(m_grid);
   }
 
   /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
@@ -247,6 +375,12 @@ class GridSurfaceMaterialT
     return m_materialAccessor.slab(m_grid, m_globalToGridLocal(gp));
   }
 
+  /// @copydoc ISurfaceMaterial::materialSlabWithConstants
+  const MaterialSlab& materialSlabWithConstants(
+      const Vector3& gp, MaterialSlabConstants& constants) const final {
+    return m_materialAccessor.slab(m_grid, m_globalToGridLocal(gp), constants);
+  }
+
   /// Scale operator
   ///
   /// @param factor is the scale factor applied
@@ -265,7 +399,11 @@ class GridSurfaceMaterialT
   const grid_type& grid() const final { return m_grid; }
 
   // Return a type-erased indexed grid view
+  //
+  // The grid may be modified through the view, the precomputed material
+  // constants are therefore dropped and computed on the fly from now on.
   AnyGridView<typename material_accessor_t::grid_value_type> gridView() final {
+    m_materialAccessor.invalidate();
     return AnyGridView<typename material_accessor_t::grid_value_type>(m_grid);
   }
 
@@ -42,19 +42,20 @@ create1D(
               typename material_accessor_t::grid_value_type>> {
         using GridType =
             Grid<typename material_accessor_t::grid_value_type, AxisType>;
+        // Fill the grid before handing it over, so that the accessor
+        // can precompute the material constants
+        GridType grid(axis);
+        auto indices = grid.numLocalBins();
+        for (std::size_t i0 = 0; i0 < indices[0]; ++i0) {
+          // Offset comes from overflow/underflow bin
+          grid.atLocalBins({i0 + 1u}) = payload[i0];
+        }
         return std::make_unique<
             GridSurfaceMaterialT<GridType, material_accessor_t>>(
-            GridType(axis), std::forward<material_accessor_t>(materialAccessor),
+            std::move(grid),
+            std::forward<material_accessor_t>(materialAccessor),
             std::move(boundToGridLocal), std::move(globalToGridLocal));
       });
-  // Fill it via the grid view
-  AnyGridView<typename material_accessor_t::grid_value_type> gv =
-      ism->gridView();
-  auto indices = gv.numLocalBins();
-  for (std::size_t i0 = 0; i0 < indices[0]; ++i0) {
-    // Offset comes from overflow/underflow bin
-    gv.atLocalBins({i0 + 1u}) = payload[i0];
-  }
   return ism;
 }
 
@@ -91,25 +92,24 @@ create2D(
               using GridType =
                   Grid<typename material_accessor_t::grid_value_type, AxisTypeA,
                        AxisTypeB>;
+              // Fill the grid before handing it over, so that the accessor
+              // can precompute the material constants
+              GridType grid(axisA, axisB);
+              auto indices = grid.numLocalBins();
+              for (std::size_t i0 = 0; i0 < indices[0]; ++i0) {
+                for (std::size_t i1 = 0; i1 < indices[1]; ++i1) {
+                  // Offset comes from overflow/underflow bin
+                  grid.atLocalBins({i0 + 1, i1 + 1}) = payload[i0][i1];
+                }
+              }
               return std::make_unique<
                   GridSurfaceMaterialT<GridType, material_accessor_t>>(
-                  GridType(axisA, axisB),
+                  std::move(grid),
                   std::forward<material_accessor_t>(materialAccessor),
                   std::move(boundToGridLocal), std::move(globalToGridLocal));
             });
       });
 
-  // Fill it via the grid view
-  AnyGridView<typename material_accessor_t::grid_value_type> gv =
-      ism->gridView();
-  auto indices = gv.numLocalBins();
-  for (std::size_t i0 = 0; i0 < indices[0]; ++i0) {
-    for (std::size_t i1 = 0; i1 < indices[1]; ++i1) {
-      // Offset comes from overflow/underflow bin
-      gv.atLocalBins({i0 + 1, i1 + 1}) = payload[i0][i1];
-    }
-  }
-
   return ism;
 }
 
@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 
 #include <iosfwd>
@@ -76,6 +77,12 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
   const MaterialSlab& materialSlab(const Vector3& gp = Vector3{0., 0.,
                                                                0.}) const final;
 
+  /// @copydoc ISurfaceMaterial::materialSlabWithConstants
+  ///
+  /// @note the input position is ignored
+  const MaterialSlab& materialSlabWithConstants(
+      const Vector3& gp, MaterialSlabConstants& constants) const final;
+
   /// The inherited methods - for MaterialSlab access
   using ISurfaceMaterial::materialSlab;
 
@@ -91,6 +98,9 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
   /// The five different MaterialSlab
   MaterialSlab m_fullMaterial = MaterialSlab::Nothing();
 
+  /// The derived constants of the material
+  MaterialSlabConstants m_constants;
+
   /// @brief Check if two materials are exactly equal.
   ///
   /// This is a strict equality check, i.e. the materials must have identical
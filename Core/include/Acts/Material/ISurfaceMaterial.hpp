@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 
 #include <sstream>
@@ -68,6 +69,24 @@ class ISurfaceMaterial {
   /// @return const MaterialSlab
   virtual const MaterialSlab& materialSlab(const Vector3& gp) const = 0;
 
+  /// Return method for full material description of the Surface together
+  /// with the derived material constants
+  /// - from the global coordinates
+  ///
+  /// @param gp is the global position used for the (eventual) lookup
+  /// @param constants is set to the derived constants of the returned slab
+  ///
+  /// The default computes the constants on the fly, implementations that
+  /// store precomputed constants should override this.
+  ///
+  /// @return const MaterialSlab
+  virtual const MaterialSlab& materialSlabWithConstants(
+      const Vector3& gp, MaterialSlabConstants& constants) const {
+    const MaterialSlab& slab = materialSlab(gp);
+    constants = MaterialSlabConstants(slab);
+    return slab;
+  }
+
   /// Update pre factor
   ///
   /// @param pDir is the positive direction through the surface
@@ -100,6 +119,20 @@ class ISurfaceMaterial {
   MaterialSlab materialSlab(const Vector3& gp, Direction pDir,
                             MaterialUpdateStage mStage) const;
 
+  /// Return method for fully scaled material description of the Surface
+  /// together with the derived material constants
+  /// - from the global coordinates
+  ///
+  /// @param gp is the global position used for the (eventual) lookup
+  /// @param pDir is the positive direction through the surface
+  /// @param mStage is the material update directive (onapproach, full, onleave)
+  /// @param constants is set to the derived constants of the returned slab
+  ///
+  /// @return MaterialSlab
+  MaterialSlab materialSlab(const Vector3& gp, Direction pDir,
+                            MaterialUpdateStage mStage,
+                            MaterialSlabConstants& constants) const;
+
   /// @brief output stream operator
   ///
   /// Prints information about this object to the output stream using the
@@ -173,4 +206,22 @@ inline MaterialSlab ISurfaceMaterial::materialSlab(
   return plainMatProp;
 }
 
+inline MaterialSlab ISurfaceMaterial::materialSlab(
+    const Vector3& gp, Direction pDir, MaterialUpdateStage mStage,
+    MaterialSlabConstants& constants) const {
+  // The plain material properties associated to this bin
+  MaterialSlab plainMatProp = materialSlabWithConstants(gp, constants);
+  // Scale if you have material to scale
+  if (!plainMatProp.isVacuum()) {
+    double scaleFactor = factor(pDir, mStage);
+    if (scaleFactor == 0.) {
+      constants = MaterialSlabConstants();
+      return MaterialSlab::Nothing();
+    }
+    plainMatProp.scaleThickness(scaleFactor);
+    constants.scaleThickness(scaleFactor);
+  }
+  return plainMatProp;
+}
+
 }  // namespace Acts
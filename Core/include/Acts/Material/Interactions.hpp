@@ -137,4 +137,86 @@ float computeMultipleScatteringTheta0(const MaterialSlab& slab,
                                       PdgParticle absPdg, float m, float qOverP,
                                       float absQ);
 
+/// Material dependent terms of the ionisation and scattering formulas.
+///
+/// These only depend on the traversed slab and not on the particle. They can
+/// be computed once and re-used for all interactions within the same slab.
+struct MaterialSlabConstants {
+  /// Whether the slab is vacuum or has zero thickness
+  bool isVacuum = true;
+  /// Thickness of the slab
+  float thickness = 0.0f;
+  /// Thickness in units of the radiation length
+  float thicknessInX0 = 0.0f;
+  /// Mean excitation energy of the material
+  float meanExcitationEnergy = 0.0f;
+  /// Ionisation energy prefactor (K/2) * (Z/A)*rho, see RPP2018 eq. 33.11
+  ///
+  /// The thickness is not included such that scaling the thickness gives
+  /// bit-identical results to the formulas using the scaled slab.
+  float epsilonPerQ2OverBeta2PerThickness = 0.0f;
+  /// Logarithm of plasma energy over mean excitation energy
+  float logPlasmaEnergyOverI = 0.0f;
+  /// Thickness dependent correction of the Rossi-Greisen formula
+  float rossiGreisenCorrection = 0.0f;
+
+  MaterialSlabConstants() = default;
+  /// Compute the constants for the given slab
+  explicit MaterialSlabConstants(const MaterialSlab& slab);
+
+  /// Scale the thickness of the underlying slab
+  ///
+  /// @param scale is the non-negative scale factor
+  ///
+  /// Equivalent to re-computing the constants after
+  /// MaterialSlab::scaleThickness.
+  void scaleThickness(float scale);
+};
+
+/// Parameters of the continuous interactions of a particle within a slab.
+struct ContinuousInteractionParameters {
+  /// Core width of the projected planar scattering distribution
+  float theta0 = 0.0f;
+  /// Most probable ionisation energy loss
+  float energyLossLandau = 0.0f;
+  /// Gaussian-equivalent sigma of the ionisation loss fluctuations
+  float energyLossLandauSigma = 0.0f;
+};
+
+/// Compute scattering and ionisation loss parameters in a single pass.
+///
+/// @param constants The precomputed constants of the traversed slab
+/// @param absPdg    Absolute particle type PDG identifier
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+///
+/// Gives the same results as computeMultipleScatteringTheta0,
+/// computeEnergyLossLandau and computeEnergyLossLandauSigma while computing
+/// the relativistic quantities only once.
+ContinuousInteractionParameters computeContinuousInteractionParameters(
+    const MaterialSlabConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ);
+
+/// Compute the mean energy loss due to ionisation and excitation.
+///
+/// Same as computeEnergyLossBethe but with precomputed slab constants.
+float computeEnergyLossBethe(const MaterialSlabConstants& constants, float m,
+                             float qOverP, float absQ);
+
+/// Compute q/p Gaussian-equivalent sigma due to ionisation loss.
+///
+/// Same as computeEnergyLossLandauSigmaQOverP but with precomputed slab
+/// constants.
+float computeEnergyLossLandauSigmaQOverP(
+    const MaterialSlabConstants& constants, float m, float qOverP, float absQ);
+
+/// Compute the core width of the projected planar scattering distribution.
+///
+/// Same as computeMultipleScatteringTheta0 but with precomputed slab
+/// constants.
+float computeMultipleScatteringTheta0(const MaterialSlabConstants& constants,
+                                      PdgParticle absPdg, float m, float qOverP,
+                                      float absQ);
+
 }  // namespace Acts
@@ -12,10 +12,12 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Material/MaterialInteraction.hpp"
 #include "Acts/Material/MaterialInteractionAssignment.hpp"
+#include "Acts/Material/MaterialTrackView.hpp"
 #include "Acts/Material/interface/IAssignmentFinder.hpp"
 #include "Acts/Material/interface/ISurfaceMaterialAccumulater.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -47,6 +49,9 @@ class MaterialMapper {
   struct State {
     std::unique_ptr<ISurfaceMaterialAccumulater::State>
         surfaceMaterialAccumulaterState;
+    /// Scratch buffer for the interactions of columnar material tracks,
+    /// re-used from track to track
+    std::vector<MaterialInteraction> materialInteractions;
   };
 
   /// @brief nested options struct
@@ -82,6 +87,34 @@ class MaterialMapper {
       const MagneticFieldContext& mctx, const RecordedMaterialTrack& rmTrack,
       const Options& options = Options{}) const;
 
+  /// @brief Map the material steps of a columnar track view to the surfaces
+  ///
+  /// In contrast to the RecordedMaterialTrack overload, no mapped and
+  /// unmapped material tracks are created: the steps are only accumulated,
+  /// using a buffer of the state that is re-used from track to track.
+  ///
+  /// @param state the state object holding the sub states
+  /// @param gctx the geometry context
+  /// @param mctx the magnetic field context
+  /// @param mtView the columnar view of the recorded material track
+  /// @param options the call options (see above)
+  ///
+  /// @return the number of assigned and unassigned material steps
+  std::pair<std::size_t, std::size_t> mapMaterial(
+      State& state, const GeometryContext& gctx,
+      const MagneticFieldContext& mctx, const MaterialTrackView& mtView,
+      const Options& options = Options{}) const;
+
+  /// @brief Merge the material accumulated in another state
+  ///
+  /// Material tracks can be mapped with one state per thread, the states are
+  /// then merged before finalizing the maps. Every track contributes equally
+  /// to the final maps, independent of the state it was mapped with.
+  ///
+  /// @param state the state object to merge into
+  /// @param other the state object filled with other material tracks
+  void mergeState(State& state, const State& other) const;
+
   /// Finalize the maps
   DetectorMaterialMaps finalizeMaps(const State& state) const;
 
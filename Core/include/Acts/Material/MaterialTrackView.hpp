@@ -0,0 +1,66 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialInteraction.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Acts {
+
+/// @brief Non-owning, columnar view of a recorded material track
+///
+/// The material steps are stored as one column per quantity, e.g. as read
+/// directly from a memory mapped file. This avoids building a
+/// RecordedMaterialTrack with one MaterialInteraction per step, which
+/// dominates the cost of reading large material mapping samples.
+///
+/// All step columns must have the same size, the view does not own any
+/// of the data it points to.
+struct MaterialTrackView {
+  /// The start position of the track
+  Vector3 position = Vector3::Zero();
+  /// The start momentum of the track
+  Vector3 momentum = Vector3::Zero();
+
+  /// Step positions
+  std::span<const float> x, y, z;
+  /// Step directions
+  std::span<const float> dx, dy, dz;
+  /// Step length, i.e. the thickness of the passed material
+  std::span<const float> length;
+  /// Step material radiation and nuclear interaction length
+  std::span<const float> X0, L0;
+  /// Step material relative atomic mass, atomic number and mass density
+  std::span<const float> A, Z, rho;
+
+  /// The number of recorded material steps
+  std::size_t size() const { return length.size(); }
+
+  /// Build the material interaction of a single step
+  ///
+  /// @param is the step index
+  ///
+  /// @note steps of zero length should be skipped by the caller
+  MaterialInteraction interaction(std::size_t is) const {
+    MaterialInteraction mInteraction;
+    mInteraction.position = Vector3(x[is], y[is], z[is]);
+    mInteraction.direction = Vector3(dx[is], dy[is], dz[is]);
+    mInteraction.materialSlab = MaterialSlab(
+        Material::fromMassDensity(X0[is], L0[is], A[is], Z[is], rho[is]),
+        length[is]);
+    return mInteraction;
+  }
+};
+
+}  // namespace Acts
@@ -162,6 +162,16 @@ class SurfaceMaterialMapper {
   /// @param mState
   void finalizeMaps(State& mState) const;
 
+  /// @brief Merge the material accumulated in another state
+  ///
+  /// Material tracks can be mapped with one state per thread, created with
+  /// `createState` for the same geometry. The states are then merged before
+  /// finalizing the maps, every track contributes equally to the result.
+  ///
+  /// @param mState the state to merge into
+  /// @param other the state filled with other material tracks
+  void mergeState(State& mState, const State& other) const;
+
   /// Process/map a single track
   ///
   /// @param mState The current state map
@@ -16,6 +16,7 @@
 
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts {
@@ -50,6 +51,20 @@ class ISurfaceMaterialAccumulater {
       const std::vector<IAssignmentFinder::SurfaceAssignment>&
           surfacesWithoutAssignment) const = 0;
 
+  /// @brief Merge the material accumulated in another state
+  ///
+  /// @param state is the state of the accumulater to merge into
+  /// @param other is a state filled with other tracks, e.g. in another thread
+  ///
+  /// @note both states have to be created by this accumulater
+  /// @note the default implementation throws, accumulaters which support
+  ///       merging states override it
+  virtual void merge(State& state, const State& other) const {
+    (void)state;
+    (void)other;
+    throw std::logic_error("Merging states is not supported");
+  }
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
@@ -15,6 +15,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/MathHelpers.hpp"
@@ -52,6 +53,8 @@ struct PointwiseMaterialInteraction {
 
   /// The effective, passed material properties including the path correction.
   MaterialSlab slab = MaterialSlab::Nothing();
+  /// The derived constants of the effective, passed material.
+  MaterialSlabConstants constants;
   /// The path correction factor due to non-zero incidence on the surface.
   double pathCorrection = 0.;
   /// Expected phi variance due to the interactions.
@@ -115,11 +118,12 @@ struct PointwiseMaterialInteraction {
     // Retrieve the material properties
     slab = navigator.currentSurface(state.navigation)
                ->surfaceMaterial()
-               ->materialSlab(pos, navDir, updateStage);
+               ->materialSlab(pos, navDir, updateStage, constants);
 
     // Correct the material properties for non-zero incidence
     pathCorrection = surface->pathCorrection(state.geoContext, pos, dir);
     slab.scaleThickness(pathCorrection);
+    constants.scaleThickness(pathCorrection);
 
     // Check if the evaluated material is valid
     return !slab.isVacuum();
@@ -833,7 +833,8 @@ class Gx2Fitter {
 
             const double sigma =
                 static_cast<double>(Acts::computeMultipleScatteringTheta0(
-                    interaction.slab, particle.absolutePdg(), particle.mass(),
+                    interaction.constants, particle.absolutePdg(),
+                    particle.mass(),
                     static_cast<float>(
                         parametersWithHypothesis->parameters()[eBoundQOverP]),
                     particle.absoluteCharge()));
@@ -12,6 +12,8 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <vector>
+
 #include <boost/container/flat_map.hpp>  // TODO use flat unordered map
 #include <boost/functional/hash.hpp>
 
@@ -121,6 +123,25 @@ class AdaptiveGridTrackDensity {
   DensityMap addTrack(const BoundTrackParameters& trk,
                       DensityMap& mainDensityMap) const;
 
+  /// @brief Calculates the density map of a single track without adding it
+  /// to an overall grid density
+  ///
+  /// @param trk The track
+  ///
+  /// @return The density map of the track, empty if the track does not
+  /// contribute to the grid density
+  DensityMap createTrackDensityMap(const BoundTrackParameters& trk) const;
+
+  /// @brief Adds the density maps of many tracks to the overall grid density
+  /// in a single pass over the overall density.
+  /// @note This gives the same result as adding the tracks one by one in the
+  /// given order, but avoids reshuffling the overall density for every track.
+  ///
+  /// @param trackDensityMaps Density maps of single tracks
+  /// @param mainDensityMap Map between bins and corresponding density
+  void addTrackDensities(const std::vector<const DensityMap*>& trackDensityMaps,
+                         DensityMap& mainDensityMap) const;
+
   /// @brief Removes a track from the overall grid density.
   ///
   /// @param trackDensityMap Map between bins and corresponding density
@@ -130,6 +151,15 @@ class AdaptiveGridTrackDensity {
   void subtractTrack(const DensityMap& trackDensityMap,
                      DensityMap& mainDensityMap) const;
 
+  /// @brief Removes a set of tracks from the overall grid density in a single
+  /// pass over the overall density.
+  ///
+  /// @param trackDensityMaps Density maps of single tracks
+  /// @param mainDensityMap Map between bins and corresponding density
+  void subtractTrackDensities(
+      const std::vector<const DensityMap*>& trackDensityMaps,
+      DensityMap& mainDensityMap) const;
+
   // TODO this should not be public
   /// @brief Calculates the bin center from the bin number
   /// @param bin Bin number
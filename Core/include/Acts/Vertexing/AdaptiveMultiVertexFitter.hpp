@@ -17,13 +17,17 @@
 #include "Acts/Vertexing/AMVFInfo.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
 #include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/TrackLinearizationCache.hpp"
 #include "Acts/Vertexing/TrackLinearizer.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <vector>
 
 namespace Acts {
 
@@ -53,6 +57,9 @@ class AdaptiveMultiVertexFitter {
 
     MagneticFieldProvider::Cache fieldCache;
 
+    // Linearizations and impact parameters computed during this event
+    TrackLinearizationCache linearizationCache;
+
     // Map to store vertices information
     // @TODO Does this have to be a mutable pointer?
     std::map<Vertex*, VertexInfo> vtxInfoMap;
@@ -61,6 +68,27 @@ class AdaptiveMultiVertexFitter {
 
     std::map<std::pair<InputTrack, Vertex*>, TrackAtVertex> tracksAtVerticesMap;
 
+    // Dense, index-based view of the vertices in vertexCollection and their
+    // tracks. It is rebuilt at the beginning of every fit so that the
+    // annealing iterations do not have to walk the maps above. The pointers
+    // refer to map nodes and stay valid as long as no element is erased.
+
+    // VertexInfo of vertexCollection[i]
+    std::vector<VertexInfo*> fitVertexInfos;
+    // The tracks at vertexCollection[i] are the entries
+    // [fitTrackOffsets[i], fitTrackOffsets[i + 1]) of the arrays below
+    std::vector<std::uint32_t> fitTrackOffsets;
+    std::vector<TrackAtVertex*> fitTracksAtVertex;
+    // Dense index of the track of each entry in fitTracksAtVertex
+    std::vector<std::uint32_t> fitTrackIndices;
+    // All TrackAtVertex objects of track j (at any vertex, including vertices
+    // which are not part of the current fit) are the entries
+    // [fitTrackLinkOffsets[j], fitTrackLinkOffsets[j + 1]) of fitTrackLinks
+    std::vector<std::uint32_t> fitTrackLinkOffsets;
+    std::vector<const TrackAtVertex*> fitTrackLinks;
+    // Scratch buffer for the compatibilities of one track
+    std::vector<double> fitCompatibilities;
+
     // Adds a vertex to trackToVerticesMultiMap
     void addVertexToMultiMap(Vertex& vtx) {
       for (auto trk : vtxInfoMap[&vtx].trackLinks) {
@@ -70,16 +98,22 @@ class AdaptiveMultiVertexFitter {
 
     // Removes a vertex from trackToVerticesMultiMap
     void removeVertexFromMultiMap(Vertex& vtx) {
-      for (auto iter = trackToVerticesMultiMap.begin();
-           iter != trackToVerticesMultiMap.end();) {
-        if (iter->second == &vtx) {
-          iter = trackToVerticesMultiMap.erase(iter);
-        } else {
-          ++iter;
+      // Only the entries of the tracks at the vertex can refer to it
+      for (const auto& trk : vtxInfoMap[&vtx].trackLinks) {
+        auto [begin, end] = trackToVerticesMultiMap.equal_range(trk);
+        for (auto iter = begin; iter != end;) {
+          if (iter->second == &vtx) {
+            iter = trackToVerticesMultiMap.erase(iter);
+          } else {
+            ++iter;
+          }
         }
       }
     }
 
+    // Fills the dense view of vertexCollection
+    void buildFitIndex();
+
     Result<void> removeVertexFromCollection(Vertex& vtxToRemove,
                                             const Logger& logger) {
       auto it = std::ranges::find(vertexCollection, &vtxToRemove);
@@ -223,10 +257,10 @@ class AdaptiveMultiVertexFitter {
   /// at the current vertex
   ///
   /// @param state Fitter state
-  /// @param currentVtx Current vertex
+  /// @param vtxIndex Index of the current vertex in state.vertexCollection
   /// @param vertexingOptions Vertexing options
   Result<void> setAllVertexCompatibilities(
-      State& state, Vertex* currentVtx,
+      State& state, std::size_t vtxIndex,
       const VertexingOptions& vertexingOptions) const;
 
   /// @brief Sets weights to the track according to Eq.(5.46) in Ref.(1)
@@ -237,15 +271,15 @@ class AdaptiveMultiVertexFitter {
   Result<void> setWeightsAndUpdate(
       State& state, const VertexingOptions& vertexingOptions) const;
 
-  /// @brief Collects the compatibility values of the track `trk`
-  /// wrt to all of its associated vertices
+  /// @brief Collects the compatibility values of a track wrt to all of its
+  /// associated vertices into state.fitCompatibilities
   ///
   /// @param state Fitter state
-  /// @param trk Track
+  /// @param trkIndex Dense index of the track
   ///
   /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
-      State& state, const InputTrack& trk) const;
+  const std::vector<double>& collectTrackToVertexCompatibilities(
+      State& state, std::uint32_t trkIndex) const;
 
   /// @brief Determines if any vertex position has shifted more than
   /// m_cfg.maxRelativeShift in the last iteration
@@ -114,8 +114,9 @@ class GaussianGridTrackDensity {
   /// removed from
   /// @param trkGrid The 1-dim density contribution of the track
   /// @param mainGrid The main 1-dim density grid along the z-axis
-  void removeTrackGridFromMainGrid(int zBin, const TrackGridVector& trkGrid,
-                                   MainGridVector& mainGrid) const;
+  void removeTrackGridFromMainGrid(
+      int zBin, const Eigen::Ref<const TrackGridVector>& trkGrid,
+      MainGridVector& mainGrid) const;
 
   const Config& config() const { return m_cfg; }
 
@@ -126,7 +127,8 @@ class GaussianGridTrackDensity {
   /// @param zBin The center z-bin position the track
   /// @param trkGrid The 1-dim density contribution of the track
   /// @param mainGrid The main 1-dim density grid along the z-axis
-  void addTrackGridToMainGrid(int zBin, const TrackGridVector& trkGrid,
+  void addTrackGridToMainGrid(int zBin,
+                              const Eigen::Ref<const TrackGridVector>& trkGrid,
                               MainGridVector& mainGrid) const;
 
   /// @brief Helper function that modifies the main density grid
@@ -137,9 +139,9 @@ class GaussianGridTrackDensity {
   /// @param mainGrid The main 1-dim density grid along the z-axis
   /// @param modifyModeSign Sign that determines the mode of modification,
   /// +1 for adding a track, -1 for removing a track
-  void modifyMainGridWithTrackGrid(int zBin, const TrackGridVector& trkGrid,
-                                   MainGridVector& mainGrid,
-                                   int modifyModeSign) const;
+  void modifyMainGridWithTrackGrid(
+      int zBin, const Eigen::Ref<const TrackGridVector>& trkGrid,
+      MainGridVector& mainGrid, int modifyModeSign) const;
 
   /// @brief Function that creates a 1-dim track grid (i.e. a vector)
   /// with the correct density contribution of a track along the z-axis
@@ -167,6 +169,15 @@ class GaussianGridTrackDensity {
   /// @note This function is defined in coordinate system centered around d0 and z0
   float normal2D(float d, float z, const SquareMatrix2& cov) const;
 
+  /// @brief Returns the first bin holding the maximum density
+  /// @note The maximum value is found with a vectorized reduction first,
+  /// its position with a second (early-terminating) scan
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  ///
+  /// @return The z-bin position
+  static int getMaxZBin(const MainGridVector& mainGrid);
+
   /// @brief Checks the (up to) first three density maxima (only those that have
   /// a maximum relative deviation of 'relativeDensityDev' from the main
   /// maximum) and take the z-bin of the maximum with the highest surrounding
@@ -18,7 +18,9 @@
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
-#include <map>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace Acts {
 
@@ -72,12 +74,20 @@ class GridDensityVertexFinder final : public IVertexFinder {
 
     // The main density grid
     MainGridVector mainGrid;
-    // Map to store z-bin and track grid (i.e. the density contribution of
-    // a single track to the main grid) for every single track
-    std::map<InputTrack, std::pair<int, TrackGridVector>> binAndTrackGridMap;
 
-    // Map to store bool if track has passed track selection or not
-    std::map<InputTrack, bool> trackSelectionMap;
+    // Dense index of every track seen when filling the main grid. All other
+    // per-track information is stored in flat arrays at this index.
+    std::unordered_map<InputTrack, std::uint32_t> trackIndices;
+
+    // z-bin of every track
+    std::vector<int> trackZBins;
+
+    // Track grids (i.e. the density contribution of a single track to the
+    // main grid), one column per track
+    Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> trackGrids;
+
+    // Whether a track has passed the track selection or not
+    std::vector<std::uint8_t> trackPassedSelection;
 
     // Store tracks that have been removed from track collection. These
     // track will be removed from the main grid
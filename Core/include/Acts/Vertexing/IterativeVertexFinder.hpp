@@ -18,6 +18,7 @@
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 #include "Acts/Vertexing/IVertexFinder.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackLinearizationCache.hpp"
 #include "Acts/Vertexing/TrackLinearizer.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
@@ -129,6 +130,9 @@ class IterativeVertexFinder final : public IVertexFinder {
     ImpactPointEstimator::State ipState;
 
     MagneticFieldProvider::Cache fieldCache;
+
+    /// Linearizations computed during this event
+    TrackLinearizationCache linearizationCache;
   };
 
   /// @brief Constructor for user-defined InputTrack type
@@ -0,0 +1,163 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
+#include "Acts/Vertexing/TrackLinearizer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// @class TrackLinearizationCache
+/// @brief Per-event cache for track linearizations and 3D impact parameters.
+///
+/// Vertex finders and fitters often linearize the same track around (almost)
+/// the same point several times, e.g. when a track is tested against a
+/// vertex candidate and later refitted with it. Each linearization needs a
+/// propagation, so the results are cached here keyed by the track parameters
+/// and the linearization point. A cached result is reused if the requested
+/// point is within the configured tolerance of the cached one.
+///
+/// @note The cache is not thread-safe and is meant to live in the per-event
+/// state of a vertexing algorithm. It must be cleared if the magnetic field
+/// or geometry context changes.
+class TrackLinearizationCache {
+ public:
+  /// @brief The configuration struct
+  struct Config {
+    /// Maximum spatial distance between the requested and a cached point for
+    /// the cached result to be reused. The default only reuses results for
+    /// identical points, which keeps the results unchanged.
+    double positionTolerance = 0.;
+    /// Maximum time difference between the requested and a cached point
+    double timeTolerance = 0.;
+  };
+
+  /// @brief Default constructor with default configuration
+  TrackLinearizationCache();
+
+  /// @brief Constructor
+  ///
+  /// @param cfg Configuration object
+  explicit TrackLinearizationCache(const Config& cfg);
+
+  /// @brief Linearizes a track or returns a cached linearization
+  ///
+  /// @param linearizer The linearizer to use for cache misses
+  /// @param params Parameters to linearize
+  /// @param linPointTime Time associated to the linearization point
+  /// @param perigeeSurface Perigee surface belonging to the linearization point
+  /// @param gctx Geometry context
+  /// @param mctx Magnetic field context
+  /// @param fieldCache Magnetic field cache
+  ///
+  /// @return Linearized track
+  Result<LinearizedTrack> linearizeTrack(
+      const TrackLinearizer& linearizer, const BoundTrackParameters& params,
+      double linPointTime, const Surface& perigeeSurface,
+      const GeometryContext& gctx, const MagneticFieldContext& mctx,
+      MagneticFieldProvider::Cache& fieldCache);
+
+  /// @brief Linearizes many tracks around the same point
+  ///
+  /// @param linearizer The linearizer to use for cache misses
+  /// @param params Parameters of the tracks to linearize
+  /// @param linPointTime Time associated to the linearization point
+  /// @param perigeeSurface Perigee surface belonging to the linearization point
+  /// @param gctx Geometry context
+  /// @param mctx Magnetic field context
+  /// @param fieldCache Magnetic field cache
+  ///
+  /// @return Linearized tracks in the order of @p params
+  std::vector<Result<LinearizedTrack>> linearizeTracks(
+      const TrackLinearizer& linearizer,
+      std::span<const BoundTrackParameters> params, double linPointTime,
+      const Surface& perigeeSurface, const GeometryContext& gctx,
+      const MagneticFieldContext& mctx,
+      MagneticFieldProvider::Cache& fieldCache);
+
+  /// @brief Estimates the 3D impact parameters of a track or returns cached
+  /// ones
+  ///
+  /// @param ipEstimator The impact point estimator to use for cache misses
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  /// @param params Track parameters
+  /// @param vtxPos Reference position (vertex)
+  /// @param ipState The impact point estimator state
+  ///
+  /// @return Track parameters at the 3D PCA
+  Result<BoundTrackParameters> estimate3DImpactParameters(
+      const ImpactPointEstimator& ipEstimator, const GeometryContext& gctx,
+      const MagneticFieldContext& mctx, const BoundTrackParameters& params,
+      const Vector3& vtxPos, ImpactPointEstimator::State& ipState);
+
+  /// @brief Removes all cached results
+  void clear();
+
+  /// @return Number of requests answered from the cache
+  std::size_t nHits() const { return m_nHits; }
+
+  /// @return Number of requests that needed a new computation
+  std::size_t nMisses() const { return m_nMisses; }
+
+ private:
+  template <typename value_t>
+  struct Entry {
+    BoundVector parameters;
+    /// Keeps the surface alive so that its address cannot be reused
+    std::shared_ptr<const Surface> referenceSurface;
+    Vector4 point;
+    value_t value;
+  };
+
+  template <typename value_t>
+  using EntryMap = std::unordered_map<std::size_t, std::vector<Entry<value_t>>>;
+
+  /// @brief Finds a cached value for a track and point
+  ///
+  /// @param entries The cache to search
+  /// @param key Hash of the track parameters
+  /// @param params The track parameters
+  /// @param point The requested point
+  ///
+  /// @return Pointer to the cached value or nullptr
+  template <typename value_t>
+  const value_t* find(const EntryMap<value_t>& entries, std::size_t key,
+                      const BoundTrackParameters& params,
+                      const Vector4& point) const;
+
+  /// @brief Hashes the track parameters and their reference surface
+  static std::size_t hash(const BoundTrackParameters& params);
+
+  Config m_cfg;
+
+  EntryMap<LinearizedTrack> m_linearizations;
+  EntryMap<BoundTrackParameters> m_impactParameters;
+
+  std::size_t m_nHits = 0;
+  std::size_t m_nMisses = 0;
+};
+
+}  // namespace Acts
@@ -11,6 +11,7 @@
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -129,6 +130,26 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+// Merge the material accumulated from other tracks
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  if (other.m_accumulatedMaterial.size() != m_accumulatedMaterial.size()) {
+    throw std::invalid_argument(
+        "Accumulated material can only be merged with the same binning.");
+  }
+  for (std::size_t ib1 = 0; ib1 < m_accumulatedMaterial.size(); ++ib1) {
+    AccumulatedVector& accVec = m_accumulatedMaterial[ib1];
+    const AccumulatedVector& otherVec = other.m_accumulatedMaterial[ib1];
+    if (otherVec.size() != accVec.size()) {
+      throw std::invalid_argument(
+          "Accumulated material can only be merged with the same binning.");
+    }
+    for (std::size_t ib0 = 0; ib0 < accVec.size(); ++ib0) {
+      accVec[ib0].merge(otherVec[ib0]);
+    }
+  }
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
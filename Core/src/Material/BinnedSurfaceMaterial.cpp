@@ -11,6 +11,7 @@
 #include "Acts/Material/MaterialSlab.hpp"
 
 #include <ostream>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -20,6 +21,7 @@ Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     : ISurfaceMaterial(splitFactor, mappingType), m_binUtility(binUtility) {
   // fill the material with deep copy
   m_fullMaterial.push_back(std::move(fullProperties));
+  fill();
 }
 
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
@@ -27,7 +29,23 @@ Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     double splitFactor, Acts::MappingType mappingType)
     : ISurfaceMaterial(splitFactor, mappingType),
       m_binUtility(binUtility),
-      m_fullMaterial(std::move(fullProperties)) {}
+      m_fullMaterial(std::move(fullProperties)) {
+  fill();
+}
+
+void Acts::BinnedSurfaceMaterial::fill() {
+  m_nBins0 = m_fullMaterial.empty() ? 0 : m_fullMaterial.front().size();
+  m_constants.reserve(m_fullMaterial.size() * m_nBins0);
+  for (const auto& materialVector : m_fullMaterial) {
+    if (materialVector.size() != m_nBins0) {
+      throw std::invalid_argument(
+          "BinnedSurfaceMaterial: material matrix rows differ in size");
+    }
+    for (const auto& slab : materialVector) {
+      m_constants.emplace_back(slab);
+    }
+  }
+}
 
 Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::scale(double factor) {
   for (auto& materialVector : m_fullMaterial) {
@@ -35,23 +53,30 @@ Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::scale(double factor) {
       materialBin.scaleThickness(factor);
     }
   }
+  for (auto& constants : m_constants) {
+    constants.scaleThickness(factor);
+  }
   return (*this);
 }
 
 const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
     const Vector2& lp) const {
-  // the first bin
-  std::size_t ibin0 = m_binUtility.bin(lp, 0);
-  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  auto [bin0, bin1] = bins(lp);
+  return m_fullMaterial[bin1][bin0];
 }
 
 const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
     const Acts::Vector3& gp) const {
-  // the first bin
-  std::size_t ibin0 = m_binUtility.bin(gp, 0);
-  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  auto [bin0, bin1] = bins(gp);
+  return m_fullMaterial[bin1][bin0];
+}
+
+const Acts::MaterialSlab&
+Acts::BinnedSurfaceMaterial::materialSlabWithConstants(
+    const Acts::Vector3& gp, MaterialSlabConstants& constants) const {
+  auto [bin0, bin1] = bins(gp);
+  constants = m_constants[bin1 * m_nBins0 + bin0];
+  return m_fullMaterial[bin1][bin0];
 }
 
 std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
@@ -15,6 +15,10 @@
 #include "Acts/Utilities/BinAdjustment.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 
+#include <map>
+#include <stdexcept>
+#include <utility>
+
 Acts::BinnedSurfaceMaterialAccumulater::BinnedSurfaceMaterialAccumulater(
     const Config& cfg, std::unique_ptr<const Logger> mlogger)
     : m_cfg(cfg), m_logger(std::move(mlogger)) {}
@@ -24,6 +28,20 @@ Acts::BinnedSurfaceMaterialAccumulater::createState() const {
   auto state = std::make_unique<State>();
 
   /// Create the surface accumulation
+  state->accumulatedMaterial.reserve(m_cfg.materialSurfaces.size());
+  state->geometryIds.reserve(m_cfg.materialSurfaces.size());
+  auto addSurface = [&state](GeometryIdentifier geoID,
+                             AccumulatedSurfaceMaterial accMaterial) {
+    auto [it, inserted] =
+        state->surfaceIndices.try_emplace(geoID, state->geometryIds.size());
+    if (!inserted) {
+      // Keep the dense index, the last configuration wins
+      state->accumulatedMaterial[it->second] = std::move(accMaterial);
+      return;
+    }
+    state->accumulatedMaterial.push_back(std::move(accMaterial));
+    state->geometryIds.push_back(geoID);
+  };
   for (const auto& surface : m_cfg.materialSurfaces) {
     GeometryIdentifier geoID = surface->geometryId();
 
@@ -45,8 +63,7 @@ Acts::BinnedSurfaceMaterialAccumulater::createState() const {
       binUtility = adjustBinUtility(binUtility, *surface, m_cfg.geoContext);
       // Screen output for Binned Surface material
       ACTS_DEBUG("       - adjusted binning is " << binUtility);
-      state->accumulatedMaterial[geoID] =
-          AccumulatedSurfaceMaterial(binUtility);
+      addSurface(geoID, AccumulatedSurfaceMaterial(binUtility));
       // Material accumulation  is created for this
       continue;
     }
@@ -61,8 +78,7 @@ Acts::BinnedSurfaceMaterialAccumulater::createState() const {
       binUtility = adjustBinUtility(binUtility, *surface, m_cfg.geoContext);
       // Screen output for Binned Surface material
       ACTS_DEBUG("       - adjusted binning is " << binUtility);
-      state->accumulatedMaterial[geoID] =
-          AccumulatedSurfaceMaterial(binUtility);
+      addSurface(geoID, AccumulatedSurfaceMaterial(binUtility));
       // Material accumulation  is created for this
       continue;
     }
@@ -72,14 +88,13 @@ Acts::BinnedSurfaceMaterialAccumulater::createState() const {
       // Screen output for Binned Surface material
       ACTS_DEBUG("       - binning from BinnedSurfaceMaterial is "
                  << bmp->binUtility());
-      state->accumulatedMaterial[geoID] =
-          AccumulatedSurfaceMaterial(bmp->binUtility());
+      addSurface(geoID, AccumulatedSurfaceMaterial(bmp->binUtility()));
       // Material accumulation  is created for this
       continue;
     }
     // Create a homogeneous type of material
     ACTS_DEBUG("       - this is homogeneous material.");
-    state->accumulatedMaterial[geoID] = AccumulatedSurfaceMaterial();
+    addSurface(geoID, AccumulatedSurfaceMaterial());
   }
   return state;
 }
@@ -96,51 +111,63 @@ void Acts::BinnedSurfaceMaterialAccumulater::accumulate(
         "Invalid state object provided, something is seriously wrong.");
   }
 
-  using MapBin =
-      std::pair<AccumulatedSurfaceMaterial*, std::array<std::size_t, 3>>;
-  std::map<AccumulatedSurfaceMaterial*, std::array<std::size_t, 3>>
-      touchedMapBins;
+  // The first touched bin per surface
+  std::map<std::size_t, std::array<std::size_t, 3>> touchedMapBins;
 
   // Assign the hits
   for (const auto& mi : interactions) {
-    // Get the surface
-    const Surface* surface = mi.surface;
-    GeometryIdentifier geoID = surface->geometryId();
     // Get the accumulated material
-    auto accMaterial = cState->accumulatedMaterial.find(geoID);
-    if (accMaterial == cState->accumulatedMaterial.end()) {
-      throw std::invalid_argument(
-          "Surface material is not found, inconsistent configuration.");
-    }
+    std::size_t index = surfaceIndex(*cState, mi.surface->geometryId());
     // Accumulate the material - remember the touched bin
-    auto tBin = accMaterial->second.accumulate(mi.intersection, mi.materialSlab,
-                                               mi.pathCorrection);
-    touchedMapBins.insert(MapBin(&(accMaterial->second), tBin));
+    auto tBin = cState->accumulatedMaterial[index].accumulate(
+        mi.intersection, mi.materialSlab, mi.pathCorrection);
+    touchedMapBins.try_emplace(index, tBin);
   }
 
   // After mapping this track, average the touched bins
-  for (const auto& [key, value] : touchedMapBins) {
-    std::vector<std::array<std::size_t, 3>> trackBins = {value};
-    key->trackAverage(trackBins, true);
+  for (const auto& [index, tBin] : touchedMapBins) {
+    std::vector<std::array<std::size_t, 3>> trackBins = {tBin};
+    cState->accumulatedMaterial[index].trackAverage(trackBins, true);
   }
 
   // Empty bin correction
   if (m_cfg.emptyBinCorrection) {
     for (const auto& [surface, position, direction] :
          surfacesWithoutAssignment) {
-      // Get the accumulated material
-      auto missedMaterial =
-          cState->accumulatedMaterial.find(surface->geometryId());
-      if (missedMaterial == cState->accumulatedMaterial.end()) {
-        throw std::invalid_argument(
-            "Surface material is not found, inconsistent configuration.");
-      }
       // Apply empty hit correction
-      missedMaterial->second.trackAverage(position, true);
+      std::size_t index = surfaceIndex(*cState, surface->geometryId());
+      cState->accumulatedMaterial[index].trackAverage(position, true);
     }
   }
 }
 
+void Acts::BinnedSurfaceMaterialAccumulater::merge(
+    ISurfaceMaterialAccumulater::State& state,
+    const ISurfaceMaterialAccumulater::State& other) const {
+  // Cast into the right state objects (guaranteed by upstream algorithm)
+  State* cState = static_cast<State*>(&state);
+  const State* cOther = static_cast<const State*>(&other);
+  if (cState->geometryIds != cOther->geometryIds) {
+    throw std::invalid_argument(
+        "States with different material surfaces can not be merged.");
+  }
+  for (std::size_t index = 0; index < cState->accumulatedMaterial.size();
+       ++index) {
+    cState->accumulatedMaterial[index].merge(
+        cOther->accumulatedMaterial[index]);
+  }
+}
+
+std::size_t Acts::BinnedSurfaceMaterialAccumulater::surfaceIndex(
+    const State& state, GeometryIdentifier geoID) const {
+  auto it = state.surfaceIndices.find(geoID);
+  if (it == state.surfaceIndices.end()) {
+    throw std::invalid_argument(
+        "Surface material is not found, inconsistent configuration.");
+  }
+  return it->second;
+}
+
 std::map<Acts::GeometryIdentifier,
          std::shared_ptr<const Acts::ISurfaceMaterial>>
 Acts::BinnedSurfaceMaterialAccumulater::finalizeMaterial(
@@ -155,11 +182,12 @@ Acts::BinnedSurfaceMaterialAccumulater::finalizeMaterial(
         "Invalid state object provided, something is seriously wrong.");
   }
 
-  // iterate over the map to call the total average
-  for (auto& accMaterial : cState->accumulatedMaterial) {
-    ACTS_DEBUG("Finalizing map for Surface " << accMaterial.first);
-    auto sMaterial = accMaterial.second.totalAverage();
-    sMaterials[accMaterial.first] = std::move(sMaterial);
+  // iterate over the surfaces to call the total average
+  for (std::size_t index = 0; index < cState->accumulatedMaterial.size();
+       ++index) {
+    const GeometryIdentifier geoID = cState->geometryIds[index];
+    ACTS_DEBUG("Finalizing map for Surface " << geoID);
+    sMaterials[geoID] = cState->accumulatedMaterial[index].totalAverage();
   }
 
   return sMaterials;
@@ -0,0 +1,347 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/CompressedMaterialMap.hpp"
+
+#include "Acts/Utilities/AxisDefinitions.hpp"
+#include "Acts/Utilities/BinningData.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+
+using Parameters =
+    std::array<float, Acts::CompressedMaterialMap::s_nParameters>;
+
+/// Round a value to the given number of mantissa bits
+float roundMantissa(float value, unsigned int bits) {
+  if (bits >= static_cast<unsigned int>(std::numeric_limits<float>::digits -
+                                        1) ||
+      !std::isfinite(value) || value == 0.f) {
+    return value;
+  }
+  int exponent = 0;
+  // the mantissa is in [0.5, 1), the leading bit is implicit
+  const float mantissa = std::frexp(value, &exponent);
+  const float scale = std::ldexp(1.f, static_cast<int>(bits) + 1);
+  return std::ldexp(std::round(mantissa * scale) / scale, exponent);
+}
+
+bool isSupported(std::uint32_t direction) {
+  switch (static_cast<Acts::AxisDirection>(direction)) {
+    case Acts::AxisDirection::AxisX:
+    case Acts::AxisDirection::AxisY:
+    case Acts::AxisDirection::AxisZ:
+    case Acts::AxisDirection::AxisR:
+    case Acts::AxisDirection::AxisPhi:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+std::vector<std::byte> Acts::CompressedMaterialMap::encode(
+    const MaterialGrid3D& grid, const BinUtility& binUtility,
+    unsigned int mantissaBits) {
+  const auto& binningData = binUtility.binningData();
+  if (binningData.size() != 3) {
+    throw std::invalid_argument("Compressed material maps need a 3D binning");
+  }
+
+  Header header;
+  const auto min = grid.minPosition();
+  const auto max = grid.maxPosition();
+  const auto nBins = grid.numLocalBins();
+  for (std::size_t i = 0; i < 3; ++i) {
+    header.axisDirections[i] =
+        static_cast<std::uint32_t>(binningData[i].binvalue);
+    if (!isSupported(header.axisDirections[i])) {
+      throw std::invalid_argument("Incorrect bin, should be x,y,z,r,phi");
+    }
+    header.nBins[i] = static_cast<std::uint32_t>(nBins[i]);
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+  }
+  const Transform3 transform = binUtility.transform().inverse();
+  Eigen::Map<Eigen::Matrix<double, 3, 4>>(header.transform.data()) =
+      transform.matrix().topRows<3>();
+
+  // Build the dictionary, identical materials share the same entry
+  std::map<Parameters, std::uint32_t> dictionary;
+  std::vector<Parameters> materials;
+  std::vector<std::uint32_t> indices;
+  indices.reserve(grid.size());
+  for (std::size_t index = 0; index < grid.size(); ++index) {
+    const Material::ParametersVector& values = grid.at(index);
+    Parameters parameters{};
+    for (std::size_t p = 0; p < s_nParameters; ++p) {
+      parameters[p] = roundMantissa(values[p], mantissaBits);
+    }
+    auto [it, inserted] = dictionary.try_emplace(
+        parameters, static_cast<std::uint32_t>(materials.size()));
+    if (inserted) {
+      materials.push_back(parameters);
+    }
+    indices.push_back(it->second);
+  }
+  header.nMaterials = static_cast<std::uint32_t>(materials.size());
+  header.indexBytes =
+      materials.size() <= std::numeric_limits<std::uint16_t>::max() + 1u ? 2
+                                                                          : 4;
+
+  const std::size_t materialBytes =
+      materials.size() * s_nParameters * sizeof(float);
+  std::vector<std::byte> buffer(sizeof(Header) + materialBytes +
+                                indices.size() * header.indexBytes);
+  std::byte* out = buffer.data();
+  std::memcpy(out, &header, sizeof(Header));
+  out += sizeof(Header);
+  std::memcpy(out, materials.data(), materialBytes);
+  out += materialBytes;
+  for (std::uint32_t index : indices) {
+    if (header.indexBytes == 2) {
+      const auto shortIndex = static_cast<std::uint16_t>(index);
+      std::memcpy(out, &shortIndex, sizeof(shortIndex));
+    } else {
+      std::memcpy(out, &index, sizeof(index));
+    }
+    out += header.indexBytes;
+  }
+  return buffer;
+}
+
+std::vector<std::byte> Acts::CompressedMaterialMap::encode(
+    const InterpolatedMaterialMap<MaterialMapper<MaterialGrid3D>>& map,
+    unsigned int mantissaBits) {
+  return encode(map.getMapper().getGrid(), map.binUtility(), mantissaBits);
+}
+
+Acts::CompressedMaterialMap::CompressedMaterialMap(
+    std::vector<std::byte> buffer, bool interpolate)
+    : CompressedMaterialMap(
+          std::make_shared<const std::vector<std::byte>>(std::move(buffer)),
+          interpolate) {}
+
+Acts::CompressedMaterialMap::CompressedMaterialMap(
+    const std::shared_ptr<const std::vector<std::byte>>& buffer,
+    bool interpolate)
+    : CompressedMaterialMap(std::span<const std::byte>(*buffer), buffer,
+                            interpolate) {}
+
+Acts::CompressedMaterialMap::CompressedMaterialMap(
+    std::span<const std::byte> buffer, std::shared_ptr<const void> storage,
+    bool interpolate)
+    : m_storage(std::move(storage)),
+      m_buffer(buffer),
+      m_interpolate(interpolate) {
+  if (m_buffer.size() < sizeof(Header)) {
+    throw std::invalid_argument("Invalid compressed material map");
+  }
+  if (reinterpret_cast<std::uintptr_t>(m_buffer.data()) % alignof(double) !=
+      0) {
+    throw std::invalid_argument("Misaligned compressed material map");
+  }
+  std::memcpy(&m_header, m_buffer.data(), sizeof(Header));
+  if (m_header.magic != s_magic || m_header.version != s_version ||
+      m_header.nMaterials == 0 ||
+      (m_header.indexBytes != 2 && m_header.indexBytes != 4)) {
+    throw std::invalid_argument("Invalid compressed material map");
+  }
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (m_header.nBins[i] == 0 || !isSupported(m_header.axisDirections[i])) {
+      throw std::invalid_argument("Invalid compressed material map");
+    }
+    m_width[i] = (m_header.max[i] - m_header.min[i]) / m_header.nBins[i];
+    if (!std::isfinite(m_header.min[i]) || !std::isfinite(m_width[i]) ||
+        m_width[i] <= 0.) {
+      throw std::invalid_argument("Invalid compressed material map");
+    }
+  }
+  // compare in units of elements to avoid overflows for corrupted headers
+  const std::size_t materialBytes =
+      static_cast<std::size_t>(m_header.nMaterials) * s_nParameters *
+      sizeof(float);
+  if (m_buffer.size() < sizeof(Header) + materialBytes) {
+    throw std::invalid_argument("Truncated compressed material map");
+  }
+  const std::size_t indicesBytes =
+      m_buffer.size() - sizeof(Header) - materialBytes;
+  std::size_t nPoints = 1;
+  for (std::size_t i = 0; i < 3; ++i) {
+    const std::size_t n = static_cast<std::size_t>(m_header.nBins[i]) + 2u;
+    if (nPoints > indicesBytes / m_header.indexBytes / n) {
+      throw std::invalid_argument("Truncated compressed material map");
+    }
+    nPoints *= n;
+  }
+  if (indicesBytes != nPoints * m_header.indexBytes) {
+    throw std::invalid_argument("Truncated compressed material map");
+  }
+
+  m_transform.matrix().topRows<3>() =
+      Eigen::Map<const Eigen::Matrix<double, 3, 4>>(m_header.transform.data());
+  m_strides = {(m_header.nBins[1] + 2u) * (m_header.nBins[2] + 2u),
+               m_header.nBins[2] + 2u, 1u};
+  m_materials =
+      reinterpret_cast<const float*>(m_buffer.data() + sizeof(Header));
+  m_indices = m_buffer.data() + sizeof(Header) + materialBytes;
+
+  // validate all indices once, the lookups can then use them unchecked
+  for (std::size_t globalBin = 0; globalBin < nPoints; ++globalBin) {
+    if (materialIndex(globalBin) >= m_header.nMaterials) {
+      throw std::invalid_argument(
+          "Invalid material index in compressed material map");
+    }
+  }
+}
+
+const Acts::Material Acts::CompressedMaterialMap::material(
+    const Vector3& position) const {
+  return m_interpolate ? getMaterial(position) : closestMaterial(position);
+}
+
+Acts::Material Acts::CompressedMaterialMap::closestMaterial(
+    const Vector3& position) const {
+  const Vector3 local = toLocal(position);
+  std::size_t globalBin = 0;
+  for (std::size_t i = 0; i < 3; ++i) {
+    globalBin += m_strides[i] * bin(i, local[i] + 0.5 * m_width[i]);
+  }
+  return Material(
+      Eigen::Map<const Material::ParametersVector>(parameters(globalBin)));
+}
+
+Acts::Material Acts::CompressedMaterialMap::getMaterial(
+    const Vector3& position) const {
+  const Vector3 local = toLocal(position);
+
+  // the value of a bin is the material at its lower left edge
+  std::array<std::size_t, 3> lower{};
+  std::array<std::size_t, 3> upper{};
+  std::array<float, 3> fraction{};
+  for (std::size_t i = 0; i < 3; ++i) {
+    lower[i] = bin(i, local[i]);
+    upper[i] = std::min<std::size_t>(lower[i] + 1, m_header.nBins[i] + 1u);
+    const double edge =
+        m_header.min[i] + (static_cast<double>(lower[i]) - 1.) * m_width[i];
+    fraction[i] = static_cast<float>((local[i] - edge) / m_width[i]);
+  }
+
+  // gather the corners in a structure-of-arrays layout, the weighted sums
+  // are fixed-size loops which the compiler vectorizes
+  constexpr std::size_t nCorners = 8;
+  std::array<float, nCorners> weights{};
+  std::array<std::array<float, nCorners>, s_nParameters> corners{};
+  for (std::size_t c = 0; c < nCorners; ++c) {
+    float weight = 1.f;
+    std::size_t globalBin = 0;
+    for (std::size_t i = 0; i < 3; ++i) {
+      const bool isUpper = ((c >> (2 - i)) & 1u) != 0;
+      weight *= isUpper ? fraction[i] : 1.f - fraction[i];
+      globalBin += m_strides[i] * (isUpper ? upper[i] : lower[i]);
+    }
+    weights[c] = weight;
+    const float* values = parameters(globalBin);
+    for (std::size_t p = 0; p < s_nParameters; ++p) {
+      corners[p][c] = values[p];
+    }
+  }
+
+  Material::ParametersVector result;
+  for (std::size_t p = 0; p < s_nParameters; ++p) {
+    float sum = 0.f;
+    for (std::size_t c = 0; c < nCorners; ++c) {
+      sum += weights[c] * corners[p][c];
+    }
+    result[p] = sum;
+  }
+  return Material(result);
+}
+
+bool Acts::CompressedMaterialMap::isInside(const Vector3& position) const {
+  const Vector3 local = toLocal(position);
+  for (std::size_t i = 0; i < 3; ++i) {
+    // written such that NaN is outside
+    if (!(local[i] >= m_header.min[i] && local[i] < m_header.max[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::ostream& Acts::CompressedMaterialMap::toStream(std::ostream& sl) const {
+  sl << "Acts::CompressedMaterialMap : " << std::endl;
+  sl << "   - Number of Material bins [0,1,2] : " << m_header.nBins[0] << " / "
+     << m_header.nBins[1] << " / " << m_header.nBins[2] << std::endl;
+  sl << "   - Number of distinct materials    : " << m_header.nMaterials
+     << std::endl;
+  sl << "   - Interpolation                   : "
+     << (m_interpolate ? "trilinear" : "closest grid point") << std::endl;
+  return sl;
+}
+
+Acts::Vector3 Acts::CompressedMaterialMap::toLocal(
+    const Vector3& position) const {
+  const Vector3 pos = m_transform * position;
+  Vector3 local;
+  for (std::size_t i = 0; i < 3; ++i) {
+    switch (static_cast<AxisDirection>(m_header.axisDirections[i])) {
+      case AxisDirection::AxisX:
+        local[i] = pos.x();
+        break;
+      case AxisDirection::AxisY:
+        local[i] = pos.y();
+        break;
+      case AxisDirection::AxisZ:
+        local[i] = pos.z();
+        break;
+      case AxisDirection::AxisR:
+        local[i] = VectorHelpers::perp(pos);
+        break;
+      default:
+        local[i] = VectorHelpers::phi(pos);
+        break;
+    }
+  }
+  return local;
+}
+
+std::size_t Acts::CompressedMaterialMap::bin(std::size_t axis,
+                                             double x) const {
+  // same convention as an open equidistant axis. clamp before the integer
+  // conversion, which is undefined for out-of-range values. NaN ends up in
+  // the underflow bin.
+  const double b = std::floor((x - m_header.min[axis]) / m_width[axis]) + 1.;
+  if (!(b > 0.)) {
+    return 0;
+  }
+  const double last = static_cast<double>(m_header.nBins[axis]) + 1.;
+  return static_cast<std::size_t>(std::min(b, last));
+}
+
+std::size_t Acts::CompressedMaterialMap::materialIndex(
+    std::size_t globalBin) const {
+  if (m_header.indexBytes == 2) {
+    return reinterpret_cast<const std::uint16_t*>(m_indices)[globalBin];
+  }
+  return reinterpret_cast<const std::uint32_t*>(m_indices)[globalBin];
+}
+
+const float* Acts::CompressedMaterialMap::parameters(
+    std::size_t globalBin) const {
+  return m_materials + s_nParameters * materialIndex(globalBin);
+}
@@ -17,10 +17,13 @@ namespace Acts {
 HomogeneousSurfaceMaterial::HomogeneousSurfaceMaterial(const MaterialSlab& full,
                                                        double splitFactor,
                                                        MappingType mappingType)
-    : ISurfaceMaterial(splitFactor, mappingType), m_fullMaterial(full) {}
+    : ISurfaceMaterial(splitFactor, mappingType),
+      m_fullMaterial(full),
+      m_constants(full) {}
 
 HomogeneousSurfaceMaterial& HomogeneousSurfaceMaterial::scale(double factor) {
   m_fullMaterial.scaleThickness(factor);
+  m_constants.scaleThickness(factor);
   return *this;
 }
 
@@ -34,6 +37,12 @@ const MaterialSlab& HomogeneousSurfaceMaterial::materialSlab(
   return m_fullMaterial;
 }
 
+const MaterialSlab& HomogeneousSurfaceMaterial::materialSlabWithConstants(
+    const Vector3& /*gp*/, MaterialSlabConstants& constants) const {
+  constants = m_constants;
+  return m_fullMaterial;
+}
+
 std::ostream& HomogeneousSurfaceMaterial::toStream(std::ostream& sl) const {
   sl << "HomogeneousSurfaceMaterial : " << std::endl;
   sl << "   - fullMaterial : " << m_fullMaterial << std::endl;
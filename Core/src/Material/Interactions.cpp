@@ -108,6 +108,16 @@ inline float computeEpsilon(float molarElectronDensity, float thickness,
   return 0.5f * K * molarElectronDensity * thickness * rq.q2OverBeta2;
 }
 
+/// Compute epsilon energy pre-factor from precomputed slab constants.
+///
+/// Uses the same evaluation order as computeEpsilon above such that both
+/// give identical results.
+inline float computeEpsilon(const Acts::MaterialSlabConstants& constants,
+                            const RelativisticQuantities& rq) {
+  return constants.epsilonPerQ2OverBeta2PerThickness * constants.thickness *
+         rq.q2OverBeta2;
+}
+
 /// Compute epsilon logarithmic derivative w/ respect to q/p.
 inline float logDeriveEpsilon(float qOverP, const RelativisticQuantities& rq) {
   // only need to compute d(q²/beta²)/(q²/beta²); everything else cancels.
@@ -526,3 +536,139 @@ float Acts::computeMultipleScatteringTheta0(const MaterialSlab& slab,
     return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
   }
 }
+
+Acts::MaterialSlabConstants::MaterialSlabConstants(const MaterialSlab& slab)
+    : isVacuum(slab.isVacuum()) {
+  if (isVacuum) {
+    return;
+  }
+  const float Ne = slab.material().molarElectronDensity();
+  thickness = slab.thickness();
+  thicknessInX0 = slab.thicknessInX0();
+  meanExcitationEnergy = slab.material().meanExcitationEnergy();
+  epsilonPerQ2OverBeta2PerThickness = 0.5f * K * Ne;
+  const float plasmaEnergy =
+      PlasmaEnergyScale * std::sqrt(Ne / static_cast<float>(1 / 1_cm3));
+  logPlasmaEnergyOverI = std::log(plasmaEnergy / meanExcitationEnergy);
+  rossiGreisenCorrection = 1.0f + 0.125f * std::log10(10.0f * thicknessInX0);
+}
+
+Acts::ContinuousInteractionParameters
+Acts::computeContinuousInteractionParameters(
+    const MaterialSlabConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ) {
+  assert((absPdg == Acts::makeAbsolutePdgParticle(absPdg)) &&
+         "pdg is not absolute");
+
+  ContinuousInteractionParameters parameters;
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum) {
+    return parameters;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+
+  // multiple scattering, see computeMultipleScatteringTheta0
+  const float xOverX0 = constants.thicknessInX0;
+  const float momentumInv = std::abs(qOverP / absQ);
+  const float t = std::sqrt(xOverX0 * rq.q2OverBeta2);
+  if (absPdg == PdgParticle::eElectron) {
+    parameters.theta0 =
+        17.5_MeV * momentumInv * t * constants.rossiGreisenCorrection;
+  } else {
+    parameters.theta0 = theta0Highland(xOverX0, momentumInv, rq.q2OverBeta2);
+  }
+
+  // ionisation loss, see computeEnergyLossLandau(Sigma)
+  const float I = constants.meanExcitationEnergy;
+  const float eps = computeEpsilon(constants, rq);
+  const float dhalf = (rq.betaGamma < 10.0f)
+                          ? 0.0f
+                          : std::log(rq.betaGamma) +
+                                constants.logPlasmaEnergyOverI - 0.5f;
+  const float u = computeMassTerm(Me, rq);
+  const float running =
+      std::log(u / I) + std::log(eps / I) + 0.2f - rq.beta2 - 2 * dhalf;
+  parameters.energyLossLandau = eps * running;
+  parameters.energyLossLandauSigma = convertLandauFwhmToGaussianSigma(4 * eps);
+
+  return parameters;
+}
+
+void Acts::MaterialSlabConstants::scaleThickness(float scale) {
+  assert((0 <= scale) && "Thickness scale must be non-negative");
+  if (isVacuum) {
+    return;
+  }
+  if (scale == 0.0f) {
+    *this = MaterialSlabConstants();
+    return;
+  }
+  // same operations as in MaterialSlab::scaleThickness
+  thickness *= scale;
+  thicknessInX0 *= scale;
+  rossiGreisenCorrection = 1.0f + 0.125f * std::log10(10.0f * thicknessInX0);
+}
+
+float Acts::computeEnergyLossBethe(const MaterialSlabConstants& constants,
+                                   float m, float qOverP, float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  const float I = constants.meanExcitationEnergy;
+  const float eps = computeEpsilon(constants, rq);
+  const float dhalf = (rq.betaGamma < 10.0f)
+                          ? 0.0f
+                          : std::log(rq.betaGamma) +
+                                constants.logPlasmaEnergyOverI - 0.5f;
+  const float u = computeMassTerm(Me, rq);
+  const float wmax = computeWMax(m, rq);
+  // see computeEnergyLossBethe(const MaterialSlab&, ...)
+  const float running =
+      std::log(u / I) + std::log(wmax / I) - 2.0f * rq.beta2 - 2.0f * dhalf;
+  return eps * running;
+}
+
+float Acts::computeEnergyLossLandauSigmaQOverP(
+    const MaterialSlabConstants& constants, float m, float qOverP, float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  // the Landau-Vavilov fwhm is 4*eps (see RPP2018 fig. 33.7)
+  const float fwhm = 4 * computeEpsilon(constants, rq);
+  const float sigmaE = convertLandauFwhmToGaussianSigma(fwhm);
+  // see computeEnergyLossLandauSigmaQOverP(const MaterialSlab&, ...)
+  const float pInv = qOverP / absQ;
+  const float qOverBeta = std::sqrt(rq.q2OverBeta2);
+  return qOverBeta * pInv * pInv * sigmaE;
+}
+
+float Acts::computeMultipleScatteringTheta0(
+    const MaterialSlabConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ) {
+  assert((absPdg == Acts::makeAbsolutePdgParticle(absPdg)) &&
+         "pdg is not absolute");
+
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum) {
+    return 0.0f;
+  }
+
+  const float xOverX0 = constants.thicknessInX0;
+  const float momentumInv = std::abs(qOverP / absQ);
+  const float q2OverBeta2 = RelativisticQuantities(m, qOverP, absQ).q2OverBeta2;
+
+  // electron or positron
+  if (absPdg == PdgParticle::eElectron) {
+    const float t = std::sqrt(xOverX0 * q2OverBeta2);
+    return 17.5_MeV * momentumInv * t * constants.rossiGreisenCorrection;
+  } else {
+    return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
+  }
+}
@@ -79,6 +79,41 @@ Acts::MaterialMapper::mapMaterial(State& state, const GeometryContext& gctx,
   return {mappedMaterial, unmappedMaterial};
 }
 
+std::pair<std::size_t, std::size_t> Acts::MaterialMapper::mapMaterial(
+    State& state, const GeometryContext& gctx, const MagneticFieldContext& mctx,
+    const MaterialTrackView& mtView, const Options& options) const {
+  auto [surfaceAssignments, volumeAssignments] =
+      m_cfg.assignmentFinder->assignmentCandidates(gctx, mctx, mtView.position,
+                                                   mtView.momentum);
+
+  // Fill the re-used interaction buffer, skipping invalid steps
+  auto& materialInteractions = state.materialInteractions;
+  materialInteractions.clear();
+  materialInteractions.reserve(mtView.size());
+  for (std::size_t is = 0; is < mtView.size(); ++is) {
+    if (mtView.length[is] == 0) {
+      continue;
+    }
+    materialInteractions.push_back(mtView.interaction(is));
+  }
+
+  // Assign the surface interactions and accumulate
+  auto [assigned, unassigned, emptyBinSurfaces] =
+      MaterialInteractionAssignment::assign(gctx, materialInteractions,
+                                            surfaceAssignments,
+                                            options.assignmentOptions);
+  m_cfg.surfaceMaterialAccumulater->accumulate(
+      *state.surfaceMaterialAccumulaterState, assigned, emptyBinSurfaces);
+
+  return {assigned.size(), unassigned.size()};
+}
+
+void Acts::MaterialMapper::mergeState(State& state, const State& other) const {
+  m_cfg.surfaceMaterialAccumulater->merge(
+      *state.surfaceMaterialAccumulaterState,
+      *other.surfaceMaterialAccumulaterState);
+}
+
 Acts::MaterialMapper::DetectorMaterialMaps Acts::MaterialMapper::finalizeMaps(
     const State& state) const {
   // The final maps
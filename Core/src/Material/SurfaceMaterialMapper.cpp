@@ -30,6 +30,7 @@
 
 #include <cstddef>
 #include <ostream>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -192,6 +193,18 @@ void SurfaceMaterialMapper::finalizeMaps(State& mState) const {
   }
 }
 
+void SurfaceMaterialMapper::mergeState(State& mState,
+                                       const State& other) const {
+  for (const auto& [geoID, accMaterial] : other.accumulatedMaterial) {
+    auto target = mState.accumulatedMaterial.find(geoID);
+    if (target == mState.accumulatedMaterial.end()) {
+      throw std::invalid_argument(
+          "Surface material is not found, inconsistent configuration.");
+    }
+    target->second.merge(accMaterial);
+  }
+}
+
 void SurfaceMaterialMapper::mapMaterialTrack(
     State& mState, RecordedMaterialTrack& mTrack) const {
   // Retrieve the recorded material from the recorded material track
@@ -418,7 +431,7 @@ void SurfaceMaterialMapper::mapInteraction(
       if (binnedMaterial != nullptr) {
         key->trackVariance(
             trackBins,
-            binnedMaterial->fullMaterial()[trackBins[0][1]][trackBins[0][0]]);
+            binnedMaterial->materialSlab(trackBins[0][0], trackBins[0][1]));
       }
     }
     key->trackAverage(trackBins);
@@ -495,7 +508,7 @@ void SurfaceMaterialMapper::mapSurfaceInteraction(
       if (binnedMaterial != nullptr) {
         key->trackVariance(
             trackBins,
-            binnedMaterial->fullMaterial()[trackBins[0][1]][trackBins[0][0]],
+            binnedMaterial->materialSlab(trackBins[0][0], trackBins[0][1]),
             true);
       }
     }
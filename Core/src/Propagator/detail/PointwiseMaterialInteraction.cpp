@@ -15,7 +15,7 @@ namespace Acts::detail {
 void PointwiseMaterialInteraction::evaluatePointwiseMaterialInteraction(
     bool multipleScattering, bool energyLoss) {
   if (energyLoss) {
-    Eloss = computeEnergyLossBethe(slab, mass, qOverP, absQ);
+    Eloss = computeEnergyLossBethe(constants, mass, qOverP, absQ);
   }
   // Compute contributions from interactions
   if (performCovarianceTransport) {
@@ -29,7 +29,7 @@ void PointwiseMaterialInteraction::covarianceContributions(
   if (multipleScattering) {
     // TODO use momentum before or after energy loss in backward mode?
     const float theta0 =
-        computeMultipleScatteringTheta0(slab, absPdg, mass, qOverP, absQ);
+        computeMultipleScatteringTheta0(constants, absPdg, mass, qOverP, absQ);
     // sigmaPhi = theta0 / sin(theta)
     const auto sigmaPhi = theta0 * (dir.norm() / VectorHelpers::perp(dir));
     variancePhi = sigmaPhi * sigmaPhi;
@@ -39,7 +39,7 @@ void PointwiseMaterialInteraction::covarianceContributions(
   // TODO just ionisation loss or full energy loss?
   if (energyLoss) {
     const float sigmaQoverP =
-        computeEnergyLossLandauSigmaQOverP(slab, mass, qOverP, absQ);
+        computeEnergyLossLandauSigmaQOverP(constants, mass, qOverP, absQ);
     varianceQoverP = sigmaQoverP * sigmaQoverP;
   }
 }
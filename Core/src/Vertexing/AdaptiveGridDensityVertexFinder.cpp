@@ -17,30 +17,48 @@ Acts::AdaptiveGridDensityVertexFinder::find(
   // Remove density contributions from tracks removed from track collection
   if (m_cfg.cacheGridStateForTrackRemoval && state.isInitialized &&
       !state.tracksToRemove.empty()) {
+    std::vector<const DensityMap*> removedDensities;
+    removedDensities.reserve(state.tracksToRemove.size());
     for (auto trk : state.tracksToRemove) {
       auto it = state.trackDensities.find(trk);
       if (it == state.trackDensities.end()) {
         // Track was never added to grid, so cannot remove it
         continue;
       }
-      m_cfg.gridDensity.subtractTrack(it->second, state.mainDensityMap);
+      removedDensities.push_back(&it->second);
     }
+    // Remove all tracks in one pass over the main grid
+    m_cfg.gridDensity.subtractTrackDensities(removedDensities,
+                                             state.mainDensityMap);
   } else {
     state.mainDensityMap = DensityMap();
-    // Fill with track densities
+    // Track densities that are not cached in the state
+    std::vector<DensityMap> trackDensityMaps;
+    std::vector<const DensityMap*> addedDensities;
+    if (!m_cfg.cacheGridStateForTrackRemoval) {
+      trackDensityMaps.reserve(trackVector.size());
+    }
+    addedDensities.reserve(trackVector.size());
+    // Compute the track densities
     for (auto trk : trackVector) {
       const BoundTrackParameters& trkParams = m_cfg.extractParameters(trk);
       // Take only tracks that fulfill selection criteria
       if (!doesPassTrackSelection(trkParams)) {
         continue;
       }
-      auto trackDensityMap =
-          m_cfg.gridDensity.addTrack(trkParams, state.mainDensityMap);
+      auto trackDensityMap = m_cfg.gridDensity.createTrackDensityMap(trkParams);
       // Cache track density contribution to main grid if enabled
       if (m_cfg.cacheGridStateForTrackRemoval) {
-        state.trackDensities[trk] = std::move(trackDensityMap);
+        DensityMap& cached = state.trackDensities[trk];
+        cached = std::move(trackDensityMap);
+        addedDensities.push_back(&cached);
+      } else {
+        addedDensities.push_back(
+            &trackDensityMaps.emplace_back(std::move(trackDensityMap)));
       }
     }
+    // Fill the main grid in one pass
+    m_cfg.gridDensity.addTrackDensities(addedDensities, state.mainDensityMap);
     state.isInitialized = true;
   }
 
@@ -21,18 +21,90 @@ namespace {
 /// distribution
 /// @note The constant prefactor (2 * pi)^(- nDim / 2) is discarded
 ///
-/// @param args Coordinates where the Gaussian should be evaluated
-/// @note args must be in a coordinate system with origin at the mean
-/// values of the Gaussian
-/// @param cov Covariance matrix
-///
-/// @return Multivariate Gaussian evaluated at args
+/// The inverse and the determinant of the covariance are computed once so
+/// that the Gaussian can be evaluated cheaply on all bins of a track grid.
 template <unsigned int nDim>
-double multivariateGaussian(const ActsVector<nDim>& args,
-                            const ActsSquareMatrix<nDim>& cov) {
-  double exponent = -0.5 * args.transpose().dot(cov.inverse() * args);
-  double gaussianDensity = safeExp(exponent) / std::sqrt(cov.determinant());
-  return gaussianDensity;
+class MultivariateGaussian {
+ public:
+  /// @param cov Covariance matrix
+  explicit MultivariateGaussian(const ActsSquareMatrix<nDim>& cov)
+      : m_covInverse(cov.inverse()),
+        m_sqrtDeterminant(std::sqrt(cov.determinant())) {}
+
+  /// @param args Coordinates where the Gaussian should be evaluated
+  /// @note args must be in a coordinate system with origin at the mean
+  /// values of the Gaussian
+  ///
+  /// @return Multivariate Gaussian evaluated at args
+  double operator()(const ActsVector<nDim>& args) const {
+    double exponent = -0.5 * args.transpose().dot(m_covInverse * args);
+    return safeExp(exponent) / m_sqrtDeterminant;
+  }
+
+ private:
+  ActsSquareMatrix<nDim> m_covInverse;
+  double m_sqrtDeterminant;
+};
+
+/// @brief Adds (or subtracts) sorted track densities to an overall density
+/// in one merge pass. Entries with the same bin are accumulated in the order
+/// of the input so that the result is identical to adding them one by one.
+void mergeDensities(
+    AdaptiveGridTrackDensity::DensityMap::sequence_type&& trackEntries,
+    bool isSorted, float sign,
+    AdaptiveGridTrackDensity::DensityMap& mainDensityMap) {
+  using DensityMap = AdaptiveGridTrackDensity::DensityMap;
+
+  if (!isSorted) {
+    std::stable_sort(
+        trackEntries.begin(), trackEntries.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+  }
+
+  DensityMap::sequence_type mainEntries = mainDensityMap.extract_sequence();
+  DensityMap::sequence_type merged;
+  merged.reserve(mainEntries.size() + trackEntries.size());
+
+  auto mainIt = mainEntries.begin();
+  auto trackIt = trackEntries.begin();
+  while (trackIt != trackEntries.end()) {
+    // Copy all bins which are not affected by the tracks
+    while (mainIt != mainEntries.end() && mainIt->first < trackIt->first) {
+      merged.push_back(*mainIt++);
+    }
+
+    const AdaptiveGridTrackDensity::Bin bin = trackIt->first;
+    float density = 0;
+    if (mainIt != mainEntries.end() && mainIt->first == bin) {
+      density = (mainIt++)->second;
+    }
+    for (; trackIt != trackEntries.end() && trackIt->first == bin; ++trackIt) {
+      density += sign * trackIt->second;
+    }
+    merged.emplace_back(bin, density);
+  }
+  merged.insert(merged.end(), mainIt, mainEntries.end());
+
+  mainDensityMap.adopt_sequence(boost::container::ordered_unique_range,
+                                std::move(merged));
+}
+
+/// @brief Concatenates the entries of several track density maps
+AdaptiveGridTrackDensity::DensityMap::sequence_type concatenateDensities(
+    const std::vector<const AdaptiveGridTrackDensity::DensityMap*>&
+        trackDensityMaps) {
+  std::size_t nEntries = 0;
+  for (const auto* trackDensityMap : trackDensityMaps) {
+    nEntries += trackDensityMap->size();
+  }
+
+  AdaptiveGridTrackDensity::DensityMap::sequence_type entries;
+  entries.reserve(nEntries);
+  for (const auto* trackDensityMap : trackDensityMaps) {
+    entries.insert(entries.end(), trackDensityMap->begin(),
+                   trackDensityMap->end());
+  }
+  return entries;
 }
 
 }  // namespace
@@ -181,6 +253,34 @@ AdaptiveGridTrackDensity::getMaxZTPositionAndWidth(
 
 AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::addTrack(
     const BoundTrackParameters& trk, DensityMap& mainDensityMap) const {
+  DensityMap trackDensityMap = createTrackDensityMap(trk);
+
+  if (!trackDensityMap.empty()) {
+    mergeDensities(DensityMap::sequence_type(trackDensityMap.begin(),
+                                             trackDensityMap.end()),
+                   true, 1.f, mainDensityMap);
+  }
+
+  return trackDensityMap;
+}
+
+void AdaptiveGridTrackDensity::addTrackDensities(
+    const std::vector<const DensityMap*>& trackDensityMaps,
+    DensityMap& mainDensityMap) const {
+  mergeDensities(concatenateDensities(trackDensityMaps),
+                 trackDensityMaps.size() <= 1, 1.f, mainDensityMap);
+}
+
+void AdaptiveGridTrackDensity::subtractTrackDensities(
+    const std::vector<const DensityMap*>& trackDensityMaps,
+    DensityMap& mainDensityMap) const {
+  mergeDensities(concatenateDensities(trackDensityMaps),
+                 trackDensityMaps.size() <= 1, -1.f, mainDensityMap);
+}
+
+AdaptiveGridTrackDensity::DensityMap
+AdaptiveGridTrackDensity::createTrackDensityMap(
+    const BoundTrackParameters& trk) const {
   Vector3 impactParams = trk.impactParameters();
   ActsSquareMatrix<3> cov = trk.impactParameterCovariance().value();
 
@@ -203,14 +303,8 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::addTrack(
 
   Bin centralBin = {centralZBin, centralTBin};
 
-  DensityMap trackDensityMap = createTrackGrid(
-      impactParams, centralBin, cov, spatialTrkGridSize, temporalTrkGridSize);
-
-  for (const auto& [bin, density] : trackDensityMap) {
-    mainDensityMap[bin] += density;
-  }
-
-  return trackDensityMap;
+  return createTrackGrid(impactParams, centralBin, cov, spatialTrkGridSize,
+                         temporalTrkGridSize);
 }
 
 void AdaptiveGridTrackDensity::subtractTrack(const DensityMap& trackDensityMap,
@@ -224,8 +318,6 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
     const Vector3& impactParams, const Bin& centralBin,
     const SquareMatrix3& cov, std::uint32_t spatialTrkGridSize,
     std::uint32_t temporalTrkGridSize) const {
-  DensityMap trackDensityMap;
-
   std::uint32_t halfSpatialTrkGridSize = (spatialTrkGridSize - 1) / 2;
   std::int32_t firstZBin = centralBin.first - halfSpatialTrkGridSize;
 
@@ -233,38 +325,47 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
   std::uint32_t halfTemporalTrkGridSize = (temporalTrkGridSize - 1) / 2;
   std::int32_t firstTBin = centralBin.second - halfTemporalTrkGridSize;
 
+  const MultivariateGaussian<3> gaussian3D(cov);
+  const MultivariateGaussian<2> gaussian2D(cov.topLeftCorner<2, 2>());
+
+  // The bins are visited in the order of the map so that the entries can be
+  // adopted without any sorting
+  DensityMap::sequence_type entries;
+  entries.reserve(spatialTrkGridSize * temporalTrkGridSize);
+
   // Loop over bins
-  for (std::uint32_t i = 0; i < temporalTrkGridSize; i++) {
-    std::int32_t tBin = firstTBin + i;
-    double t = getTemporalBinCenter(tBin);
-    if (t < m_cfg.temporalWindow.first || t > m_cfg.temporalWindow.second) {
+  for (std::uint32_t j = 0; j < spatialTrkGridSize; j++) {
+    std::int32_t zBin = firstZBin + j;
+    double z = getSpatialBinCenter(zBin);
+    if (z < m_cfg.spatialWindow.first || z > m_cfg.spatialWindow.second) {
       continue;
     }
-    for (std::uint32_t j = 0; j < spatialTrkGridSize; j++) {
-      std::int32_t zBin = firstZBin + j;
-      double z = getSpatialBinCenter(zBin);
-      if (z < m_cfg.spatialWindow.first || z > m_cfg.spatialWindow.second) {
+    for (std::uint32_t i = 0; i < temporalTrkGridSize; i++) {
+      std::int32_t tBin = firstTBin + i;
+      double t = getTemporalBinCenter(tBin);
+      if (t < m_cfg.temporalWindow.first || t > m_cfg.temporalWindow.second) {
         continue;
       }
       // Bin coordinates in the d-z-t plane
       Vector3 binCoords(0., z, t);
       // Transformation to coordinate system with origin at the track center
       binCoords -= impactParams;
-      Bin bin = {zBin, tBin};
       double density = 0;
       if (m_cfg.useTime) {
-        density = multivariateGaussian<3>(binCoords, cov);
+        density = gaussian3D(binCoords);
       } else {
-        density = multivariateGaussian<2>(binCoords.head<2>(),
-                                          cov.topLeftCorner<2, 2>());
+        density = gaussian2D(binCoords.head<2>());
       }
       // Only add density if it is positive (otherwise it is 0)
       if (density > 0) {
-        trackDensityMap[bin] = density;
+        entries.emplace_back(Bin{zBin, tBin}, static_cast<float>(density));
       }
     }
   }
 
+  DensityMap trackDensityMap;
+  trackDensityMap.adopt_sequence(boost::container::ordered_unique_range,
+                                 std::move(entries));
   return trackDensityMap;
 }
 
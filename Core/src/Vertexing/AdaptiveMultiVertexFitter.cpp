@@ -13,11 +13,54 @@
 #include "Acts/Vertexing/KalmanVertexUpdater.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <unordered_map>
+
+void Acts::AdaptiveMultiVertexFitter::State::buildFitIndex() {
+  fitVertexInfos.clear();
+  fitTrackOffsets.assign(1, 0);
+  fitTracksAtVertex.clear();
+  fitTrackIndices.clear();
+  fitTrackLinkOffsets.assign(1, 0);
+  fitTrackLinks.clear();
+
+  std::unordered_map<InputTrack, std::uint32_t> trackIndices;
+
+  for (Vertex* vtx : vertexCollection) {
+    VertexInfo& vtxInfo = vtxInfoMap[vtx];
+    fitVertexInfos.push_back(&vtxInfo);
+
+    for (const auto& trk : vtxInfo.trackLinks) {
+      fitTracksAtVertex.push_back(
+          &tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
+
+      auto [it, inserted] = trackIndices.try_emplace(
+          trk, static_cast<std::uint32_t>(trackIndices.size()));
+      if (inserted) {
+        // Link the track to all of its vertices once
+        auto [begin, end] = trackToVerticesMultiMap.equal_range(trk);
+        for (auto link = begin; link != end; ++link) {
+          fitTrackLinks.push_back(
+              &tracksAtVerticesMap.at(std::make_pair(trk, link->second)));
+        }
+        fitTrackLinkOffsets.push_back(
+            static_cast<std::uint32_t>(fitTrackLinks.size()));
+      }
+      fitTrackIndices.push_back(it->second);
+    }
+
+    fitTrackOffsets.push_back(
+        static_cast<std::uint32_t>(fitTracksAtVertex.size()));
+  }
+}
+
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
     State& state, const VertexingOptions& vertexingOptions) const {
   // Reset annealing tool
   state.annealingState = AnnealingUtility::State();
 
+  // Number the vertices and tracks once for all iterations
+  state.buildFitIndex();
+
   // Boolean indicating whether any of the vertices has moved more than
   // m_cfg.maxRelativeShift during the last iteration. We will keep iterating
   // until the equilibrium (i.e., the lowest temperature) is reached in
@@ -32,8 +75,9 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
   while (nIter < m_cfg.maxIterations &&
          (!state.annealingState.equilibriumReached || !isSmallShift)) {
     // Initial loop over all vertices in state.vertexCollection
-    for (auto vtx : state.vertexCollection) {
-      VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+    for (std::size_t iVtx = 0; iVtx < state.vertexCollection.size(); ++iVtx) {
+      Vertex* vtx = state.vertexCollection[iVtx];
+      VertexInfo& vtxInfo = *state.fitVertexInfos[iVtx];
       vtxInfo.relinearize = false;
       // Store old position of vertex, i.e. seed position
       // in case of first iteration or position determined
@@ -63,9 +107,8 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
       }
 
       // Check if we use the constraint during the vertex fit
-      if (state.vtxInfoMap[vtx].constraint.fullCovariance() !=
-          SquareMatrix4::Zero()) {
-        const Acts::Vertex& constraint = state.vtxInfoMap[vtx].constraint;
+      if (vtxInfo.constraint.fullCovariance() != SquareMatrix4::Zero()) {
+        const Acts::Vertex& constraint = vtxInfo.constraint;
         vtx->setFullPosition(constraint.fullPosition());
         vtx->setFitQuality(constraint.fitQuality());
         vtx->setFullCovariance(constraint.fullCovariance());
@@ -76,7 +119,7 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
       // Set vertexCompatibility for all TrackAtVertex objects
       // at the current vertex
       auto setCompatibilitiesResult =
-          setAllVertexCompatibilities(state, vtx, vertexingOptions);
+          setAllVertexCompatibilities(state, iVtx, vertexingOptions);
       if (!setCompatibilitiesResult.ok()) {
         // Print vertices and associated tracks if logger is in debug mode
         if (logger().doPrint(Logging::DEBUG)) {
@@ -202,9 +245,10 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::prepareVertexForFit(
 
   // Loop over all tracks at the vertex
   for (const auto& trk : vtxInfo.trackLinks) {
-    auto res = m_cfg.ipEst.estimate3DImpactParameters(
-        vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_cfg.extractParameters(trk), seedPos, state.ipState);
+    auto res = state.linearizationCache.estimate3DImpactParameters(
+        m_cfg.ipEst, vertexingOptions.geoContext,
+        vertexingOptions.magFieldContext, m_cfg.extractParameters(trk),
+        seedPos, state.ipState);
     if (!res.ok()) {
       return res.error();
     }
@@ -215,19 +259,22 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::prepareVertexForFit(
 }
 
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setAllVertexCompatibilities(
-    State& state, Vertex* vtx, const VertexingOptions& vertexingOptions) const {
-  VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+    State& state, std::size_t vtxIndex,
+    const VertexingOptions& vertexingOptions) const {
+  VertexInfo& vtxInfo = *state.fitVertexInfos[vtxIndex];
+  const std::uint32_t firstTrk = state.fitTrackOffsets[vtxIndex];
 
   // Loop over all tracks that are associated with vtx and estimate their
   // compatibility
-  for (const auto& trk : vtxInfo.trackLinks) {
-    auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  for (std::size_t iTrk = 0; iTrk < vtxInfo.trackLinks.size(); ++iTrk) {
+    const InputTrack& trk = vtxInfo.trackLinks[iTrk];
+    TrackAtVertex& trkAtVtx = *state.fitTracksAtVertex[firstTrk + iTrk];
     // Recover from cases where linearization point != 0 but
     // more tracks were added later on
     if (!vtxInfo.impactParams3D.contains(trk)) {
-      auto res = m_cfg.ipEst.estimate3DImpactParameters(
-          vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-          m_cfg.extractParameters(trk),
+      auto res = state.linearizationCache.estimate3DImpactParameters(
+          m_cfg.ipEst, vertexingOptions.geoContext,
+          vertexingOptions.magFieldContext, m_cfg.extractParameters(trk),
           VectorHelpers::position(vtxInfo.linPoint), state.ipState);
       if (!res.ok()) {
         return res.error();
@@ -259,8 +306,9 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setAllVertexCompatibilities(
 
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
     State& state, const VertexingOptions& vertexingOptions) const {
-  for (auto vtx : state.vertexCollection) {
-    VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+  for (std::size_t iVtx = 0; iVtx < state.vertexCollection.size(); ++iVtx) {
+    Vertex* vtx = state.vertexCollection[iVtx];
+    VertexInfo& vtxInfo = *state.fitVertexInfos[iVtx];
 
     if (vtxInfo.relinearize) {
       vtxInfo.linPoint = vtxInfo.oldPosition;
@@ -270,22 +318,27 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
         Surface::makeShared<PerigeeSurface>(
             VectorHelpers::position(vtxInfo.linPoint));
 
-    for (const auto& trk : vtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+    const std::uint32_t firstTrk = state.fitTrackOffsets[iVtx];
+    for (std::size_t iTrk = 0; iTrk < vtxInfo.trackLinks.size(); ++iTrk) {
+      const std::size_t entry = firstTrk + iTrk;
+      const InputTrack& trk = vtxInfo.trackLinks[iTrk];
+      TrackAtVertex& trkAtVtx = *state.fitTracksAtVertex[entry];
 
       // Set trackWeight for current track
       trkAtVtx.trackWeight = m_cfg.annealingTool.getWeight(
           state.annealingState, trkAtVtx.vertexCompatibility,
-          collectTrackToVertexCompatibilities(state, trk));
+          collectTrackToVertexCompatibilities(state,
+                                              state.fitTrackIndices[entry]));
 
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Check if track is already linearized and whether we need to
         // relinearize
         if (!trkAtVtx.isLinearized || vtxInfo.relinearize) {
-          auto result = m_cfg.trackLinearizer(
-              m_cfg.extractParameters(trk), vtxInfo.linPoint[3],
-              *vtxPerigeeSurface, vertexingOptions.geoContext,
-              vertexingOptions.magFieldContext, state.fieldCache);
+          auto result = state.linearizationCache.linearizeTrack(
+              m_cfg.trackLinearizer, m_cfg.extractParameters(trk),
+              vtxInfo.linPoint[3], *vtxPerigeeSurface,
+              vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+              state.fieldCache);
           if (!result.ok()) {
             return result.error();
           }
@@ -309,34 +362,27 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
   return {};
 }
 
-std::vector<double>
+const std::vector<double>&
 Acts::AdaptiveMultiVertexFitter::collectTrackToVertexCompatibilities(
-    State& state, const InputTrack& trk) const {
-  // Compatibilities of trk wrt all of its associated vertices
-  std::vector<double> trkToVtxCompatibilities;
-
-  // Range of vertices that are associated with trk. The range is
-  // represented via its bounds: begin refers to the first iterator of the
-  // range; end refers to the iterator after the last iterator of the range.
-  auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-  // Allocate space in memory for the vector of compatibilities
-  trkToVtxCompatibilities.reserve(std::distance(begin, end));
-
-  for (auto it = begin; it != end; ++it) {
-    // it->first corresponds to trk, it->second to one of its associated
-    // vertices
+    State& state, std::uint32_t trkIndex) const {
+  // Compatibilities of the track wrt all of its associated vertices
+  std::vector<double>& trkToVtxCompatibilities = state.fitCompatibilities;
+  trkToVtxCompatibilities.clear();
+
+  for (std::uint32_t link = state.fitTrackLinkOffsets[trkIndex];
+       link < state.fitTrackLinkOffsets[trkIndex + 1]; ++link) {
     trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, it->second))
-            .vertexCompatibility);
+        state.fitTrackLinks[link]->vertexCompatibility);
   }
 
   return trkToVtxCompatibilities;
 }
 
 bool Acts::AdaptiveMultiVertexFitter::checkSmallShift(State& state) const {
-  for (auto* vtx : state.vertexCollection) {
-    Vector3 diff =
-        state.vtxInfoMap[vtx].oldPosition.template head<3>() - vtx->position();
+  for (std::size_t iVtx = 0; iVtx < state.vertexCollection.size(); ++iVtx) {
+    const Vertex* vtx = state.vertexCollection[iVtx];
+    Vector3 diff = state.fitVertexInfos[iVtx]->oldPosition.template head<3>() -
+                   vtx->position();
     const SquareMatrix3& vtxCov = vtx->covariance();
     double relativeShift = diff.dot(vtxCov.inverse() * diff);
     if (relativeShift > m_cfg.maxRelativeShift) {
@@ -347,9 +393,11 @@ bool Acts::AdaptiveMultiVertexFitter::checkSmallShift(State& state) const {
 }
 
 void Acts::AdaptiveMultiVertexFitter::doVertexSmoothing(State& state) const {
-  for (const auto vtx : state.vertexCollection) {
-    for (const auto& trk : state.vtxInfoMap[vtx].trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  for (std::size_t iVtx = 0; iVtx < state.vertexCollection.size(); ++iVtx) {
+    const Vertex* vtx = state.vertexCollection[iVtx];
+    for (std::uint32_t entry = state.fitTrackOffsets[iVtx];
+         entry < state.fitTrackOffsets[iVtx + 1]; ++entry) {
+      TrackAtVertex& trkAtVtx = *state.fitTracksAtVertex[entry];
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Update the new track under the assumption that it originates at the
         // vertex. The second template argument corresponds to the number of
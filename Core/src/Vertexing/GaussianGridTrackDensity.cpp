@@ -24,7 +24,7 @@ Result<float> GaussianGridTrackDensity::getMaxZPosition(
   int zbin = -1;
   if (!m_cfg.useHighestSumZPosition) {
     // Get bin with maximum content
-    mainGrid.maxCoeff(&zbin);
+    zbin = getMaxZBin(mainGrid);
   } else {
     // Get z position with highest density sum
     // of surrounding bins
@@ -94,18 +94,20 @@ GaussianGridTrackDensity::addTrack(const BoundTrackParameters& trk,
 }
 
 void GaussianGridTrackDensity::addTrackGridToMainGrid(
-    int zBin, const TrackGridVector& trkGrid, MainGridVector& mainGrid) const {
+    int zBin, const Eigen::Ref<const TrackGridVector>& trkGrid,
+    MainGridVector& mainGrid) const {
   modifyMainGridWithTrackGrid(zBin, trkGrid, mainGrid, +1);
 }
 
 void GaussianGridTrackDensity::removeTrackGridFromMainGrid(
-    int zBin, const TrackGridVector& trkGrid, MainGridVector& mainGrid) const {
+    int zBin, const Eigen::Ref<const TrackGridVector>& trkGrid,
+    MainGridVector& mainGrid) const {
   modifyMainGridWithTrackGrid(zBin, trkGrid, mainGrid, -1);
 }
 
 void GaussianGridTrackDensity::modifyMainGridWithTrackGrid(
-    int zBin, const TrackGridVector& trkGrid, MainGridVector& mainGrid,
-    int modifyModeSign) const {
+    int zBin, const Eigen::Ref<const TrackGridVector>& trkGrid,
+    MainGridVector& mainGrid, int modifyModeSign) const {
   int width = (m_cfg.trkGridSize - 1) / 2;
   // Overlap left
   int leftOL = zBin - width;
@@ -201,16 +203,13 @@ int GaussianGridTrackDensity::getHighestSumZPosition(
   // one has the highest surrounding density sum (the two neighboring bins)
 
   // The global maximum
-  int zbin = -1;
-  mainGrid.maxCoeff(&zbin);
-  int zFirstMax = zbin;
+  int zFirstMax = getMaxZBin(mainGrid);
   double firstDensity = mainGrid(zFirstMax);
   double firstSum = getDensitySum(mainGrid, zFirstMax);
 
   // Get the second highest maximum
   mainGrid[zFirstMax] = 0;
-  mainGrid.maxCoeff(&zbin);
-  int zSecondMax = zbin;
+  int zSecondMax = getMaxZBin(mainGrid);
   double secondDensity = mainGrid(zSecondMax);
   double secondSum = 0;
   if (firstDensity - secondDensity <
@@ -220,8 +219,7 @@ int GaussianGridTrackDensity::getHighestSumZPosition(
 
   // Get the third highest maximum
   mainGrid[zSecondMax] = 0;
-  mainGrid.maxCoeff(&zbin);
-  int zThirdMax = zbin;
+  int zThirdMax = getMaxZBin(mainGrid);
   double thirdDensity = mainGrid(zThirdMax);
   double thirdSum = 0;
   if (firstDensity - thirdDensity <
@@ -243,6 +241,24 @@ int GaussianGridTrackDensity::getHighestSumZPosition(
   return zFirstMax;
 }
 
+int GaussianGridTrackDensity::getMaxZBin(const MainGridVector& mainGrid) {
+  // The reduction without index is vectorized by Eigen, the index search
+  // afterwards stops at the first bin holding the maximum, which is the
+  // same bin that maxCoeff(&index) would return
+  const float maxValue = mainGrid.maxCoeff();
+  const float* begin = mainGrid.data();
+  const float* end = begin + mainGrid.size();
+  const float* it = std::find(begin, end, maxValue);
+  if (it == end) {
+    // The maximum is not found if it is NaN, fall back to the indexed
+    // reduction which always returns a valid bin
+    Eigen::Index index = 0;
+    mainGrid.maxCoeff(&index);
+    return static_cast<int>(index);
+  }
+  return static_cast<int>(it - begin);
+}
+
 double GaussianGridTrackDensity::getDensitySum(const MainGridVector& mainGrid,
                                                int pos) const {
   double sum = mainGrid(pos);
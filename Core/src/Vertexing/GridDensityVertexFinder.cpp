@@ -21,14 +21,14 @@ auto GridDensityVertexFinder::find(const std::vector<InputTrack>& trackVector,
     // Bool to check if removable tracks, that pass selection, still exist
     bool couldRemoveTracks = false;
     for (auto trk : state.tracksToRemove) {
-      if (!state.trackSelectionMap.at(trk)) {
+      const std::uint32_t iTrk = state.trackIndices.at(trk);
+      if (state.trackPassedSelection[iTrk] == 0) {
         // Track was never added to grid, so cannot remove it
         continue;
       }
       couldRemoveTracks = true;
-      auto binAndTrackGrid = state.binAndTrackGridMap.at(trk);
       m_cfg.gridDensity.removeTrackGridFromMainGrid(
-          binAndTrackGrid.first, binAndTrackGrid.second, state.mainGrid);
+          state.trackZBins[iTrk], state.trackGrids.col(iTrk), state.mainGrid);
     }
     if (!couldRemoveTracks) {
       // No tracks were removed anymore
@@ -39,13 +39,31 @@ auto GridDensityVertexFinder::find(const std::vector<InputTrack>& trackVector,
   } else {
     state.mainGrid =
         MainGridVector::Zero(m_cfg.gridDensity.config().mainGridSize);
+    if (m_cfg.cacheGridStateForTrackRemoval) {
+      const std::size_t nTracks = trackVector.size();
+      state.trackIndices.clear();
+      state.trackIndices.reserve(nTracks);
+      state.trackZBins.assign(nTracks, -1);
+      state.trackPassedSelection.assign(nTracks, 0);
+      state.trackGrids.setZero(m_cfg.gridDensity.config().trkGridSize,
+                               static_cast<Eigen::Index>(nTracks));
+    }
     // Fill with track densities
     for (auto trk : trackVector) {
       const BoundTrackParameters& trkParams = m_cfg.extractParameters(trk);
+      std::uint32_t iTrk = 0;
+      if (m_cfg.cacheGridStateForTrackRemoval) {
+        // Tracks appearing more than once share the index of their first
+        // occurrence, the last occurrence determines the cached content
+        iTrk = state.trackIndices
+                   .try_emplace(trk, static_cast<std::uint32_t>(
+                                         state.trackIndices.size()))
+                   .first->second;
+      }
       // Take only tracks that fulfill selection criteria
       if (!doesPassTrackSelection(trkParams)) {
         if (m_cfg.cacheGridStateForTrackRemoval) {
-          state.trackSelectionMap[trk] = false;
+          state.trackPassedSelection[iTrk] = 0;
         }
         continue;
       }
@@ -53,8 +71,9 @@ auto GridDensityVertexFinder::find(const std::vector<InputTrack>& trackVector,
           m_cfg.gridDensity.addTrack(trkParams, state.mainGrid);
       // Cache track density contribution to main grid if enabled
       if (m_cfg.cacheGridStateForTrackRemoval) {
-        state.binAndTrackGridMap[trk] = binAndTrackGrid;
-        state.trackSelectionMap[trk] = true;
+        state.trackZBins[iTrk] = binAndTrackGrid.first;
+        state.trackGrids.col(iTrk) = binAndTrackGrid.second;
+        state.trackPassedSelection[iTrk] = 1;
       }
     }
     state.isInitialized = true;
@@ -239,10 +239,10 @@ Acts::Result<double> Acts::IterativeVertexFinder::getCompatibility(
     const Surface& perigeeSurface, const VertexingOptions& vertexingOptions,
     State& state) const {
   // Linearize track
-  auto result =
-      m_cfg.trackLinearizer(params, vertex.fullPosition()[3], perigeeSurface,
-                            vertexingOptions.geoContext,
-                            vertexingOptions.magFieldContext, state.fieldCache);
+  auto result = state.linearizationCache.linearizeTrack(
+      m_cfg.trackLinearizer, params, vertex.fullPosition()[3], perigeeSurface,
+      vertexingOptions.geoContext, vertexingOptions.magFieldContext,
+      state.fieldCache);
   if (!result.ok()) {
     return result.error();
   }
@@ -0,0 +1,136 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Vertexing/TrackLinearizationCache.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cmath>
+
+#include <boost/functional/hash.hpp>
+
+namespace Acts {
+
+TrackLinearizationCache::TrackLinearizationCache()
+    : TrackLinearizationCache(Config{}) {}
+
+TrackLinearizationCache::TrackLinearizationCache(const Config& cfg)
+    : m_cfg(cfg) {}
+
+std::size_t TrackLinearizationCache::hash(const BoundTrackParameters& params) {
+  std::size_t seed = 0;
+  boost::hash_range(seed, params.parameters().data(),
+                    params.parameters().data() + eBoundSize);
+  boost::hash_combine(seed, &params.referenceSurface());
+  return seed;
+}
+
+template <typename value_t>
+const value_t* TrackLinearizationCache::find(
+    const EntryMap<value_t>& entries, std::size_t key,
+    const BoundTrackParameters& params, const Vector4& point) const {
+  auto it = entries.find(key);
+  if (it == entries.end()) {
+    return nullptr;
+  }
+  for (const Entry<value_t>& entry : it->second) {
+    if (entry.referenceSurface.get() != &params.referenceSurface() ||
+        entry.parameters != params.parameters()) {
+      continue;
+    }
+    if ((entry.point.template head<3>() - point.template head<3>()).norm() <=
+            m_cfg.positionTolerance &&
+        std::abs(entry.point[3] - point[3]) <= m_cfg.timeTolerance) {
+      return &entry.value;
+    }
+  }
+  return nullptr;
+}
+
+Result<LinearizedTrack> TrackLinearizationCache::linearizeTrack(
+    const TrackLinearizer& linearizer, const BoundTrackParameters& params,
+    double linPointTime, const Surface& perigeeSurface,
+    const GeometryContext& gctx, const MagneticFieldContext& mctx,
+    MagneticFieldProvider::Cache& fieldCache) {
+  Vector4 linPoint;
+  linPoint << perigeeSurface.center(gctx), linPointTime;
+
+  const std::size_t key = hash(params);
+  if (const LinearizedTrack* cached =
+          find(m_linearizations, key, params, linPoint);
+      cached != nullptr) {
+    ++m_nHits;
+    return *cached;
+  }
+
+  ++m_nMisses;
+  auto result = linearizer(params, linPointTime, perigeeSurface, gctx, mctx,
+                           fieldCache);
+  if (!result.ok()) {
+    // Failures are not cached
+    return result;
+  }
+  m_linearizations[key].push_back(
+      {params.parameters(), params.referenceSurface().getSharedPtr(),
+       linPoint, *result});
+  return result;
+}
+
+std::vector<Result<LinearizedTrack>> TrackLinearizationCache::linearizeTracks(
+    const TrackLinearizer& linearizer,
+    std::span<const BoundTrackParameters> params, double linPointTime,
+    const Surface& perigeeSurface, const GeometryContext& gctx,
+    const MagneticFieldContext& mctx,
+    MagneticFieldProvider::Cache& fieldCache) {
+  std::vector<Result<LinearizedTrack>> linTracks;
+  linTracks.reserve(params.size());
+  for (const BoundTrackParameters& trkParams : params) {
+    linTracks.push_back(linearizeTrack(linearizer, trkParams, linPointTime,
+                                       perigeeSurface, gctx, mctx,
+                                       fieldCache));
+  }
+  return linTracks;
+}
+
+Result<BoundTrackParameters>
+TrackLinearizationCache::estimate3DImpactParameters(
+    const ImpactPointEstimator& ipEstimator, const GeometryContext& gctx,
+    const MagneticFieldContext& mctx, const BoundTrackParameters& params,
+    const Vector3& vtxPos, ImpactPointEstimator::State& ipState) {
+  Vector4 point;
+  point << vtxPos, 0.;
+
+  const std::size_t key = hash(params);
+  if (const BoundTrackParameters* cached =
+          find(m_impactParameters, key, params, point);
+      cached != nullptr) {
+    ++m_nHits;
+    return *cached;
+  }
+
+  ++m_nMisses;
+  auto result = ipEstimator.estimate3DImpactParameters(gctx, mctx, params,
+                                                       vtxPos, ipState);
+  if (!result.ok()) {
+    // Failures are not cached
+    return result;
+  }
+  m_impactParameters[key].push_back(
+      {params.parameters(), params.referenceSurface().getSharedPtr(), point,
+       *result});
+  return result;
+}
+
+void TrackLinearizationCache::clear() {
+  m_linearizations.clear();
+  m_impactParameters.clear();
+  m_nHits = 0;
+  m_nMisses = 0;
+}
+
+}  // namespace Acts
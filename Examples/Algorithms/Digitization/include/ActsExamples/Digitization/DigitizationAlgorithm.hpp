@@ -20,12 +20,15 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/Digitization/Channelizer.hpp"
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 #include "ActsFatras/Digitization/UncorrelatedHitSmearer.hpp"
 
 #include <cstddef>
+#include <set>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -82,6 +85,18 @@ class DigitizationAlgorithm final : public IAlgorithm {
     /// Minimum number of attempts to derive a valid dgitized measurement when
     /// random numbers are involved.
     std::size_t minMaxRetries = 10;
+
+    /// Digitize the modules of one event in parallel.
+    ///
+    /// Every module uses a random number generator seeded from the event seed
+    /// and the module identifier, and the outputs are stored in module order.
+    /// The output is thus independent of the number of threads.
+    ///
+    /// @note The output is not the same as in the sequential mode, which draws
+    ///       all random numbers of an event from a single generator. The
+    ///       smeared parameters, and with them the written files, change when
+    ///       switching modes.
+    bool parallelizeOverModules = false;
   };
 
   /// Construct the smearing algorithm.
@@ -113,11 +128,17 @@ class DigitizationAlgorithm final : public IAlgorithm {
       const std::vector<ActsFatras::Segmentizer::ChannelSegment>& channels,
       RandomEngine& rng) const;
 
+  /// Digitized parameters of a module with the contributing simulated hits
+  using ModuleDigitization = std::vector<
+      std::pair<DigitizedParameters, std::set<SimHitContainer::size_type>>>;
+
   /// Nested smearer struct that holds geometric digitizer and smearing
   /// Support up to 4 dimensions.
   template <std::size_t kSmearDIM>
   struct CombinedDigitizer {
     GeometricConfig geometric;
+    /// Precomputed segmentation, shared by all modules of this digitizer
+    ActsFatras::Segmentizer::SegmentationLookup segmentationLookup;
     ActsFatras::BoundParametersSmearer<RandomEngine, kSmearDIM> smearing;
   };
 
@@ -136,6 +157,23 @@ class DigitizationAlgorithm final : public IAlgorithm {
   using CellsMap =
       std::map<Acts::GeometryIdentifier, std::vector<Cluster::Cell>>;
 
+  /// Digitize the simulated hits of a single module.
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @param simHits are all simulated hits of the event
+  /// @param moduleSimHits are the simulated hits on the module
+  /// @param surface is the module surface
+  /// @param digitizer is the digitizer of the module
+  /// @param rng is the random number generator
+  /// @param skippedHits is incremented for every hit that failed smearing
+  ///
+  /// @return the digitized parameters of the module
+  ModuleDigitization digitizeModule(
+      const AlgorithmContext& ctx, const SimHitContainer& simHits,
+      const Range<SimHitContainer::const_iterator>& moduleSimHits,
+      const Acts::Surface& surface, const Digitizer& digitizer,
+      RandomEngine& rng, std::size_t& skippedHits) const;
+
   ReadDataHandle<SimHitContainer> m_inputHits{this, "InputHits"};
 
   WriteDataHandle<MeasurementContainer> m_outputMeasurements{
@@ -165,6 +203,8 @@ class DigitizationAlgorithm final : public IAlgorithm {
     CombinedDigitizer<kSmearDIM> impl;
     // Copy the geometric configuration
     impl.geometric = cfg.geometricDigiConfig;
+    impl.segmentationLookup = ActsFatras::Segmentizer::SegmentationLookup(
+        impl.geometric.segmentation);
     // Prepare the smearing configuration
     for (std::size_t i = 0; i < kSmearDIM; ++i) {
       impl.smearing.indices[i] = cfg.smearingDigiConfig.params.at(i).index;
@@ -25,6 +25,9 @@
 #include <string>
 #include <utility>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace ActsExamples {
 
 DigitizationAlgorithm::DigitizationAlgorithm(Config config,
@@ -155,9 +158,6 @@ ProcessCode DigitizationAlgorithm::execute(const AlgorithmContext& ctx) const {
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
   // Some statistics
   std::size_t skippedHits = 0;
 
@@ -165,12 +165,53 @@ ProcessCode DigitizationAlgorithm::execute(const AlgorithmContext& ctx) const {
   // Thus we need to store the cell data from the simulation.
   CellsMap cellsMap;
 
+  // Store the digitized parameters of a module in the output containers
+  auto storeModule = [&](Acts::GeometryIdentifier moduleGeoId,
+                         ModuleDigitization& digitizeParametersResult) {
+    // Store the cell data into a map.
+    if (m_cfg.doOutputCells) {
+      std::vector<Cluster::Cell> cells;
+      for (const auto& [dParameters, simHitsIdxs] : digitizeParametersResult) {
+        for (const auto& cell : dParameters.cluster.channels) {
+          cells.push_back(cell);
+        }
+      }
+      cellsMap.insert({moduleGeoId, std::move(cells)});
+    }
+
+    if (m_cfg.doClusterization) {
+      for (auto& [dParameters, simHitsIdxs] : digitizeParametersResult) {
+        auto measurement =
+            createMeasurement(measurements, moduleGeoId, dParameters);
+        clusters.emplace_back(std::move(dParameters.cluster));
+
+        for (auto [i, simHitIdx] : Acts::enumerate(simHitsIdxs)) {
+          measurementParticlesMap.emplace_hint(
+              measurementParticlesMap.end(), measurement.index(),
+              simHits.nth(simHitIdx)->particleId());
+          measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
+                                             measurement.index(), simHitIdx);
+        }
+      }
+    }
+  };
+
+  // A module with hits that should be digitized
+  struct ModuleTask {
+    Acts::GeometryIdentifier geoId;
+    Range<SimHitContainer::const_iterator> simHits;
+    const Acts::Surface* surface = nullptr;
+    const Digitizer* digitizer = nullptr;
+    ModuleDigitization result;
+    std::size_t skippedHits = 0;
+  };
+  std::vector<ModuleTask> moduleTasks;
+
+  // Setup random number generator
+  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+
   ACTS_DEBUG("Starting loop over modules ...");
   for (const auto& simHitsGroup : groupByModule(simHits)) {
-    // Manual pair unpacking instead of using
-    //   auto [moduleGeoId, moduleSimHits] : ...
-    // otherwise clang on macos complains that it is unable to capture the local
-    // binding in the lambda used for visiting the smearer below.
     Acts::GeometryIdentifier moduleGeoId = simHitsGroup.first;
     const auto& moduleSimHits = simHitsGroup.second;
 
@@ -194,110 +235,53 @@ ProcessCode DigitizationAlgorithm::execute(const AlgorithmContext& ctx) const {
       ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
     }
 
-    // Run the digitizer. Iterate over the hits for this surface inside the
-    // visitor so we do not need to lookup the variant object per-hit.
-    std::visit(
-        [&](const auto& digitizer) {
-          ModuleClusters moduleClusters(
-              digitizer.geometric.segmentation, digitizer.geometric.indices,
-              m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
-
-          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
-            const auto& simHit = *h;
-            const auto simHitIdx = simHits.index_of(h);
-
-            DigitizedParameters dParameters;
-
-            if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
-              ACTS_VERBOSE("Skip hit because energy deposit to small");
-              continue;
-            }
-
-            // Geometric part - 0, 1, 2 local parameters are possible
-            if (!digitizer.geometric.indices.empty()) {
-              ACTS_VERBOSE("Configured to geometric digitize "
-                           << digitizer.geometric.indices.size()
-                           << " parameters.");
-              const auto& cfg = digitizer.geometric;
-              Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
-              auto channelsRes = m_channelizer.channelize(
-                  simHit, *surfacePtr, ctx.geoContext, driftDir,
-                  cfg.segmentation, cfg.thickness);
-              if (!channelsRes.ok() || channelsRes->empty()) {
-                ACTS_DEBUG(
-                    "Geometric channelization did not work, skipping this "
-                    "hit.");
-                continue;
-              }
-              ACTS_VERBOSE("Activated " << channelsRes->size()
-                                        << " channels for this hit.");
-              dParameters =
-                  localParameters(digitizer.geometric, *channelsRes, rng);
-            }
-
-            // Smearing part - (optionally) rest
-            if (!digitizer.smearing.indices.empty()) {
-              ACTS_VERBOSE("Configured to smear "
-                           << digitizer.smearing.indices.size()
-                           << " parameters.");
-              auto res =
-                  digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
-              if (!res.ok()) {
-                ++skippedHits;
-                ACTS_DEBUG("Problem in hit smearing, skip hit ("
-                           << res.error().message() << ")");
-                continue;
-              }
-              const auto& [par, cov] = res.value();
-              for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
-                dParameters.indices.push_back(digitizer.smearing.indices[ip]);
-                dParameters.values.push_back(par[ip]);
-                dParameters.variances.push_back(cov(ip, ip));
-              }
-            }
-
-            // Check on success - threshold could have eliminated all channels
-            if (dParameters.values.empty()) {
-              ACTS_VERBOSE(
-                  "Parameter digitization did not yield a measurement.");
-              continue;
-            }
-
-            moduleClusters.add(std::move(dParameters), simHitIdx);
-          }
-
-          auto digitizeParametersResult = moduleClusters.digitizedParameters();
+    if (m_cfg.parallelizeOverModules) {
+      // Modules are digitized after all of them have been collected
+      moduleTasks.push_back(
+          {moduleGeoId, moduleSimHits, surfacePtr, &(*digitizerItr), {}, 0});
+      continue;
+    }
 
-          // Store the cell data into a map.
-          if (m_cfg.doOutputCells) {
-            std::vector<Cluster::Cell> cells;
-            for (const auto& [dParameters, simHitsIdxs] :
-                 digitizeParametersResult) {
-              for (const auto& cell : dParameters.cluster.channels) {
-                cells.push_back(cell);
-              }
-            }
-            cellsMap.insert({moduleGeoId, std::move(cells)});
-          }
+    ModuleDigitization digitizeParametersResult =
+        digitizeModule(ctx, simHits, moduleSimHits, *surfacePtr, *digitizerItr,
+                       rng, skippedHits);
+    storeModule(moduleGeoId, digitizeParametersResult);
+  }
 
-          if (m_cfg.doClusterization) {
-            for (auto& [dParameters, simHitsIdxs] : digitizeParametersResult) {
-              auto measurement =
-                  createMeasurement(measurements, moduleGeoId, dParameters);
-              clusters.emplace_back(std::move(dParameters.cluster));
-
-              for (auto [i, simHitIdx] : Acts::enumerate(simHitsIdxs)) {
-                measurementParticlesMap.emplace_hint(
-                    measurementParticlesMap.end(), measurement.index(),
-                    simHits.nth(simHitIdx)->particleId());
-                measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
-                                                   measurement.index(),
-                                                   simHitIdx);
-              }
-            }
+  if (m_cfg.parallelizeOverModules) {
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, moduleTasks.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            ModuleTask& task = moduleTasks[i];
+            RandomEngine moduleRng = m_cfg.randomNumbers->spawnGenerator(
+                ctx, name(), task.geoId.value());
+            task.result =
+                digitizeModule(ctx, simHits, task.simHits, *task.surface,
+                               *task.digitizer, moduleRng, task.skippedHits);
           }
-        },
-        *digitizerItr);
+        });
+
+    // Count the outputs to allocate the output containers only once
+    std::size_t nMeasurements = 0;
+    std::size_t nSimHitLinks = 0;
+    for (const ModuleTask& task : moduleTasks) {
+      nMeasurements += task.result.size();
+      for (const auto& [dParameters, simHitsIdxs] : task.result) {
+        nSimHitLinks += simHitsIdxs.size();
+      }
+    }
+    measurements.reserve(nMeasurements);
+    clusters.reserve(nMeasurements);
+    measurementParticlesMap.reserve(nSimHitLinks);
+    measurementSimHitsMap.reserve(nSimHitLinks);
+
+    // Store in module order which is the order of the sequential mode
+    for (ModuleTask& task : moduleTasks) {
+      skippedHits += task.skippedHits;
+      storeModule(task.geoId, task.result);
+      task.result.clear();
+    }
   }
 
   if (skippedHits > 0) {
@@ -327,6 +311,89 @@ ProcessCode DigitizationAlgorithm::execute(const AlgorithmContext& ctx) const {
   return ProcessCode::SUCCESS;
 }
 
+DigitizationAlgorithm::ModuleDigitization DigitizationAlgorithm::digitizeModule(
+    const AlgorithmContext& ctx, const SimHitContainer& simHits,
+    const Range<SimHitContainer::const_iterator>& moduleSimHits,
+    const Acts::Surface& surface, const Digitizer& digitizer, RandomEngine& rng,
+    std::size_t& skippedHits) const {
+  // Run the digitizer. Iterate over the hits for this surface inside the
+  // visitor so we do not need to lookup the variant object per-hit.
+  return std::visit(
+      [&](const auto& concreteDigitizer) {
+        ModuleClusters moduleClusters(
+            concreteDigitizer.geometric.segmentation,
+            concreteDigitizer.geometric.indices, m_cfg.doMerge,
+            m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
+
+        for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
+          const auto& simHit = *h;
+          const auto simHitIdx = simHits.index_of(h);
+
+          DigitizedParameters dParameters;
+
+          if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
+            ACTS_VERBOSE("Skip hit because energy deposit to small");
+            continue;
+          }
+
+          // Geometric part - 0, 1, 2 local parameters are possible
+          if (!concreteDigitizer.geometric.indices.empty()) {
+            ACTS_VERBOSE("Configured to geometric digitize "
+                         << concreteDigitizer.geometric.indices.size()
+                         << " parameters.");
+            const auto& cfg = concreteDigitizer.geometric;
+            Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
+            auto channelsRes = m_channelizer.channelize(
+                simHit, surface, ctx.geoContext, driftDir,
+                concreteDigitizer.segmentationLookup, cfg.thickness);
+            if (!channelsRes.ok() || channelsRes->empty()) {
+              ACTS_DEBUG(
+                  "Geometric channelization did not work, skipping this "
+                  "hit.");
+              continue;
+            }
+            ACTS_VERBOSE("Activated " << channelsRes->size()
+                                      << " channels for this hit.");
+            dParameters =
+                localParameters(concreteDigitizer.geometric, *channelsRes, rng);
+          }
+
+          // Smearing part - (optionally) rest
+          if (!concreteDigitizer.smearing.indices.empty()) {
+            ACTS_VERBOSE("Configured to smear "
+                         << concreteDigitizer.smearing.indices.size()
+                         << " parameters.");
+            auto res = concreteDigitizer.smearing(rng, simHit, surface,
+                                                  ctx.geoContext);
+            if (!res.ok()) {
+              ++skippedHits;
+              ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                         << res.error().message() << ")");
+              continue;
+            }
+            const auto& [par, cov] = res.value();
+            for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+              dParameters.indices.push_back(
+                  concreteDigitizer.smearing.indices[ip]);
+              dParameters.values.push_back(par[ip]);
+              dParameters.variances.push_back(cov(ip, ip));
+            }
+          }
+
+          // Check on success - threshold could have eliminated all channels
+          if (dParameters.values.empty()) {
+            ACTS_VERBOSE("Parameter digitization did not yield a measurement.");
+            continue;
+          }
+
+          moduleClusters.add(std::move(dParameters), simHitIdx);
+        }
+
+        return moduleClusters.digitizedParameters();
+      },
+      digitizer);
+}
+
 DigitizedParameters DigitizationAlgorithm::localParameters(
     const GeometricConfig& geoCfg,
     const std::vector<ActsFatras::Segmentizer::ChannelSegment>& channels,
@@ -78,6 +78,15 @@ class FatrasSimulation final : public IAlgorithm {
     /// Absolute maximum path length
     double pathLimit = 30 * Acts::UnitConstants::m;
 
+    /// Simulate the input particles of one event in parallel.
+    ///
+    /// Every input particle and its secondaries are simulated as an
+    /// independent task with a random number generator seeded from the event
+    /// seed and the particle id. The output is thus independent of the number
+    /// of threads, but differs from the sequential simulation which uses a
+    /// single generator for the whole event.
+    bool parallelizeOverParticles = false;
+
     /// Expected average number of hits generated per particle.
     ///
     /// This is just a performance optimization hint and has no impact on the
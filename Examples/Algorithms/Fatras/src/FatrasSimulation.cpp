@@ -22,24 +22,31 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Kernel/InteractionList.hpp"
 #include "ActsFatras/Kernel/Simulation.hpp"
 #include "ActsFatras/Physics/Decay/NoDecay.hpp"
 #include "ActsFatras/Physics/ElectroMagnetic/PhotonConversion.hpp"
+#include "ActsFatras/Physics/FusedElectroMagneticInteractions.hpp"
 #include "ActsFatras/Physics/StandardInteractions.hpp"
 #include "ActsFatras/Selectors/SelectorHelpers.hpp"
 #include "ActsFatras/Selectors/SurfaceSelectors.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <ostream>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/version.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 namespace {
 
@@ -71,6 +78,12 @@ struct ActsExamples::detail::FatrasSimulation {
       ActsExamples::RandomEngine &, const std::vector<ActsFatras::Particle> &,
       std::vector<ActsFatras::Particle> &, std::vector<ActsFatras::Particle> &,
       std::vector<ActsFatras::Hit> &) const = 0;
+  virtual Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &, const Acts::MagneticFieldContext &,
+      ActsExamples::RandomEngine &, const ActsFatras::Particle &,
+      std::vector<ActsFatras::Particle> &, std::vector<ActsFatras::Particle> &,
+      std::vector<ActsFatras::Hit> &,
+      std::vector<ActsFatras::FailedParticle> &) const = 0;
 };
 
 namespace {
@@ -78,7 +91,10 @@ namespace {
 // Magnetic-field specific PIMPL implementation.
 //
 // This always uses the SympyStepper for charged particle propagation and is
-// thus limited to propagation in vacuum at the moment.
+// thus limited to propagation in vacuum at the moment. The charged
+// interactions are either the configurable standard list or the equivalent
+// fused kernel with all processes enabled.
+template <typename charged_interactions_t>
 struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
   using CutPMin = ActsFatras::Min<ActsFatras::Casts::P>;
 
@@ -86,11 +102,11 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
   // propagate charged particles numerically in the given magnetic field
   using ChargedStepper = Acts::SympyStepper;
   using ChargedPropagator = Acts::Propagator<ChargedStepper, Acts::Navigator>;
-  // charged particles w/ standard em physics list and selectable hits
+  // charged particles w/ standard em physics and selectable hits
   using ChargedSelector = CutPMin;
   using ChargedSimulation = ActsFatras::SingleParticleSimulation<
-      ChargedPropagator, ActsFatras::StandardChargedElectroMagneticInteractions,
-      HitSurfaceSelector, ActsFatras::NoDecay>;
+      ChargedPropagator, charged_interactions_t, HitSurfaceSelector,
+      ActsFatras::NoDecay>;
 
   // typedefs for neutral particle simulation
   // propagate neutral particles with just straight lines
@@ -134,18 +150,26 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
     // minimal p cut on input particles and as is-alive check for interactions
     simulation.selectCharged.valMin = cfg.pMin;
     simulation.selectNeutral.valMin = cfg.pMin;
-    simulation.charged.interactions =
-        makeStandardChargedElectroMagneticInteractions(cfg.pMin);
-
-    // processes are enabled by default
-    if (!cfg.emScattering) {
-      simulation.charged.interactions.template disable<StandardScattering>();
-    }
-    if (!cfg.emEnergyLossIonisation) {
-      simulation.charged.interactions.template disable<StandardBetheBloch>();
-    }
-    if (!cfg.emEnergyLossRadiation) {
-      simulation.charged.interactions.template disable<StandardBetheHeitler>();
+    if constexpr (std::is_same_v<
+                      charged_interactions_t,
+                      StandardChargedElectroMagneticInteractions>) {
+      simulation.charged.interactions =
+          makeStandardChargedElectroMagneticInteractions(cfg.pMin);
+
+      // processes are enabled by default
+      if (!cfg.emScattering) {
+        simulation.charged.interactions.template disable<StandardScattering>();
+      }
+      if (!cfg.emEnergyLossIonisation) {
+        simulation.charged.interactions.template disable<StandardBetheBloch>();
+      }
+      if (!cfg.emEnergyLossRadiation) {
+        simulation.charged.interactions
+            .template disable<StandardBetheHeitler>();
+      }
+    } else {
+      simulation.charged.interactions =
+          makeFusedChargedElectroMagneticInteractions(cfg.pMin);
     }
     if (!cfg.emPhotonConversion) {
       simulation.neutral.interactions.template disable<PhotonConversion>();
@@ -174,8 +198,78 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
                                simulatedParticlesInitial,
                                simulatedParticlesFinal, simHits);
   }
+
+  Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, ActsExamples::RandomEngine &rng,
+      const ActsFatras::Particle &inputParticle,
+      std::vector<ActsFatras::Particle> &simulatedParticlesInitial,
+      std::vector<ActsFatras::Particle> &simulatedParticlesFinal,
+      std::vector<ActsFatras::Hit> &simHits,
+      std::vector<ActsFatras::FailedParticle> &failedParticles) const final {
+    return simulation.simulateParticle(
+        geoCtx, magCtx, rng, inputParticle, simulatedParticlesInitial,
+        simulatedParticlesFinal, simHits, failedParticles);
+  }
 };
 
+/// Simulate all input particles of one event as independent tasks.
+///
+/// Every input particle gets its own generator and output buffers. The
+/// buffers are merged in input order afterwards which makes the output
+/// independent of the number of threads and the task scheduling.
+Acts::Result<std::vector<ActsFatras::FailedParticle>> simulateParallel(
+    const ActsExamples::detail::FatrasSimulation &sim,
+    const ActsExamples::AlgorithmContext &ctx,
+    const ActsExamples::RandomNumbers &randomNumbers, std::string_view caller,
+    const std::vector<ActsFatras::Particle> &inputParticles,
+    std::vector<ActsFatras::Particle> &simulatedParticlesInitial,
+    std::vector<ActsFatras::Particle> &simulatedParticlesFinal,
+    std::vector<ActsFatras::Hit> &simHits) {
+  struct Buffers {
+    std::vector<ActsFatras::Particle> particlesInitial;
+    std::vector<ActsFatras::Particle> particlesFinal;
+    std::vector<ActsFatras::Hit> hits;
+    std::vector<ActsFatras::FailedParticle> failedParticles;
+    std::error_code error;
+  };
+  std::vector<Buffers> buffers(inputParticles.size());
+
+  tbb::parallel_for(
+      tbb::blocked_range<std::size_t>(0, inputParticles.size()),
+      [&](const tbb::blocked_range<std::size_t> &range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          const ActsFatras::Particle &inputParticle = inputParticles[i];
+          Buffers &local = buffers[i];
+          ActsExamples::RandomEngine rng = randomNumbers.spawnGenerator(
+              ctx, caller, inputParticle.particleId().value());
+          auto result = sim.simulateParticle(
+              ctx.geoContext, ctx.magFieldContext, rng, inputParticle,
+              local.particlesInitial, local.particlesFinal, local.hits,
+              local.failedParticles);
+          if (!result.ok()) {
+            local.error = result.error();
+          }
+        }
+      });
+
+  std::vector<ActsFatras::FailedParticle> failedParticles;
+  for (Buffers &local : buffers) {
+    if (local.error) {
+      return local.error;
+    }
+    std::ranges::move(local.particlesInitial,
+                      std::back_inserter(simulatedParticlesInitial));
+    std::ranges::move(local.particlesFinal,
+                      std::back_inserter(simulatedParticlesFinal));
+    std::ranges::move(local.hits, std::back_inserter(simHits));
+    std::ranges::move(local.failedParticles,
+                      std::back_inserter(failedParticles));
+    local = Buffers{};
+  }
+  return failedParticles;
+}
+
 }  // namespace
 
 ActsExamples::FatrasSimulation::FatrasSimulation(Config cfg,
@@ -201,7 +295,16 @@ ActsExamples::FatrasSimulation::FatrasSimulation(Config cfg,
   }
 
   // construct the simulation for the specific magnetic field
-  m_sim = std::make_unique<FatrasSimulationT>(m_cfg, lvl);
+  // the fused kernel is equivalent to the standard list, but only supports the
+  // complete set of charged processes
+  if (m_cfg.emScattering && m_cfg.emEnergyLossIonisation &&
+      m_cfg.emEnergyLossRadiation) {
+    m_sim = std::make_unique<FatrasSimulationT<
+        ActsFatras::FusedChargedElectroMagneticInteractions<>>>(m_cfg, lvl);
+  } else {
+    m_sim = std::make_unique<FatrasSimulationT<
+        ActsFatras::StandardChargedElectroMagneticInteractions>>(m_cfg, lvl);
+  }
 
   m_inputParticles.initialize(m_cfg.inputParticles);
   m_outputParticles.initialize(m_cfg.outputParticles);
@@ -235,11 +338,19 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             particlesInput, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> ret{
+      std::vector<ActsFatras::FailedParticle>{}};
+  if (!m_cfg.parallelizeOverParticles) {
+    // run the simulation w/ a local random generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                          particlesInput, particlesInitialUnordered,
+                          particlesFinalUnordered, simHitsUnordered);
+  } else {
+    ret = simulateParallel(*m_sim, ctx, *m_cfg.randomNumbers, name(),
+                           particlesInput, particlesInitialUnordered,
+                           particlesFinalUnordered, simHitsUnordered);
+  }
   // fatal error leads to panic
   if (!ret.ok()) {
     ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
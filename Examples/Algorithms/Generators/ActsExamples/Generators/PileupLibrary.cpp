@@ -0,0 +1,136 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Generators/PileupLibrary.hpp"
+
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/container/container_fwd.hpp>
+
+namespace ActsExamples {
+
+PileupLibrary::PileupLibrary(const HepMC3IndexedReader& reader,
+                             std::size_t nEvents) {
+  nEvents = std::min(nEvents, reader.availableEvents().second);
+  for (std::size_t event = 0; event < nEvents; ++event) {
+    auto [particles, vertices] = reader.readEvent(event);
+    add(particles, vertices);
+  }
+}
+
+void PileupLibrary::add(const SimParticleContainer& particles,
+                        const SimVertexContainer& vertices) {
+  for (const auto& [primaryId, group] : groupByPrimaryVertex(particles)) {
+    SimBarcode::Value vertexPrimary = primaryId.vertexPrimary();
+    SimVertexBarcode primaryVertexId =
+        SimVertexBarcode{}.setVertexPrimary(vertexPrimary);
+
+    // Vertices of the same primary vertex are contiguous
+    auto vertexBegin = vertices.lower_bound(primaryVertexId);
+    auto vertexEnd = vertices.lower_bound(
+        SimVertexBarcode{}.setVertexPrimary(vertexPrimary + 1));
+
+    Acts::Vector4 origin = group.begin()->fourPosition();
+    if (vertexBegin != vertexEnd &&
+        vertexBegin->vertexId() == primaryVertexId) {
+      origin = vertexBegin->position4;
+    }
+
+    for (const SimParticle& particle : group) {
+      Particle& stored = m_particles.emplace_back();
+      stored.particleId = SimBarcode(particle.particleId()).setVertexPrimary(0);
+      stored.pdg = particle.pdg();
+      stored.charge = particle.charge();
+      stored.mass = particle.mass();
+      stored.position4 = particle.fourPosition() - origin;
+      stored.direction = particle.direction();
+      stored.absoluteMomentum = particle.absoluteMomentum();
+    }
+    for (auto it = vertexBegin; it != vertexEnd; ++it) {
+      Vertex& stored = m_vertices.emplace_back();
+      stored.id = SimVertexBarcode(it->vertexId()).setVertexPrimary(0);
+      stored.process = it->process;
+      stored.position4 = it->position4 - origin;
+      stored.nIncoming = it->incoming.size();
+      stored.nOutgoing = it->outgoing.size();
+      for (const auto* links : {&it->incoming, &it->outgoing}) {
+        for (SimBarcode link : *links) {
+          if (link.vertexPrimary() != vertexPrimary) {
+            throw std::invalid_argument(
+                "Pileup vertices must only link particles of the same "
+                "primary vertex");
+          }
+          m_links.push_back(link.setVertexPrimary(0));
+        }
+      }
+    }
+
+    m_particleOffsets.push_back(m_particles.size());
+    m_vertexOffsets.push_back(m_vertices.size());
+    m_linkOffsets.push_back(m_links.size());
+  }
+}
+
+void PileupLibrary::place(std::size_t entry, SimBarcode::Value vertexPrimary,
+                          const Acts::Vector4& position4, double phi,
+                          bool mirrorZ, std::vector<SimParticle>& particles,
+                          std::vector<SimVertex>& vertices) const {
+  if (entry >= size()) {
+    throw std::out_of_range("Invalid pileup library entry");
+  }
+
+  Acts::RotationMatrix3 rotation =
+      Acts::AngleAxis3(phi, Acts::Vector3::UnitZ()).toRotationMatrix();
+  if (mirrorZ) {
+    rotation.col(2) *= -1;
+  }
+  auto transform = [&](const Acts::Vector4& relative) {
+    Acts::Vector4 result = position4;
+    result.head<3>() += rotation * relative.head<3>();
+    result[3] += relative[3];
+    return result;
+  };
+
+  for (std::size_t i = m_particleOffsets[entry];
+       i < m_particleOffsets[entry + 1]; ++i) {
+    const Particle& stored = m_particles[i];
+    SimParticle& particle = particles.emplace_back(
+        SimBarcode(stored.particleId).setVertexPrimary(vertexPrimary),
+        stored.pdg, stored.charge, stored.mass);
+    particle.initial()
+        .setPosition4(transform(stored.position4))
+        .setDirection(rotation * stored.direction)
+        .setAbsoluteMomentum(stored.absoluteMomentum);
+  }
+
+  const SimBarcode* link = m_links.data() + m_linkOffsets[entry];
+  auto translate = [&](std::uint32_t n) {
+    std::vector<SimBarcode> ids(link, link + n);
+    link += n;
+    for (SimBarcode& id : ids) {
+      id.setVertexPrimary(vertexPrimary);
+    }
+    // Translating the primary vertex identifier keeps the order
+    return SimBarcodeContainer(boost::container::ordered_unique_range,
+                               ids.begin(), ids.end());
+  };
+  for (std::size_t i = m_vertexOffsets[entry]; i < m_vertexOffsets[entry + 1];
+       ++i) {
+    const Vertex& stored = m_vertices[i];
+    SimVertex& vertex = vertices.emplace_back(
+        SimVertexBarcode(stored.id).setVertexPrimary(vertexPrimary),
+        transform(stored.position4), stored.process);
+    vertex.incoming = translate(stored.nIncoming);
+    vertex.outgoing = translate(stored.nOutgoing);
+  }
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,109 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsFatras/EventData/ProcessType.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ActsExamples {
+
+class HepMC3IndexedReader;
+
+/// Read-only pool of pre-generated pileup interactions.
+///
+/// Each entry is a single interaction stored relative to its primary vertex,
+/// i.e. with the primary vertex identifier cleared and with positions relative
+/// to the primary vertex position. The particles and vertices of all entries
+/// are held in flat arrays with only the generator-level information, i.e.
+/// without the final particle state, which is much more compact than the
+/// particle and vertex containers.
+///
+/// The library is filled once and then shared between all events and
+/// threads, see `PileupOverlay`.
+class PileupLibrary {
+ public:
+  /// Create an empty library.
+  PileupLibrary() = default;
+
+  /// Fill the library from a minimum-bias sample in HepMC3 ASCII format.
+  ///
+  /// @param reader the indexed reader of the sample
+  /// @param nEvents the maximum number of sample events to read
+  PileupLibrary(const HepMC3IndexedReader& reader, std::size_t nEvents);
+
+  /// Add every primary vertex of an event as a separate entry.
+  ///
+  /// @param particles the generated particles of the event
+  /// @param vertices the vertices of the event
+  void add(const SimParticleContainer& particles,
+           const SimVertexContainer& vertices);
+
+  /// Number of entries in the library.
+  std::size_t size() const { return m_particleOffsets.size() - 1; }
+  /// Total number of stored particles.
+  std::size_t numParticles() const { return m_particles.size(); }
+
+  /// Place an entry at the given primary vertex.
+  ///
+  /// The entry is rotated around the beam axis and optionally mirrored in z
+  /// before it is shifted to the primary vertex position. The resulting
+  /// particles and vertices are appended ordered by their identifiers.
+  ///
+  /// @param entry the library entry
+  /// @param vertexPrimary the primary vertex identifier to assign
+  /// @param position4 the primary vertex four-position
+  /// @param phi the rotation angle around the beam axis
+  /// @param mirrorZ whether to mirror the entry in z
+  /// @param particles the output particles
+  /// @param vertices the output vertices
+  void place(std::size_t entry, SimBarcode::Value vertexPrimary,
+             const Acts::Vector4& position4, double phi, bool mirrorZ,
+             std::vector<SimParticle>& particles,
+             std::vector<SimVertex>& vertices) const;
+
+ private:
+  struct Particle {
+    SimBarcode particleId;
+    Acts::PdgParticle pdg = Acts::PdgParticle::eInvalid;
+    double charge = 0;
+    double mass = 0;
+    /// Four-position relative to the primary vertex
+    Acts::Vector4 position4 = Acts::Vector4::Zero();
+    Acts::Vector3 direction = Acts::Vector3::UnitZ();
+    double absoluteMomentum = 0;
+  };
+
+  struct Vertex {
+    SimVertexBarcode id;
+    ActsFatras::ProcessType process = ActsFatras::ProcessType::eUndefined;
+    /// Four-position relative to the primary vertex
+    Acts::Vector4 position4 = Acts::Vector4::Zero();
+    /// Incoming particles followed by the outgoing particles in `m_links`
+    std::uint32_t nIncoming = 0;
+    std::uint32_t nOutgoing = 0;
+  };
+
+  std::vector<Particle> m_particles;
+  std::vector<Vertex> m_vertices;
+  std::vector<SimBarcode> m_links;
+  /// Start of each entry in the particle, vertex and link arrays, followed
+  /// by the total size
+  std::vector<std::size_t> m_particleOffsets = {0};
+  std::vector<std::size_t> m_vertexOffsets = {0};
+  std::vector<std::size_t> m_linkOffsets = {0};
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,121 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Generators/PileupOverlay.hpp"
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+
+#include <algorithm>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/container/container_fwd.hpp>
+
+namespace ActsExamples {
+
+PileupOverlay::PileupOverlay(const Config& config, Acts::Logging::Level level)
+    : IAlgorithm("PileupOverlay", level), m_cfg(config) {
+  if (m_cfg.inputParticles.empty() != m_cfg.inputVertices.empty()) {
+    throw std::invalid_argument(
+        "Input particles and vertices must be configured together");
+  }
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output particles collection");
+  }
+  if (m_cfg.outputVertices.empty()) {
+    throw std::invalid_argument("Missing output vertices collection");
+  }
+  if (m_cfg.library == nullptr || m_cfg.library->size() == 0) {
+    throw std::invalid_argument("Missing or empty pileup library");
+  }
+  if (m_cfg.multiplicity == nullptr) {
+    throw std::invalid_argument("Missing multiplicity generator");
+  }
+  if (m_cfg.vertex == nullptr) {
+    throw std::invalid_argument("Missing vertex generator");
+  }
+  if (!m_cfg.randomNumbers) {
+    throw std::invalid_argument("Missing random numbers service");
+  }
+
+  m_inputParticles.maybeInitialize(m_cfg.inputParticles);
+  m_inputVertices.maybeInitialize(m_cfg.inputVertices);
+  m_outputParticles.initialize(m_cfg.outputParticles);
+  m_outputVertices.initialize(m_cfg.outputVertices);
+}
+
+ProcessCode PileupOverlay::execute(const AlgorithmContext& ctx) const {
+  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+
+  std::vector<SimParticle> particles;
+  std::vector<SimVertex> vertices;
+  SimBarcode::Value nPrimaryVertices = 0;
+  if (m_inputParticles.isInitialized()) {
+    const auto& inputParticles = m_inputParticles(ctx);
+    const auto& inputVertices = m_inputVertices(ctx);
+    particles.assign(inputParticles.begin(), inputParticles.end());
+    vertices.assign(inputVertices.begin(), inputVertices.end());
+    // Both containers are ordered by the primary vertex identifier first
+    if (!particles.empty()) {
+      nPrimaryVertices = particles.back().particleId().vertexPrimary();
+    }
+    if (!vertices.empty()) {
+      nPrimaryVertices = std::max(nPrimaryVertices,
+                                  vertices.back().vertexId().vertexPrimary());
+    }
+  }
+
+  std::size_t multiplicity = (*m_cfg.multiplicity)(rng);
+  // The capacity is only estimated from the mean entry size
+  particles.reserve(particles.size() +
+                    multiplicity * m_cfg.library->numParticles() /
+                        m_cfg.library->size());
+
+  std::uniform_int_distribution<std::size_t> entryDist(
+      0, m_cfg.library->size() - 1);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::bernoulli_distribution mirrorDist(0.5);
+  for (std::size_t i = 0; i < multiplicity; ++i) {
+    nPrimaryVertices += 1;
+    if (nPrimaryVertices >= (SimBarcode::Value{1} << SimBarcode::bits(0))) {
+      ACTS_ERROR("Too many primary vertices for the particle barcode");
+      return ProcessCode::ABORT;
+    }
+    std::size_t entry = entryDist(rng);
+    Acts::Vector4 position4 = (*m_cfg.vertex)(rng);
+    double phi = m_cfg.randomizePhi ? phiDist(rng) : 0.;
+    bool mirrorZ = m_cfg.randomizeMirrorZ && mirrorDist(rng);
+    ACTS_VERBOSE("Place pileup entry " << entry << " at "
+                                       << position4.transpose());
+    m_cfg.library->place(entry, nPrimaryVertices, position4, phi, mirrorZ,
+                         particles, vertices);
+  }
+
+  ACTS_DEBUG("event=" << ctx.eventNumber << " n_pileup=" << multiplicity
+                      << " n_particles=" << particles.size());
+
+  // The pileup is appended with increasing primary vertex identifiers, which
+  // keeps both sequences ordered
+  SimParticleContainer outputParticles(
+      boost::container::ordered_unique_range,
+      std::make_move_iterator(particles.begin()),
+      std::make_move_iterator(particles.end()));
+  SimVertexContainer outputVertices(boost::container::ordered_unique_range,
+                                    std::make_move_iterator(vertices.begin()),
+                                    std::make_move_iterator(vertices.end()));
+
+  m_outputParticles(ctx, std::move(outputParticles));
+  m_outputVertices(ctx, std::move(outputVertices));
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
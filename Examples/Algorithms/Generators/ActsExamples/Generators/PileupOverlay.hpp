@@ -0,0 +1,83 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Generators/EventGenerator.hpp"
+#include "ActsExamples/Generators/PileupLibrary.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// Overlay pileup interactions from a pre-generated library.
+///
+/// For every event, the number of pileup interactions is drawn from the
+/// multiplicity generator. Each interaction is a random library entry that
+/// is placed at a position drawn from the vertex generator, with a random
+/// rotation around the beam axis and optionally mirrored in z, such that
+/// re-used entries do not overlap. Only the positions, directions and the
+/// primary vertex identifiers are changed, nothing is generated again.
+///
+/// The pileup primary vertices are numbered after the primary vertices of
+/// the optional input particles and vertices, e.g. the hard scatter.
+class PileupOverlay final : public IAlgorithm {
+ public:
+  struct Config {
+    /// Optional input particles collection, e.g. the hard scatter.
+    std::string inputParticles;
+    /// Optional input vertices collection, e.g. the hard scatter.
+    std::string inputVertices;
+    /// Output particles collection.
+    std::string outputParticles;
+    /// Output vertices collection.
+    std::string outputVertices;
+
+    /// The shared library of pileup interactions.
+    std::shared_ptr<const PileupLibrary> library;
+    /// The number of pileup interactions per event.
+    std::shared_ptr<EventGenerator::MultiplicityGenerator> multiplicity;
+    /// The pileup primary vertex positions.
+    std::shared_ptr<EventGenerator::PrimaryVertexPositionGenerator> vertex;
+    /// The random number service.
+    std::shared_ptr<const RandomNumbers> randomNumbers;
+
+    /// Rotate the interactions by a random angle around the beam axis.
+    bool randomizePhi = true;
+    /// Mirror the interactions in z with a probability of one half.
+    bool randomizeMirrorZ = true;
+  };
+
+  PileupOverlay(const Config& config, Acts::Logging::Level level);
+
+  ProcessCode execute(const AlgorithmContext& ctx) const final;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+
+  ReadDataHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadDataHandle<SimVertexContainer> m_inputVertices{this, "InputVertices"};
+
+  WriteDataHandle<SimParticleContainer> m_outputParticles{this,
+                                                          "OutputParticles"};
+  WriteDataHandle<SimVertexContainer> m_outputVertices{this, "OutputVertices"};
+};
+
+}  // namespace ActsExamples
@@ -11,11 +11,17 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Material/MaterialMapper.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/MaterialTrackBatch.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace ActsExamples {
 
 /// @class CoreMaterialMapping
@@ -28,8 +34,15 @@ namespace ActsExamples {
 /// However, running it in one single event, puts enormous pressure onto
 /// the I/O structure.
 ///
-/// It therefore saves the mapping state/cache as a private member variable
-/// and is designed to be executed in a single threaded mode.
+/// It therefore keeps several mapping states/caches as private member
+/// variables, such that events can be mapped concurrently. Each event is
+/// mapped into the state selected by its event number, independent of the
+/// thread it runs on. The states are merged in index order into a single one
+/// before the maps are finalized and written out.
+///
+/// Instead of recorded material tracks, a batch of columnar material track
+/// views can be mapped. In that case no mapped and unmapped material tracks
+/// are written to the event store.
 class CoreMaterialMapping : public IAlgorithm {
  public:
   /// @class nested Config class
@@ -38,6 +51,10 @@ class CoreMaterialMapping : public IAlgorithm {
     /// Input collection
     std::string inputMaterialTracks = "material_tracks";
 
+    /// Optional input batch of columnar material track views, replaces the
+    /// input collection if set
+    std::string inputMaterialTrackBatch;
+
     /// The actually mapped material tracks
     std::string mappedMaterialTracks = "mapped_material_tracks";
 
@@ -49,6 +66,11 @@ class CoreMaterialMapping : public IAlgorithm {
 
     /// The writer of the material
     std::vector<std::shared_ptr<IMaterialWriter>> materiaMaplWriters{};
+
+    /// Number of mapping states, event `i` is mapped into state
+    /// `i % nMappingStates`. With a single state, the accumulater does not
+    /// need to support merging states.
+    std::size_t nMappingStates = 16;
   };
 
   /// Constructor
@@ -74,11 +96,20 @@ class CoreMaterialMapping : public IAlgorithm {
  private:
   Config m_cfg;  //!< internal config object
 
-  std::unique_ptr<Acts::MaterialMapper::State> m_mappingState{nullptr};
+  /// A mapping state, created lazily on first use
+  struct MappingState {
+    std::mutex mutex;
+    std::unique_ptr<Acts::MaterialMapper::State> state;
+  };
+
+  mutable std::vector<MappingState> m_mappingStates;
 
   ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
 
+  ReadDataHandle<MaterialTrackBatch> m_inputMaterialTrackBatch{
+      this, "InputMaterialTrackBatch"};
+
   WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_outputMappedMaterialTracks{this, "OutputMappedMaterialTracks"};
 
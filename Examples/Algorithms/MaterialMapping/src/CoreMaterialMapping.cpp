@@ -12,6 +12,9 @@
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_map>
 
@@ -19,25 +22,50 @@ namespace ActsExamples {
 
 CoreMaterialMapping::CoreMaterialMapping(const CoreMaterialMapping::Config& cfg,
                                          Acts::Logging::Level level)
-    : IAlgorithm("CoreMaterialMapping", level), m_cfg(cfg) {
+    : IAlgorithm("CoreMaterialMapping", level),
+      m_cfg(cfg),
+      m_mappingStates(cfg.nMappingStates) {
   // Prepare the I/O collections
-  m_inputMaterialTracks.initialize(m_cfg.inputMaterialTracks);
-  m_outputMappedMaterialTracks.initialize(m_cfg.mappedMaterialTracks);
-  m_outputUnmappedMaterialTracks.initialize(m_cfg.unmappedMaterialTracks);
-
-  ACTS_INFO("This algorithm requires inter-event information, "
-            << "run in single-threaded mode!");
+  if (!m_cfg.inputMaterialTrackBatch.empty()) {
+    m_inputMaterialTrackBatch.initialize(m_cfg.inputMaterialTrackBatch);
+  } else {
+    m_inputMaterialTracks.initialize(m_cfg.inputMaterialTracks);
+    m_outputMappedMaterialTracks.initialize(m_cfg.mappedMaterialTracks);
+    m_outputUnmappedMaterialTracks.initialize(m_cfg.unmappedMaterialTracks);
+  }
 
   if (m_cfg.materialMapper == nullptr) {
     throw std::invalid_argument("Missing material mapper");
   }
-  // Create the state object
-  m_mappingState = m_cfg.materialMapper->createState();
+  if (m_cfg.nMappingStates == 0) {
+    throw std::invalid_argument("At least one mapping state is needed");
+  }
 }
 
 CoreMaterialMapping::~CoreMaterialMapping() {
+  // Merge the states into the first one, in index order such that the maps
+  // do not depend on the number of threads
+  std::unique_ptr<Acts::MaterialMapper::State> mappingState = nullptr;
+  std::size_t nMerged = 0;
+  for (auto& [mutex, state] : m_mappingStates) {
+    if (state == nullptr) {
+      continue;
+    }
+    if (mappingState == nullptr) {
+      mappingState = std::move(state);
+    } else {
+      m_cfg.materialMapper->mergeState(*mappingState, *state);
+      ++nMerged;
+    }
+  }
+  ACTS_DEBUG("Merged " << nMerged << " material mapping states");
+  // No event was processed, the maps are finalized from an empty state
+  if (mappingState == nullptr) {
+    mappingState = m_cfg.materialMapper->createState();
+  }
+
   Acts::DetectorMaterialMaps detectorMaterial =
-      m_cfg.materialMapper->finalizeMaps(*m_mappingState);
+      m_cfg.materialMapper->finalizeMaps(*mappingState);
   // Loop over the available writers and write the maps
   for (auto& imw : m_cfg.materiaMaplWriters) {
     imw->writeMaterial(detectorMaterial);
@@ -46,6 +74,32 @@ CoreMaterialMapping::~CoreMaterialMapping() {
 
 ProcessCode CoreMaterialMapping::execute(
     const AlgorithmContext& context) const {
+  // The event number selects the state, such that the same events are
+  // accumulated into the same state for any number of threads
+  auto& [mutex, mappingState] =
+      m_mappingStates[context.eventNumber % m_mappingStates.size()];
+  std::scoped_lock lock(mutex);
+  if (mappingState == nullptr) {
+    mappingState = m_cfg.materialMapper->createState();
+  }
+
+  // Map the columnar views directly, only accumulating the material
+  if (m_inputMaterialTrackBatch.isInitialized()) {
+    const MaterialTrackBatch& batch = m_inputMaterialTrackBatch(context);
+    std::size_t nAssigned = 0;
+    std::size_t nUnassigned = 0;
+    for (const auto& mtView : batch.tracks) {
+      auto [assigned, unassigned] = m_cfg.materialMapper->mapMaterial(
+          *mappingState, context.geoContext, context.magFieldContext, mtView);
+      nAssigned += assigned;
+      nUnassigned += unassigned;
+    }
+    ACTS_DEBUG("Mapped " << batch.tracks.size() << " material tracks, "
+                         << nAssigned << " steps assigned and " << nUnassigned
+                         << " unassigned");
+    return ProcessCode::SUCCESS;
+  }
+
   // Take the collection from the EventStore: input collection
   std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
       mtrackCollection = m_inputMaterialTracks(context);
@@ -57,10 +111,6 @@ ProcessCode CoreMaterialMapping::execute(
   std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
       unmappedTrackCollection;
 
-  // To make it work with the framework needs a lock guard
-  auto mappingState =
-      const_cast<Acts::MaterialMapper::State*>(m_mappingState.get());
-
   for (auto& [idTrack, mTrack] : mtrackCollection) {
     auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
         *mappingState, context.geoContext, context.magFieldContext, mTrack);
@@ -326,8 +326,10 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   MeasurementSelector measSel{
       Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
 
+  // Index the source links once for the lookups of all tracks
+  IndexSourceLinkAccessor::Container sourceLinks(measurements.orderedIndices());
   IndexSourceLinkAccessor slAccessor;
-  slAccessor.container = &measurements.orderedIndices();
+  slAccessor.container = &sourceLinks;
 
   using TrackStateCreatorType =
       Acts::TrackStateCreator<IndexSourceLinkAccessor::Iterator,
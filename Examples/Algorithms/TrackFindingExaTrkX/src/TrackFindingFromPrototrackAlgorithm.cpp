@@ -93,7 +93,7 @@ ActsExamples::ProcessCode TrackFindingFromPrototrackAlgorithm::execute(
   sourceLinkAccessor.container = &measurements.orderedIndices();
 
   using TrackStateCreatorType =
-      Acts::TrackStateCreator<IndexSourceLinkAccessor::Iterator,
+      Acts::TrackStateCreator<ProtoTrackSourceLinkAccessor::Iterator,
                               TrackContainer>;
   TrackStateCreatorType trackStateCreator;
   trackStateCreator.sourceLinkAccessor
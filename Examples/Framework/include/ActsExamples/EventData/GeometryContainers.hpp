@@ -14,7 +14,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include <boost/bimap.hpp>
 #include <boost/container/flat_map.hpp>
@@ -211,6 +215,184 @@ groupByModule(const GeometryIdMultiset<T>& container) {
   return makeGroupBy(container, detail::GeometryIdGetter());
 }
 
+/// Store elements sorted by geometry id with a dense lookup of the modules.
+///
+/// @tparam T type to be stored, must be compatible with `CompareGeometryId`
+///
+/// The elements are sorted once on construction and can not be modified
+/// afterwards. Elements with the same geometry id are stored contiguously and
+/// the element range of each distinct geometry id is stored as an offset
+/// into the element array. For regular module ids, i.e. ids that only have
+/// volume, layer, and sensitive components, the range is found through dense
+/// per-volume and per-layer tables with a fixed number of array reads instead
+/// of a binary search over all elements. This is meant for containers that
+/// are filled once per event and searched many times, e.g. the measurements
+/// during track finding.
+template <typename T>
+class GeometryIdIndexedMultiset {
+ public:
+  using value_type = T;
+  using const_iterator = typename std::vector<T>::const_iterator;
+  using iterator = const_iterator;
+
+  /// Construct an empty container.
+  GeometryIdIndexedMultiset() = default;
+
+  /// Construct from elements in arbitrary order.
+  ///
+  /// Elements with the same geometry id keep their relative order.
+  explicit GeometryIdIndexedMultiset(std::vector<T> elements)
+      : m_elements(std::move(elements)) {
+    std::ranges::stable_sort(m_elements, detail::CompareGeometryId{});
+    buildIndex();
+  }
+
+  /// Construct from elements that are already sorted by geometry id.
+  explicit GeometryIdIndexedMultiset(const GeometryIdMultiset<T>& elements)
+      : m_elements(elements.begin(), elements.end()) {
+    buildIndex();
+  }
+
+  const_iterator begin() const { return m_elements.begin(); }
+  const_iterator end() const { return m_elements.end(); }
+  std::size_t size() const { return m_elements.size(); }
+  bool empty() const { return m_elements.empty(); }
+
+  /// Find all elements with exactly the given geometry id.
+  std::pair<const_iterator, const_iterator> equal_range(
+      Acts::GeometryIdentifier geoId) const {
+    Index group = findGroup(geoId);
+    if (group == s_noGroup) {
+      return {end(), end()};
+    }
+    return {begin() + m_offsets[group], begin() + m_offsets[group + 1]};
+  }
+
+ private:
+  using Index = std::uint32_t;
+  using Value = Acts::GeometryIdentifier::Value;
+
+  static constexpr Index s_noGroup = std::numeric_limits<Index>::max();
+
+  /// Entries of a lookup table for the identifiers [min, min + size)
+  struct Slice {
+    Index begin = 0;
+    Index min = 0;
+    Index size = 0;
+  };
+
+  static bool isModule(Acts::GeometryIdentifier geoId) {
+    return geoId.boundary() == 0u && geoId.approach() == 0u &&
+           geoId.extra() == 0u;
+  }
+
+  void buildIndex() {
+    assert(m_elements.size() < s_noGroup && "Too many elements");
+
+    for (std::size_t i = 0; i < m_elements.size(); ++i) {
+      Acts::GeometryIdentifier geoId =
+          detail::GeometryIdGetter()(m_elements[i]);
+      if (m_ids.empty() || m_ids.back() != geoId) {
+        m_ids.push_back(geoId);
+        m_offsets.push_back(static_cast<Index>(i));
+      }
+    }
+    m_offsets.push_back(static_cast<Index>(m_elements.size()));
+
+    // Module ids are ordered by volume, layer, and sensitive, since the
+    // boundary and approach components in between are zero
+    std::vector<Index> modules;
+    for (Index group = 0; group < m_ids.size(); ++group) {
+      if (isModule(m_ids[group])) {
+        modules.push_back(group);
+      }
+    }
+    if (modules.empty()) {
+      return;
+    }
+
+    m_volumes.resize(m_ids[modules.back()].volume() + 1);
+    auto it = modules.begin();
+    while (it != modules.end()) {
+      Value volume = m_ids[*it].volume();
+      auto volumeEnd = std::find_if(it, modules.end(), [&](Index group) {
+        return m_ids[group].volume() != volume;
+      });
+      Slice& layers = m_volumes[volume];
+      layers.begin = static_cast<Index>(m_layers.size());
+      layers.min = static_cast<Index>(m_ids[*it].layer());
+      layers.size =
+          static_cast<Index>(m_ids[*(volumeEnd - 1)].layer() - layers.min + 1);
+      m_layers.resize(m_layers.size() + layers.size);
+
+      while (it != volumeEnd) {
+        Value layer = m_ids[*it].layer();
+        auto layerEnd = std::find_if(it, volumeEnd, [&](Index group) {
+          return m_ids[group].layer() != layer;
+        });
+        Slice& sensitives = m_layers[layers.begin + layer - layers.min];
+        sensitives.begin = static_cast<Index>(m_sensitives.size());
+        sensitives.min = static_cast<Index>(m_ids[*it].sensitive());
+        sensitives.size = static_cast<Index>(
+            m_ids[*(layerEnd - 1)].sensitive() - sensitives.min + 1);
+        m_sensitives.resize(m_sensitives.size() + sensitives.size, s_noGroup);
+
+        for (; it != layerEnd; ++it) {
+          m_sensitives[sensitives.begin + m_ids[*it].sensitive() -
+                       sensitives.min] = *it;
+        }
+      }
+    }
+  }
+
+  Index findGroup(Acts::GeometryIdentifier geoId) const {
+    if (!isModule(geoId)) {
+      // only module ids are in the dense tables
+      auto it = std::lower_bound(m_ids.begin(), m_ids.end(), geoId);
+      if (it == m_ids.end() || *it != geoId) {
+        return s_noGroup;
+      }
+      return static_cast<Index>(it - m_ids.begin());
+    }
+
+    if (geoId.volume() >= m_volumes.size()) {
+      return s_noGroup;
+    }
+    const Slice& layers = m_volumes[geoId.volume()];
+    // unsigned wrap-around also rejects layers below the minimum
+    Value layer = geoId.layer() - layers.min;
+    if (layer >= layers.size) {
+      return s_noGroup;
+    }
+    const Slice& sensitives = m_layers[layers.begin + layer];
+    Value sensitive = geoId.sensitive() - sensitives.min;
+    if (sensitive >= sensitives.size) {
+      return s_noGroup;
+    }
+    return m_sensitives[sensitives.begin + sensitive];
+  }
+
+  std::vector<T> m_elements;
+  /// Distinct geometry ids in the order of the elements
+  std::vector<Acts::GeometryIdentifier> m_ids;
+  /// Start of the elements of each distinct id, followed by the total size
+  std::vector<Index> m_offsets;
+  /// Layer table slice for each volume
+  std::vector<Slice> m_volumes;
+  /// Sensitive table slice for each layer of each volume
+  std::vector<Slice> m_layers;
+  /// Distinct id index for each sensitive of each layer or `s_noGroup`
+  std::vector<Index> m_sensitives;
+};
+
+/// Select all elements for the given module / sensitive surface.
+template <typename T>
+inline Range<typename GeometryIdIndexedMultiset<T>::const_iterator>
+selectModule(const GeometryIdIndexedMultiset<T>& container,
+             Acts::GeometryIdentifier geoId) {
+  return makeRange(container.equal_range(geoId));
+}
+
 /// The accessor for the GeometryIdMultiset container
 ///
 /// It wraps up a few lookup methods to be used in the Combinatorial Kalman
@@ -226,6 +408,21 @@ struct GeometryIdMultisetAccessor {
   const Container* container = nullptr;
 };
 
+/// The accessor for the GeometryIdIndexedMultiset container
+///
+/// Same as the `GeometryIdMultisetAccessor` but for the container with the
+/// dense module lookup.
+template <typename T>
+struct GeometryIdIndexedMultisetAccessor {
+  using Container = GeometryIdIndexedMultiset<T>;
+  using Key = Acts::GeometryIdentifier;
+  using Value = typename GeometryIdIndexedMultiset<T>::value_type;
+  using Iterator = typename GeometryIdIndexedMultiset<T>::const_iterator;
+
+  // pointer to the container
+  const Container* container = nullptr;
+};
+
 /// A map that allows mapping back and forth between ACTS and Athena Geometry
 /// Ids
 using GeometryIdMapActsAthena =
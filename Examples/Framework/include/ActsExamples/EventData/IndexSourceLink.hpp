@@ -87,9 +87,12 @@ struct IndexSourceLinkSurfaceAccessor {
 /// Accessor for the above source link container
 ///
 /// It wraps up a few lookup methods to be used in the Combinatorial Kalman
-/// Filter
-struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
-  using BaseIterator = GeometryIdMultisetAccessor<IndexSourceLink>::Iterator;
+/// Filter. The source links are looked up in the container with the dense
+/// module lookup, since the lookup happens for every visited surface.
+struct IndexSourceLinkAccessor
+    : GeometryIdIndexedMultisetAccessor<IndexSourceLink> {
+  using BaseIterator =
+      GeometryIdIndexedMultisetAccessor<IndexSourceLink>::Iterator;
 
   using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
 
@@ -0,0 +1,29 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/MaterialTrackView.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace ActsExamples {
+
+/// A batch of columnar material track views.
+///
+/// The views point into memory owned by the storage handle, e.g. a memory
+/// mapped input file, which is kept alive as long as the batch exists.
+struct MaterialTrackBatch {
+  /// Keeps the memory the views point to alive
+  std::shared_ptr<const void> storage;
+  /// The material track views
+  std::vector<Acts::MaterialTrackView> tracks;
+};
+
+}  // namespace ActsExamples
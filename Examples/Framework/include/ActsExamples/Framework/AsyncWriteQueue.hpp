@@ -0,0 +1,74 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ActsExamples {
+
+/// Serial queue of write tasks executed on a dedicated I/O thread.
+///
+/// Writers that can not write concurrently, e.g. ROOT writers filling a
+/// single tree, prepare the output of an event on the calling thread and push
+/// a task that performs the actual write. The tasks are executed one after
+/// the other in the order they were pushed, i.e. the output objects are only
+/// ever touched by the I/O thread and need no further locking. The event
+/// processing threads only wait if the number of pending tasks exceeds the
+/// configured limit, which bounds the memory held by the prepared output.
+class AsyncWriteQueue {
+ public:
+  using Task = std::function<void()>;
+
+  /// Start the I/O thread.
+  ///
+  /// @param maxPending is the maximum number of tasks waiting to be executed
+  explicit AsyncWriteQueue(std::size_t maxPending = 128);
+
+  AsyncWriteQueue(const AsyncWriteQueue&) = delete;
+  AsyncWriteQueue& operator=(const AsyncWriteQueue&) = delete;
+
+  /// Execute all pending tasks and stop the I/O thread.
+  ~AsyncWriteQueue();
+
+  /// Schedule a task for execution on the I/O thread.
+  ///
+  /// @param task is the task to execute
+  void push(Task task);
+
+  /// Wait until all scheduled tasks have been executed.
+  void wait();
+
+  /// Wait until all scheduled tasks have been executed.
+  ///
+  /// @throws the first exception thrown by any task since the last flush
+  void flush();
+
+ private:
+  void run();
+
+  std::size_t m_maxPending;
+  std::mutex m_mutex;
+  /// Signals new tasks or the stop request to the I/O thread
+  std::condition_variable m_pushed;
+  /// Signals finished tasks to waiting producers
+  std::condition_variable m_done;
+  std::deque<Task> m_tasks;
+  bool m_busy = false;
+  bool m_stop = false;
+  std::exception_ptr m_error;
+  std::thread m_thread;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,132 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+class WhiteBoard;
+
+/// Event data reader that takes a concrete reader instance and reads the
+/// upcoming events ahead of time on background threads.
+///
+/// The upstream reader fills a separate whiteboard per event, starting from
+/// the first event requested by the sequencer. When the event is requested,
+/// its content is handed over to the event store, such that the processing
+/// threads do not wait for decompression or deserialization as long as the
+/// readahead keeps up. At most `readahead` events are held in memory at any
+/// time. Events outside of the readahead window are read synchronously.
+///
+/// The upstream reader must support concurrent reads if more than one
+/// background thread is used, which is required by the reader interface.
+class PrefetchingReader final : public IReader {
+ public:
+  struct Config {
+    /// The upstream reader that should be used
+    std::shared_ptr<IReader> upstreamReader;
+
+    /// Number of background threads reading events
+    std::size_t nThreads = 1;
+
+    /// Maximum number of events read ahead and held in memory
+    std::size_t readahead = 8;
+  };
+
+  /// Construct the reader, the background threads are started with the
+  /// first requested event
+  PrefetchingReader(const Config& config, Acts::Logging::Level level);
+
+  PrefetchingReader(const PrefetchingReader&) = delete;
+  PrefetchingReader& operator=(const PrefetchingReader&) = delete;
+
+  /// Stop the background threads
+  ~PrefetchingReader() override;
+
+  /// Return the config
+  const Config& config() const { return m_cfg; }
+
+  /// Give the reader a understandable name
+  std::string name() const override {
+    return "Prefetching" + m_cfg.upstreamReader->name();
+  }
+
+  /// The available events of the upstream reader
+  std::pair<std::size_t, std::size_t> availableEvents() const override {
+    return m_cfg.upstreamReader->availableEvents();
+  }
+
+  /// Hand over a prefetched event, or read it if it was not prefetched
+  ProcessCode read(const AlgorithmContext& ctx) override;
+
+  /// Start reading ahead from the given event
+  ProcessCode skip(std::size_t events) override;
+
+  /// Initialize the upstream reader
+  ProcessCode initialize() override;
+
+  /// Stop the background threads and finalize the upstream reader
+  ProcessCode finalize() override;
+
+ private:
+  /// A prefetched or in-flight event
+  struct Slot {
+    std::unique_ptr<WhiteBoard> board;
+    ProcessCode code = ProcessCode::SUCCESS;
+    std::exception_ptr error;
+    bool ready = false;
+  };
+
+  /// Start the background threads from the given event, requires the lock
+  void start(std::size_t event);
+
+  /// Stop the background threads
+  void stop();
+
+  /// Background thread loop
+  void run();
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  std::mutex m_mutex;
+  /// Signals finished events to waiting consumers
+  std::condition_variable m_slotReady;
+  /// Signals free readahead capacity or the stop request to the threads
+  std::condition_variable m_slotFree;
+  /// Prefetched and in-flight events, ordered by event number
+  std::map<std::size_t, Slot> m_slots;
+  /// Events ahead of the readahead that were read synchronously
+  std::set<std::size_t> m_claimed;
+  /// The next event to prefetch and the end of the available events
+  std::size_t m_next = 0;
+  std::size_t m_end = 0;
+  bool m_started = false;
+  bool m_stop = false;
+  std::vector<std::thread> m_threads;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <random>
+#include <string_view>
 
 namespace ActsExamples {
 struct AlgorithmContext;
@@ -48,12 +49,36 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a random number generator for an independent sub-stream of the
+  /// event, e.g. a single particle or detector module.
+  ///
+  /// The seed depends on the event seed, the caller and the stream
+  /// identifier. Work that is split into streams can thus be processed in any
+  /// order and on any number of threads with reproducible results. Callers
+  /// using the same stream identifiers, e.g. the simulation and the
+  /// digitization, still get independent streams.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param caller identifies the caller, e.g. the algorithm name
+  /// @param stream is the identifier of the sub-stream
+  RandomEngine spawnGenerator(const AlgorithmContext& context,
+                              std::string_view caller,
+                              std::uint64_t stream) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
   /// random engine is used and `spawnGenerator` can not be used.
   RandomSeed generateSeed(const AlgorithmContext& context) const;
 
+  /// Generate a seed value for an independent sub-stream of the event.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param caller identifies the caller, e.g. the algorithm name
+  /// @param stream is the identifier of the sub-stream
+  RandomSeed generateSeed(const AlgorithmContext& context,
+                          std::string_view caller, std::uint64_t stream) const;
+
  private:
   Config m_cfg;
 };
@@ -51,6 +51,7 @@ class SequenceElement {
   friend class DataHandleBase;
 
   friend class BufferedReader;
+  friend class PrefetchingReader;
 
   std::vector<const DataHandleBase*> m_writeHandles;
   std::vector<const DataHandleBase*> m_readHandles;
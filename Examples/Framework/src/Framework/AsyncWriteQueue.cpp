@@ -0,0 +1,82 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/AsyncWriteQueue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+ActsExamples::AsyncWriteQueue::AsyncWriteQueue(std::size_t maxPending)
+    : m_maxPending(std::max<std::size_t>(maxPending, 1)),
+      m_thread([this]() { run(); }) {}
+
+ActsExamples::AsyncWriteQueue::~AsyncWriteQueue() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_pushed.notify_all();
+  m_thread.join();
+}
+
+void ActsExamples::AsyncWriteQueue::push(Task task) {
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_tasks.size() < m_maxPending; });
+    m_tasks.push_back(std::move(task));
+  }
+  m_pushed.notify_one();
+}
+
+void ActsExamples::AsyncWriteQueue::wait() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this]() { return m_tasks.empty() && !m_busy; });
+}
+
+void ActsExamples::AsyncWriteQueue::flush() {
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_tasks.empty() && !m_busy; });
+    error = std::exchange(m_error, nullptr);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ActsExamples::AsyncWriteQueue::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_pushed.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+    // pending tasks are still executed after the stop request
+    if (m_tasks.empty()) {
+      return;
+    }
+    Task task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    m_busy = true;
+    lock.unlock();
+    // a slot in the queue is free again
+    m_done.notify_all();
+
+    std::exception_ptr error;
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if (error && !m_error) {
+      m_error = error;
+    }
+    m_busy = false;
+    m_done.notify_all();
+  }
+}
@@ -0,0 +1,165 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/PrefetchingReader.hpp"
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace ActsExamples {
+
+PrefetchingReader::PrefetchingReader(const Config &config,
+                                     Acts::Logging::Level level)
+    : m_cfg(config), m_logger(Acts::getDefaultLogger(name(), level)) {
+  if (!m_cfg.upstreamReader) {
+    throw std::invalid_argument("No upstream reader provided!");
+  }
+  if (m_cfg.nThreads == 0) {
+    throw std::invalid_argument("At least one reading thread is required");
+  }
+  if (m_cfg.readahead == 0) {
+    throw std::invalid_argument("The readahead must be at least one event");
+  }
+
+  // Register write and read handles of the upstream reader
+  for (auto rh : m_cfg.upstreamReader->readHandles()) {
+    registerReadHandle(*rh);
+  }
+
+  for (auto wh : m_cfg.upstreamReader->writeHandles()) {
+    registerWriteHandle(*wh);
+  }
+}
+
+PrefetchingReader::~PrefetchingReader() {
+  stop();
+}
+
+ProcessCode PrefetchingReader::initialize() {
+  return m_cfg.upstreamReader->initialize();
+}
+
+ProcessCode PrefetchingReader::finalize() {
+  stop();
+  return m_cfg.upstreamReader->finalize();
+}
+
+ProcessCode PrefetchingReader::skip(std::size_t events) {
+  ProcessCode code = m_cfg.upstreamReader->skip(events);
+  if (code == ProcessCode::SUCCESS) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    start(events);
+  }
+  return code;
+}
+
+void PrefetchingReader::start(std::size_t event) {
+  if (m_started) {
+    return;
+  }
+  m_started = true;
+  m_next = event;
+  m_end = m_cfg.upstreamReader->availableEvents().second;
+
+  ACTS_DEBUG("Start reading ahead from event "
+             << event << " with " << m_cfg.nThreads << " threads");
+  m_threads.reserve(m_cfg.nThreads);
+  for (std::size_t i = 0; i < m_cfg.nThreads; ++i) {
+    m_threads.emplace_back([this]() { run(); });
+  }
+}
+
+void PrefetchingReader::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_slotFree.notify_all();
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+  m_threads.clear();
+}
+
+void PrefetchingReader::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_slotFree.wait(lock, [this]() {
+      return m_stop || (m_next < m_end && m_slots.size() < m_cfg.readahead);
+    });
+    if (m_stop) {
+      return;
+    }
+    // Events that were already read synchronously are not read again
+    if (m_claimed.erase(m_next) != 0) {
+      ++m_next;
+      continue;
+    }
+    std::size_t event = m_next++;
+    // References to map elements stay valid, and only ready slots are erased
+    Slot &slot = m_slots[event];
+    lock.unlock();
+
+    auto board = std::make_unique<WhiteBoard>(m_logger->clone());
+    AlgorithmContext ctx(0, event, *board, 0);
+    ProcessCode code = ProcessCode::ABORT;
+    std::exception_ptr error;
+    ACTS_VERBOSE("Read event " << event << " ahead of time");
+    try {
+      code = m_cfg.upstreamReader->read(ctx);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    slot.board = std::move(board);
+    slot.code = code;
+    slot.error = error;
+    slot.ready = true;
+    m_slotReady.notify_all();
+  }
+}
+
+ProcessCode PrefetchingReader::read(const AlgorithmContext &ctx) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  // Without a preceding skip the readahead starts at the first request
+  start(ctx.eventNumber);
+
+  auto it = m_slots.find(ctx.eventNumber);
+  if (it == m_slots.end()) {
+    if (ctx.eventNumber >= m_next && ctx.eventNumber < m_end) {
+      m_claimed.insert(ctx.eventNumber);
+    }
+    lock.unlock();
+    ACTS_DEBUG("Event " << ctx.eventNumber
+                        << " is outside of the readahead, read it directly");
+    return m_cfg.upstreamReader->read(ctx);
+  }
+
+  if (!it->second.ready) {
+    ACTS_VERBOSE("Wait for event " << ctx.eventNumber);
+    m_slotReady.wait(lock, [&]() { return it->second.ready; });
+  }
+  Slot slot = std::move(it->second);
+  m_slots.erase(it);
+  lock.unlock();
+  m_slotFree.notify_one();
+
+  if (slot.error) {
+    std::rethrow_exception(slot.error);
+  }
+  ctx.eventStore.copyFrom(*slot.board);
+  ACTS_VERBOSE("Handed over prefetched event " << ctx.eventNumber);
+  return slot.code;
+}
+
+}  // namespace ActsExamples
@@ -19,8 +19,40 @@ RandomEngine RandomNumbers::spawnGenerator(
   return RandomEngine(generateSeed(context));
 }
 
+RandomEngine RandomNumbers::spawnGenerator(const AlgorithmContext& context,
+                                           std::string_view caller,
+                                           std::uint64_t stream) const {
+  return RandomEngine(generateSeed(context, caller, stream));
+}
+
 RandomSeed RandomNumbers::generateSeed(const AlgorithmContext& context) const {
   return m_cfg.seed + context.eventNumber;
 }
 
+RandomSeed RandomNumbers::generateSeed(const AlgorithmContext& context,
+                                       std::string_view caller,
+                                       std::uint64_t stream) const {
+  // The SplitMix64 increment and finalizer
+  constexpr std::uint64_t golden = 0x9e3779b97f4a7c15u;
+  auto mix = [](std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+    return z ^ (z >> 31);
+  };
+
+  // FNV-1a hash of the caller, which unlike std::hash is the same on every
+  // platform and in every run
+  std::uint64_t callerHash = 0xcbf29ce484222325u;
+  for (char c : caller) {
+    callerHash = (callerHash ^ static_cast<unsigned char>(c)) * 0x100000001b3u;
+  }
+
+  // Chain event seed, caller and stream such that seeds of neighbouring
+  // streams and of different callers are uncorrelated
+  std::uint64_t z =
+      mix(callerHash + golden * (std::uint64_t{generateSeed(context)} + 1u));
+  z = mix(z + golden * (stream + 1u));
+  return static_cast<RandomSeed>(z ^ (z >> 32));
+}
+
 }  // namespace ActsExamples
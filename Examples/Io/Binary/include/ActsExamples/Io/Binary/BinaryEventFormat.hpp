@@ -0,0 +1,161 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ActsExamples::BinaryEventFormat {
+
+/// Columnar binary layout of per-event reconstruction products.
+///
+/// The file starts with a file header, followed by one block per event:
+///
+///     BlockHeader
+///     SectionHeader + columns    one section per stored collection
+///     ...
+///
+/// Each section stores one collection as a sequence of columns with one
+/// entry per row, see the section kinds below for the column order. Every
+/// column is padded to a multiple of 8 bytes and all values are stored in
+/// native byte order, such that the columns can be used in place when the
+/// file is memory mapped.
+
+/// The file identifier
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'E', 'V', 'N', 'T'};
+/// The format version
+constexpr std::uint32_t s_version = 1;
+
+/// The stored collections and their columns
+enum class SectionKind : std::uint32_t {
+  /// Simulated hits, in the order of the container
+  ///
+  ///     uint64_t geometryId[n]
+  ///     uint64_t particleId[n]
+  ///     int32_t  index[n]
+  ///     double   fourPosition[4][n]
+  ///     double   momentum4Before[4][n]
+  ///     double   momentum4After[4][n]
+  eSimHits = 1,
+  /// Measurements, in index order, with m = sum(size) and k = sum(size^2)
+  ///
+  ///     uint64_t geometryId[n]
+  ///     uint8_t  size[n]
+  ///     uint8_t  subspaceIndices[m]
+  ///     double   parameters[m]
+  ///     double   covariances[k]
+  eMeasurements = 2,
+  /// Space points, optional values are stored as NaN
+  ///
+  ///     double   x[n], y[n], z[n], t[n]
+  ///     double   varianceR[n], varianceZ[n], varianceT[n]
+  ///     uint8_t  nSourceLinks[n]
+  ///     uint64_t sourceLinkGeometryId[2][n]
+  ///     uint64_t sourceLinkIndex[2][n]
+  ///
+  /// followed by the strip details if `eStripDetails` is set
+  ///
+  ///     uint8_t  validDoubleMeasurementDetails[n]
+  ///     float    topHalfStripLength[n], bottomHalfStripLength[n]
+  ///     double   topStripDirection[3][n], bottomStripDirection[3][n]
+  ///     double   stripCenterDistance[3][n], topStripCenterPosition[3][n]
+  eSpacePoints = 3,
+};
+
+/// Section flags
+enum SectionFlags : std::uint32_t {
+  /// The space point section contains the strip details columns
+  eStripDetails = 1u << 0,
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = s_magic;
+  std::uint32_t version = s_version;
+  std::uint32_t reserved = 0;
+};
+
+struct BlockHeader {
+  std::uint64_t eventId = 0;
+  std::uint64_t nSections = 0;
+  /// Number of bytes of the block, including this header
+  std::uint64_t nBytes = 0;
+  std::uint64_t reserved = 0;
+};
+
+struct SectionHeader {
+  SectionKind kind = SectionKind::eSimHits;
+  std::uint32_t flags = 0;
+  /// Number of rows of the collection
+  std::uint64_t nRows = 0;
+  /// Number of bytes of the columns, excluding this header
+  std::uint64_t nBytes = 0;
+  std::uint64_t reserved = 0;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(BlockHeader) == 32);
+static_assert(sizeof(SectionHeader) == 32);
+
+/// The number of bytes of a column padded to 8 bytes
+inline std::size_t paddedSize(std::size_t nBytes) {
+  return (nBytes + 7u) & ~std::size_t{7u};
+}
+
+/// Append a column to a block buffer, padded to a multiple of 8 bytes
+///
+/// @param buffer is the block buffer
+/// @param column are the column values
+template <typename T>
+void appendColumn(std::vector<std::byte>& buffer, std::span<const T> column) {
+  static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8);
+  std::size_t offset = buffer.size();
+  buffer.resize(offset + paddedSize(column.size_bytes()), std::byte{0});
+  if (!column.empty()) {
+    std::memcpy(buffer.data() + offset, column.data(), column.size_bytes());
+  }
+}
+
+/// Sequential, bounds checked access to the columns of a section
+///
+/// The columns are views into the underlying bytes, which must be aligned
+/// to 8 bytes.
+class ColumnCursor {
+ public:
+  /// @param data are the column bytes of a section
+  explicit ColumnCursor(std::span<const std::byte> data) : m_data(data) {}
+
+  /// The next column
+  ///
+  /// @param n is the number of column entries
+  /// @throws std::ios_base::failure if the section is too short
+  template <typename T>
+  std::span<const T> next(std::size_t n) {
+    static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8);
+    std::size_t nBytes = paddedSize(n * sizeof(T));
+    if (n > m_data.size() / sizeof(T) || nBytes > m_data.size() - m_offset) {
+      throw std::ios_base::failure("Truncated event section");
+    }
+    const auto* first = reinterpret_cast<const T*>(m_data.data() + m_offset);
+    m_offset += nBytes;
+    return {first, n};
+  }
+
+ private:
+  std::span<const std::byte> m_data;
+  std::size_t m_offset = 0;
+};
+
+}  // namespace ActsExamples::BinaryEventFormat
@@ -0,0 +1,94 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+class MappedFile;
+
+/// @class BinaryEventReader
+///
+/// @brief Reads simulated hits, measurements and space points from the
+/// columnar binary format written by the BinaryEventWriter
+///
+/// The input file is memory mapped once and indexed by event number. The
+/// collections are rebuilt directly from the mapped columns, the value
+/// arrays of the measurements are copied in bulk. There is no text parsing
+/// involved and reading is lock-free for different events.
+class BinaryEventReader : public IReader {
+ public:
+  /// @brief The nested configuration struct
+  struct Config {
+    /// Optional. Output simulated hits collection
+    std::string outputSimHits;
+    /// Optional. Output measurements collection
+    std::string outputMeasurements;
+    /// Optional. Output space points collection
+    std::string outputSpacePoints;
+    /// path of the input file
+    std::string filePath = "events.bin";
+  };
+
+  /// Constructor
+  /// @param config The Configuration struct
+  /// @param level The log level
+  BinaryEventReader(const Config& config, Acts::Logging::Level level);
+
+  /// Framework name() method
+  std::string name() const override;
+
+  /// Return the available events range.
+  std::pair<std::size_t, std::size_t> availableEvents() const override;
+
+  /// Read out data from the input stream
+  ///
+  /// @param context The algorithm context
+  ProcessCode read(const ActsExamples::AlgorithmContext& context) override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The logger
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  /// The config class
+  Config m_cfg;
+
+  WriteDataHandle<SimHitContainer> m_outputSimHits{this, "OutputSimHits"};
+  WriteDataHandle<MeasurementContainer> m_outputMeasurements{
+      this, "OutputMeasurements"};
+  WriteDataHandle<SimSpacePointContainer> m_outputSpacePoints{
+      this, "OutputSpacePoints"};
+
+  /// The mapped input file
+  std::shared_ptr<const MappedFile> m_file;
+
+  /// Byte offsets of the event blocks, ordered by event number
+  std::vector<std::size_t> m_blockOffsets;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,87 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// @class BinaryEventWriter
+///
+/// Writes simulated hits, measurements and space points into the columnar
+/// binary format described in BinaryEventFormat.hpp, one block per event.
+///
+/// All configured collections of an event end up in the same block. The
+/// blocks are encoded outside of the file lock, only the final write is
+/// serialized between events. The file is meant to be read back by the
+/// memory mapped BinaryEventReader, e.g. in the next stage of a workflow.
+class BinaryEventWriter final : public IWriter {
+ public:
+  struct Config {
+    /// Optional. Simulated hits collection to write
+    std::string inputSimHits;
+    /// Optional. Measurements collection to write
+    std::string inputMeasurements;
+    /// Optional. Space points collection to write
+    std::string inputSpacePoints;
+    /// path of the output file
+    std::string filePath = "events.bin";
+  };
+
+  /// Constructor with
+  /// @param config configuration struct
+  /// @param level logging level
+  BinaryEventWriter(const Config& config, Acts::Logging::Level level);
+
+  /// Virtual destructor
+  ~BinaryEventWriter() override;
+
+  /// Provide the name of the writer
+  std::string name() const override;
+
+  /// Write the configured collections of one event
+  ProcessCode write(const AlgorithmContext& ctx) override;
+
+  /// End-of-run hook, closes the output file
+  ProcessCode finalize() override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  ReadDataHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  ReadDataHandle<MeasurementContainer> m_inputMeasurements{
+      this, "InputMeasurements"};
+  ReadDataHandle<SimSpacePointContainer> m_inputSpacePoints{
+      this, "InputSpacePoints"};
+
+  /// mutex used to protect multi-threaded writes
+  std::mutex m_writeMutex;
+  /// The output file
+  std::ofstream m_outputFile;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,97 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace ActsExamples::BinaryMaterialTrackFormat {
+
+/// Columnar binary layout of recorded material tracks.
+///
+/// The file starts with a file header, followed by one block per event:
+///
+///     BlockHeader
+///     float    tracks[nTracks][6]    start position and momentum
+///     uint64_t offsets[nTracks + 1]  step range of each track
+///     float    columns[12][nSteps]   one column per step quantity
+///
+/// All values are stored in native byte order. Every part of a block is a
+/// multiple of 8 bytes (6 and 12 floats respectively), such that the
+/// columns can be used in place when the file is memory mapped.
+
+/// The file identifier
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'M', 'T', 'R', 'K'};
+/// The format version
+constexpr std::uint32_t s_version = 1;
+
+/// The number of start parameters per track
+constexpr std::size_t s_trackParameters = 6;
+
+/// The step columns, in storage order
+enum StepColumn : std::size_t {
+  eX = 0,
+  eY,
+  eZ,
+  eDirX,
+  eDirY,
+  eDirZ,
+  eLength,
+  eX0,
+  eL0,
+  eA,
+  eZnumber,
+  eRho,
+  eNumStepColumns
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = s_magic;
+  std::uint32_t version = s_version;
+  std::uint32_t reserved = 0;
+};
+
+struct BlockHeader {
+  std::uint64_t eventId = 0;
+  std::uint64_t nTracks = 0;
+  std::uint64_t nSteps = 0;
+  std::uint64_t reserved = 0;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(BlockHeader) == 32);
+
+/// The number of bytes of a block, including its header.
+///
+/// @return the block size or nothing if it can not be represented, e.g. for
+///         the corrupted header of a damaged file
+inline std::optional<std::size_t> blockSize(std::uint64_t nTracks,
+                                            std::uint64_t nSteps) {
+  constexpr std::uint64_t maxSize = std::numeric_limits<std::size_t>::max();
+  constexpr std::uint64_t fixedBytes =
+      sizeof(BlockHeader) + sizeof(std::uint64_t);
+  constexpr std::uint64_t trackBytes =
+      s_trackParameters * sizeof(float) + sizeof(std::uint64_t);
+  constexpr std::uint64_t stepBytes = eNumStepColumns * sizeof(float);
+
+  if (nTracks > (maxSize - fixedBytes) / trackBytes) {
+    return std::nullopt;
+  }
+  std::uint64_t size = fixedBytes + nTracks * trackBytes;
+  if (nSteps > (maxSize - size) / stepBytes) {
+    return std::nullopt;
+  }
+  return size + nSteps * stepBytes;
+}
+
+}  // namespace ActsExamples::BinaryMaterialTrackFormat
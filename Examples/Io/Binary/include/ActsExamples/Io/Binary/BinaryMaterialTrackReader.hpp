@@ -0,0 +1,85 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/MaterialTrackBatch.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+class MappedFile;
+
+/// @class BinaryMaterialTrackReader
+///
+/// @brief Reads material tracks from the columnar binary format
+///
+/// The input file is memory mapped once, each event hands out a batch of
+/// material track views pointing directly into the mapped columns. No
+/// per-step objects are created, the batches can be consumed by the
+/// CoreMaterialMapping algorithm. Reading is lock-free and can be done
+/// concurrently for different events.
+class BinaryMaterialTrackReader : public IReader {
+ public:
+  /// @brief The nested configuration struct
+  struct Config {
+    /// material track batch to write to the event store
+    std::string outputMaterialTrackBatch = "material-track-batch";
+    /// path of the input file
+    std::string filePath = "material-tracks.bin";
+  };
+
+  /// Constructor
+  /// @param config The Configuration struct
+  /// @param level The log level
+  BinaryMaterialTrackReader(const Config& config, Acts::Logging::Level level);
+
+  /// Framework name() method
+  std::string name() const override;
+
+  /// Return the available events range.
+  std::pair<std::size_t, std::size_t> availableEvents() const override;
+
+  /// Read out data from the input stream
+  ///
+  /// @param context The algorithm context
+  ProcessCode read(const ActsExamples::AlgorithmContext& context) override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The logger
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  /// The config class
+  Config m_cfg;
+
+  WriteDataHandle<MaterialTrackBatch> m_outputMaterialTrackBatch{
+      this, "OutputMaterialTrackBatch"};
+
+  /// The mapped input file, shared with the handed out batches
+  std::shared_ptr<const MappedFile> m_file;
+
+  /// Byte offsets of the event blocks, ordered by event number
+  std::vector<std::size_t> m_blockOffsets;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,82 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/MaterialInteraction.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// @class BinaryMaterialTrackWriter
+///
+/// Writes recorded material tracks into the columnar binary format described
+/// in BinaryMaterialTrackFormat.hpp, one block per event.
+///
+/// The format is designed to be read back with the memory mapped
+/// BinaryMaterialTrackReader without any per-step conversion.
+class BinaryMaterialTrackWriter
+    : public WriterT<
+          std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>> {
+ public:
+  struct Config {
+    /// material collection to write
+    std::string inputMaterialTracks = "material-tracks";
+    /// path of the output file
+    std::string filePath = "material-tracks.bin";
+  };
+
+  /// Constructor with
+  /// @param config configuration struct
+  /// @param level logging level
+  BinaryMaterialTrackWriter(const Config& config, Acts::Logging::Level level);
+
+  /// Virtual destructor
+  ~BinaryMaterialTrackWriter() override;
+
+  /// End-of-run hook, closes the output file
+  ProcessCode finalize() override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ protected:
+  /// @brief Write method called by the base class
+  /// @param [in] ctx is the algorithm context for event information
+  /// @param [in] materialTracks are the material tracks to be written
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const std::unordered_map<std::size_t,
+                                              Acts::RecordedMaterialTrack>&
+                         materialTracks) override;
+
+ private:
+  /// The config class
+  Config m_cfg;
+  /// mutex used to protect multi-threaded writes
+  std::mutex m_writeMutex;
+  /// The output file
+  std::ofstream m_outputFile;
+
+  /// Scratch buffers for the block columns, re-used from event to event
+  std::vector<float> m_tracks;
+  std::vector<std::uint64_t> m_offsets;
+  std::vector<float> m_columns;
+};
+
+}  // namespace ActsExamples
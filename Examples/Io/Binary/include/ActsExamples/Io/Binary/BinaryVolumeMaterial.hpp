@@ -0,0 +1,41 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/CompressedMaterialMap.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+
+/// Write a compressed volume material map to a file.
+///
+/// The encoded buffer is written as-is, see `Acts::CompressedMaterialMap`
+/// for the layout.
+///
+/// @param path is the path of the output file
+/// @param map is the map to be written
+/// @throws std::ios_base::failure if the file can not be written
+void writeCompressedMaterialMap(const std::string& path,
+                                const Acts::CompressedMaterialMap& map);
+
+/// Read a compressed volume material map from a file.
+///
+/// The file is memory mapped and the map is a view on the mapped pages, i.e.
+/// several processes reading the same file share the material data.
+///
+/// @param path is the path of the input file
+/// @param interpolate whether the map returns interpolated material
+/// @throws std::ios_base::failure if the file can not be mapped
+/// @throws std::invalid_argument if the file is not a valid map
+std::shared_ptr<const Acts::CompressedMaterialMap> readCompressedMaterialMap(
+    const std::string& path, bool interpolate = false);
+
+}  // namespace ActsExamples
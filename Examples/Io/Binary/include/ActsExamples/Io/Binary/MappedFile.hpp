@@ -0,0 +1,47 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace ActsExamples {
+
+/// Read-only memory mapping of a complete file.
+///
+/// The file content is exposed as a byte span, pages are loaded lazily by
+/// the operating system on first access. The mapping is released on
+/// destruction, all views into the data are invalidated with it.
+class MappedFile {
+ public:
+  /// Map the file at the given path.
+  ///
+  /// @param path is the path to the file to map
+  /// @throws std::ios_base::failure if the file can not be opened or mapped
+  explicit MappedFile(const std::string& path);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Unmap the file.
+  ~MappedFile();
+
+  /// The mapped file content, empty for an empty file.
+  std::span<const std::byte> data() const { return {m_data, m_size}; }
+
+  /// The size of the file in bytes.
+  std::size_t size() const { return m_size; }
+
+ private:
+  const std::byte* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+}  // namespace ActsExamples
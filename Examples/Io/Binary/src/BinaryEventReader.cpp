@@ -0,0 +1,360 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SubspaceHelpers.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFormat.hpp"
+#include "ActsExamples/Io/Binary/MappedFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+#include <boost/container/static_vector.hpp>
+
+namespace ActsExamples {
+
+namespace Format = BinaryEventFormat;
+
+namespace {
+
+SimHitContainer readSimHits(const Format::SectionHeader& header,
+                            Format::ColumnCursor& cursor) {
+  std::size_t n = header.nRows;
+  auto geometryIds = cursor.next<std::uint64_t>(n);
+  auto particleIds = cursor.next<std::uint64_t>(n);
+  auto indices = cursor.next<std::int32_t>(n);
+  auto vector4Columns = [&]() {
+    std::array<std::span<const double>, 4> columns;
+    for (auto& column : columns) {
+      column = cursor.next<double>(n);
+    }
+    return columns;
+  };
+  auto pos4 = vector4Columns();
+  auto before4 = vector4Columns();
+  auto after4 = vector4Columns();
+  auto vector4 = [](const auto& columns, std::size_t i) {
+    return Acts::Vector4(columns[0][i], columns[1][i], columns[2][i],
+                         columns[3][i]);
+  };
+
+  SimHitContainer::sequence_type hits;
+  hits.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    hits.emplace_back(Acts::GeometryIdentifier(geometryIds[i]),
+                      ActsFatras::Barcode(particleIds[i]),
+                      vector4(pos4, i), vector4(before4, i),
+                      vector4(after4, i), indices[i]);
+  }
+
+  // The hits are written in container order, which only needs to be
+  // verified instead of sorting them again
+  SimHitContainer container;
+  if (std::ranges::is_sorted(hits, container.value_comp())) {
+    container.adopt_sequence(boost::container::ordered_range,
+                             std::move(hits));
+  } else {
+    container.adopt_sequence(std::move(hits));
+  }
+  return container;
+}
+
+MeasurementContainer readMeasurements(const Format::SectionHeader& header,
+                                      Format::ColumnCursor& cursor) {
+  std::size_t n = header.nRows;
+  auto geometryIds = cursor.next<std::uint64_t>(n);
+  auto sizes = cursor.next<std::uint8_t>(n);
+
+  MeasurementContainer measurements;
+  measurements.m_entries.reserve(n);
+  measurements.m_geometryIds.reserve(n);
+  std::vector<IndexSourceLink> sourceLinks;
+  sourceLinks.reserve(n);
+  std::size_t nParameters = 0;
+  std::size_t nCovariances = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (sizes[i] > Acts::eBoundSize) {
+      throw std::ios_base::failure("Invalid measurement size");
+    }
+    Acts::GeometryIdentifier geometryId(geometryIds[i]);
+    measurements.m_entries.push_back(
+        {nParameters, nParameters, nCovariances, sizes[i]});
+    measurements.m_geometryIds.push_back(geometryId);
+    sourceLinks.emplace_back(geometryId, static_cast<Index>(i));
+    nParameters += sizes[i];
+    nCovariances += sizes[i] * sizes[i];
+  }
+
+  // The value arrays have the in-memory layout of the container
+  auto subspaceIndices = cursor.next<std::uint8_t>(nParameters);
+  auto parameters = cursor.next<double>(nParameters);
+  auto covariances = cursor.next<double>(nCovariances);
+  // The value ranges of all measurements are used without further checks
+  for (const auto& entry : measurements.m_entries) {
+    if (entry.subspaceIndexOffset + entry.size > subspaceIndices.size() ||
+        entry.parameterOffset + entry.size > parameters.size() ||
+        entry.covarianceOffset + entry.size * entry.size >
+            covariances.size()) {
+      throw std::ios_base::failure("Invalid measurement offsets");
+    }
+    if (!Acts::checkSubspaceIndices(
+            subspaceIndices.subspan(entry.subspaceIndexOffset, entry.size),
+            Acts::eBoundSize, entry.size)) {
+      throw std::ios_base::failure("Invalid measurement subspace indices");
+    }
+  }
+  measurements.m_subspaceIndices.assign(subspaceIndices.begin(),
+                                        subspaceIndices.end());
+  measurements.m_parameters.assign(parameters.begin(), parameters.end());
+  measurements.m_covariances.assign(covariances.begin(), covariances.end());
+  measurements.m_orderedIndices = MeasurementContainer::OrderedIndices(
+      sourceLinks.begin(), sourceLinks.end());
+  return measurements;
+}
+
+SimSpacePointContainer readSpacePoints(const Format::SectionHeader& header,
+                                       Format::ColumnCursor& cursor) {
+  std::size_t n = header.nRows;
+  auto x = cursor.next<double>(n);
+  auto y = cursor.next<double>(n);
+  auto z = cursor.next<double>(n);
+  auto t = cursor.next<double>(n);
+  auto varianceR = cursor.next<double>(n);
+  auto varianceZ = cursor.next<double>(n);
+  auto varianceT = cursor.next<double>(n);
+  auto nSourceLinks = cursor.next<std::uint8_t>(n);
+  std::array<std::span<const std::uint64_t>, 2> slGeometryIds;
+  std::array<std::span<const std::uint64_t>, 2> slIndices;
+  for (std::size_t is = 0; is < 2; ++is) {
+    slGeometryIds[is] = cursor.next<std::uint64_t>(n);
+    slIndices[is] = cursor.next<std::uint64_t>(n);
+  }
+  auto optional = [](double value) -> std::optional<double> {
+    return std::isnan(value) ? std::nullopt : std::optional<double>(value);
+  };
+
+  // The strip details columns are only present if any space point has them
+  bool stripDetails = (header.flags & Format::eStripDetails) != 0u;
+  std::span<const std::uint8_t> valid;
+  std::span<const float> topHalfStripLength;
+  std::span<const float> bottomHalfStripLength;
+  std::array<std::array<std::span<const double>, 3>, 4> stripVectors;
+  if (stripDetails) {
+    valid = cursor.next<std::uint8_t>(n);
+    topHalfStripLength = cursor.next<float>(n);
+    bottomHalfStripLength = cursor.next<float>(n);
+    for (auto& columns : stripVectors) {
+      for (auto& column : columns) {
+        column = cursor.next<double>(n);
+      }
+    }
+  }
+  auto stripVector = [&](std::size_t iv, std::size_t i) {
+    const auto& columns = stripVectors[iv];
+    return Acts::Vector3(columns[0][i], columns[1][i], columns[2][i]);
+  };
+
+  SimSpacePointContainer spacePoints;
+  spacePoints.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (nSourceLinks[i] > 2u) {
+      throw std::ios_base::failure("Invalid space point source links");
+    }
+    boost::container::static_vector<Acts::SourceLink, 2> sourceLinks;
+    for (std::size_t is = 0; is < nSourceLinks[i]; ++is) {
+      sourceLinks.emplace_back(
+          IndexSourceLink(Acts::GeometryIdentifier(slGeometryIds[is][i]),
+                          static_cast<Index>(slIndices[is][i])));
+    }
+    Acts::Vector3 position(x[i], y[i], z[i]);
+    if (stripDetails && valid[i] != 0u) {
+      spacePoints.emplace_back(
+          position, optional(t[i]), varianceR[i], varianceZ[i],
+          optional(varianceT[i]), std::move(sourceLinks),
+          topHalfStripLength[i], bottomHalfStripLength[i], stripVector(0, i),
+          stripVector(1, i), stripVector(2, i), stripVector(3, i));
+    } else {
+      spacePoints.emplace_back(position, optional(t[i]), varianceR[i],
+                               varianceZ[i], optional(varianceT[i]),
+                               std::move(sourceLinks));
+    }
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+BinaryEventReader::BinaryEventReader(const Config& config,
+                                     Acts::Logging::Level level)
+    : IReader(),
+      m_logger{Acts::getDefaultLogger(name(), level)},
+      m_cfg(config) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.outputSimHits.empty() && m_cfg.outputMeasurements.empty() &&
+      m_cfg.outputSpacePoints.empty()) {
+    throw std::invalid_argument("Missing output collections");
+  }
+  m_outputSimHits.maybeInitialize(m_cfg.outputSimHits);
+  m_outputMeasurements.maybeInitialize(m_cfg.outputMeasurements);
+  m_outputSpacePoints.maybeInitialize(m_cfg.outputSpacePoints);
+
+  m_file = std::make_shared<const MappedFile>(m_cfg.filePath);
+  std::span<const std::byte> data = m_file->data();
+
+  Format::FileHeader fileHeader;
+  if (data.size() < sizeof(fileHeader)) {
+    throw std::ios_base::failure("Invalid event file '" + m_cfg.filePath +
+                                 "'");
+  }
+  std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+  if (fileHeader.magic != Format::s_magic ||
+      fileHeader.version != Format::s_version) {
+    throw std::ios_base::failure("Invalid event file '" + m_cfg.filePath +
+                                 "'");
+  }
+
+  // Index the event blocks, they are stored in the order they were written
+  std::vector<std::pair<std::uint64_t, std::size_t>> blocks;
+  std::size_t offset = sizeof(fileHeader);
+  while (offset < data.size()) {
+    Format::BlockHeader blockHeader;
+    if (data.size() - offset < sizeof(blockHeader)) {
+      throw std::ios_base::failure("Truncated event file '" + m_cfg.filePath +
+                                   "'");
+    }
+    std::memcpy(&blockHeader, data.data() + offset, sizeof(blockHeader));
+    if (blockHeader.nBytes < sizeof(blockHeader) ||
+        blockHeader.nBytes % 8u != 0u ||
+        data.size() - offset < blockHeader.nBytes) {
+      throw std::ios_base::failure("Truncated event file '" + m_cfg.filePath +
+                                   "'");
+    }
+    blocks.emplace_back(blockHeader.eventId, offset);
+    offset += blockHeader.nBytes;
+  }
+  std::ranges::sort(blocks);
+  m_blockOffsets.reserve(blocks.size());
+  for (const auto& [eventId, blockOffset] : blocks) {
+    m_blockOffsets.push_back(blockOffset);
+  }
+
+  ACTS_DEBUG("Indexed " << m_blockOffsets.size() << " events in '"
+                        << m_cfg.filePath << "'");
+}
+
+std::string BinaryEventReader::name() const {
+  return "BinaryEventReader";
+}
+
+std::pair<std::size_t, std::size_t> BinaryEventReader::availableEvents()
+    const {
+  return {0u, m_blockOffsets.size()};
+}
+
+ProcessCode BinaryEventReader::read(const AlgorithmContext& context) {
+  if (context.eventNumber >= m_blockOffsets.size()) {
+    ACTS_ERROR("Event " << context.eventNumber << " is not available in '"
+                        << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+
+  // The block layout, see BinaryEventFormat.hpp
+  std::span<const std::byte> block =
+      m_file->data().subspan(m_blockOffsets[context.eventNumber]);
+  Format::BlockHeader blockHeader;
+  std::memcpy(&blockHeader, block.data(), sizeof(blockHeader));
+  block = block.subspan(0, blockHeader.nBytes);
+
+  std::optional<SimHitContainer> simHits;
+  std::optional<MeasurementContainer> measurements;
+  std::optional<SimSpacePointContainer> spacePoints;
+  std::size_t offset = sizeof(blockHeader);
+  for (std::size_t is = 0; is < blockHeader.nSections; ++is) {
+    Format::SectionHeader header;
+    if (block.size() - offset < sizeof(header)) {
+      ACTS_ERROR("Truncated event " << context.eventNumber << " in '"
+                                    << m_cfg.filePath << "'");
+      return ProcessCode::ABORT;
+    }
+    std::memcpy(&header, block.data() + offset, sizeof(header));
+    offset += sizeof(header);
+    if (header.nBytes % 8u != 0u || block.size() - offset < header.nBytes) {
+      ACTS_ERROR("Truncated event " << context.eventNumber << " in '"
+                                    << m_cfg.filePath << "'");
+      return ProcessCode::ABORT;
+    }
+    Format::ColumnCursor cursor(block.subspan(offset, header.nBytes));
+    offset += header.nBytes;
+
+    // Only decode the requested collections
+    try {
+      if (header.kind == Format::SectionKind::eSimHits &&
+          m_outputSimHits.isInitialized()) {
+        simHits = readSimHits(header, cursor);
+      } else if (header.kind == Format::SectionKind::eMeasurements &&
+                 m_outputMeasurements.isInitialized()) {
+        measurements = readMeasurements(header, cursor);
+      } else if (header.kind == Format::SectionKind::eSpacePoints &&
+                 m_outputSpacePoints.isInitialized()) {
+        spacePoints = readSpacePoints(header, cursor);
+      }
+    } catch (const std::ios_base::failure& e) {
+      ACTS_ERROR("Invalid event " << context.eventNumber << " in '"
+                                  << m_cfg.filePath << "': " << e.what());
+      return ProcessCode::ABORT;
+    }
+  }
+
+  auto missing = [&](const char* collection) {
+    ACTS_ERROR("No " << collection << " stored for event "
+                     << context.eventNumber << " in '" << m_cfg.filePath
+                     << "'");
+    return ProcessCode::ABORT;
+  };
+  if (m_outputSimHits.isInitialized()) {
+    if (!simHits.has_value()) {
+      return missing("simulated hits");
+    }
+    ACTS_VERBOSE("Read " << simHits->size() << " simulated hits");
+    m_outputSimHits(context, std::move(*simHits));
+  }
+  if (m_outputMeasurements.isInitialized()) {
+    if (!measurements.has_value()) {
+      return missing("measurements");
+    }
+    ACTS_VERBOSE("Read " << measurements->size() << " measurements");
+    m_outputMeasurements(context, std::move(*measurements));
+  }
+  if (m_outputSpacePoints.isInitialized()) {
+    if (!spacePoints.has_value()) {
+      return missing("space points");
+    }
+    ACTS_VERBOSE("Read " << spacePoints->size() << " space points");
+    m_outputSpacePoints(context, std::move(*spacePoints));
+  }
+
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
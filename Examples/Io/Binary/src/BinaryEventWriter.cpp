@@ -0,0 +1,279 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ActsExamples {
+
+namespace Format = BinaryEventFormat;
+
+namespace {
+
+template <typename T>
+void appendColumn(std::vector<std::byte>& buffer, const std::vector<T>& col) {
+  Format::appendColumn(buffer, std::span<const T>(col));
+}
+
+/// Append a section to the block buffer, the columns are filled by the
+/// given function
+template <typename fill_t>
+void appendSection(std::vector<std::byte>& buffer, Format::SectionKind kind,
+                   std::uint32_t flags, std::size_t nRows, fill_t&& fill) {
+  std::size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(Format::SectionHeader));
+  fill(buffer);
+
+  Format::SectionHeader header;
+  header.kind = kind;
+  header.flags = flags;
+  header.nRows = nRows;
+  header.nBytes = buffer.size() - offset - sizeof(header);
+  std::memcpy(buffer.data() + offset, &header, sizeof(header));
+}
+
+void appendSimHits(std::vector<std::byte>& buffer,
+                   const SimHitContainer& hits) {
+  std::size_t n = hits.size();
+  appendSection(buffer, Format::SectionKind::eSimHits, 0, n, [&](auto& out) {
+    std::vector<std::uint64_t> ids;
+    ids.reserve(n);
+    for (const SimHit& hit : hits) {
+      ids.push_back(hit.geometryId().value());
+    }
+    appendColumn(out, ids);
+    ids.clear();
+    for (const SimHit& hit : hits) {
+      ids.push_back(hit.particleId().value());
+    }
+    appendColumn(out, ids);
+
+    std::vector<std::int32_t> indices;
+    indices.reserve(n);
+    for (const SimHit& hit : hits) {
+      indices.push_back(hit.index());
+    }
+    appendColumn(out, indices);
+
+    std::vector<double> column(n);
+    auto appendVector4 = [&](auto&& get) {
+      for (int i = 0; i < 4; ++i) {
+        std::size_t ih = 0;
+        for (const SimHit& hit : hits) {
+          column[ih++] = get(hit)[i];
+        }
+        appendColumn(out, column);
+      }
+    };
+    appendVector4([](const SimHit& hit) { return hit.fourPosition(); });
+    appendVector4([](const SimHit& hit) { return hit.momentum4Before(); });
+    appendVector4([](const SimHit& hit) { return hit.momentum4After(); });
+  });
+}
+
+void appendMeasurements(std::vector<std::byte>& buffer,
+                        const MeasurementContainer& measurements) {
+  std::size_t n = measurements.size();
+  appendSection(
+      buffer, Format::SectionKind::eMeasurements, 0, n, [&](auto& out) {
+        std::vector<std::uint64_t> ids;
+        ids.reserve(n);
+        for (Acts::GeometryIdentifier geoId : measurements.m_geometryIds) {
+          ids.push_back(geoId.value());
+        }
+        appendColumn(out, ids);
+
+        std::vector<std::uint8_t> sizes;
+        sizes.reserve(n);
+        for (const auto& entry : measurements.m_entries) {
+          sizes.push_back(entry.size);
+        }
+        appendColumn(out, sizes);
+
+        // The flat value arrays are stored as they are in memory
+        appendColumn(out, measurements.m_subspaceIndices);
+        appendColumn(out, measurements.m_parameters);
+        appendColumn(out, measurements.m_covariances);
+      });
+}
+
+void appendSpacePoints(std::vector<std::byte>& buffer,
+                       const SimSpacePointContainer& spacePoints) {
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  std::size_t n = spacePoints.size();
+  bool stripDetails = false;
+  for (const SimSpacePoint& sp : spacePoints) {
+    stripDetails = stripDetails || sp.validDoubleMeasurementDetails();
+  }
+  std::uint32_t flags = stripDetails ? Format::eStripDetails : 0u;
+
+  appendSection(
+      buffer, Format::SectionKind::eSpacePoints, flags, n, [&](auto& out) {
+        std::vector<double> column(n);
+        auto appendDouble = [&](auto&& get) {
+          for (std::size_t i = 0; i < n; ++i) {
+            column[i] = get(spacePoints[i]);
+          }
+          appendColumn(out, column);
+        };
+        appendDouble([](const SimSpacePoint& sp) { return sp.x(); });
+        appendDouble([](const SimSpacePoint& sp) { return sp.y(); });
+        appendDouble([](const SimSpacePoint& sp) { return sp.z(); });
+        appendDouble(
+            [&](const SimSpacePoint& sp) { return sp.t().value_or(nan); });
+        appendDouble([](const SimSpacePoint& sp) { return sp.varianceR(); });
+        appendDouble([](const SimSpacePoint& sp) { return sp.varianceZ(); });
+        appendDouble([&](const SimSpacePoint& sp) {
+          return sp.varianceT().value_or(nan);
+        });
+
+        std::vector<std::uint8_t> bytes(n);
+        for (std::size_t i = 0; i < n; ++i) {
+          bytes[i] =
+              static_cast<std::uint8_t>(spacePoints[i].sourceLinks().size());
+        }
+        appendColumn(out, bytes);
+
+        std::vector<std::uint64_t> ids(n);
+        std::vector<std::uint64_t> indices(n);
+        for (std::size_t is = 0; is < 2; ++is) {
+          for (std::size_t i = 0; i < n; ++i) {
+            const auto& sourceLinks = spacePoints[i].sourceLinks();
+            IndexSourceLink sl;
+            if (is < sourceLinks.size()) {
+              sl = sourceLinks[is].get<IndexSourceLink>();
+            }
+            ids[i] = sl.geometryId().value();
+            indices[i] = sl.index();
+          }
+          appendColumn(out, ids);
+          appendColumn(out, indices);
+        }
+
+        if (!stripDetails) {
+          return;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+          bytes[i] = spacePoints[i].validDoubleMeasurementDetails() ? 1u : 0u;
+        }
+        appendColumn(out, bytes);
+        std::vector<float> lengths(n);
+        for (std::size_t i = 0; i < n; ++i) {
+          lengths[i] = spacePoints[i].topHalfStripLength();
+        }
+        appendColumn(out, lengths);
+        for (std::size_t i = 0; i < n; ++i) {
+          lengths[i] = spacePoints[i].bottomHalfStripLength();
+        }
+        appendColumn(out, lengths);
+        auto appendVector3 = [&](auto&& get) {
+          for (int j = 0; j < 3; ++j) {
+            appendDouble([&](const SimSpacePoint& sp) { return get(sp)[j]; });
+          }
+        };
+        appendVector3(
+            [](const SimSpacePoint& sp) { return sp.topStripDirection(); });
+        appendVector3(
+            [](const SimSpacePoint& sp) { return sp.bottomStripDirection(); });
+        appendVector3(
+            [](const SimSpacePoint& sp) { return sp.stripCenterDistance(); });
+        appendVector3([](const SimSpacePoint& sp) {
+          return sp.topStripCenterPosition();
+        });
+      });
+}
+
+}  // namespace
+
+BinaryEventWriter::BinaryEventWriter(const Config& config,
+                                     Acts::Logging::Level level)
+    : m_cfg(config), m_logger(Acts::getDefaultLogger(name(), level)) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.inputSimHits.empty() && m_cfg.inputMeasurements.empty() &&
+      m_cfg.inputSpacePoints.empty()) {
+    throw std::invalid_argument("Missing input collections");
+  }
+  m_inputSimHits.maybeInitialize(m_cfg.inputSimHits);
+  m_inputMeasurements.maybeInitialize(m_cfg.inputMeasurements);
+  m_inputSpacePoints.maybeInitialize(m_cfg.inputSpacePoints);
+
+  m_outputFile.open(m_cfg.filePath, std::ios::binary | std::ios::trunc);
+  if (!m_outputFile) {
+    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
+  }
+  Format::FileHeader header;
+  m_outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+BinaryEventWriter::~BinaryEventWriter() {
+  if (m_outputFile.is_open()) {
+    m_outputFile.close();
+  }
+}
+
+std::string BinaryEventWriter::name() const {
+  return "BinaryEventWriter";
+}
+
+ProcessCode BinaryEventWriter::finalize() {
+  ACTS_INFO("Writing binary output File : " << m_cfg.filePath);
+  m_outputFile.close();
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode BinaryEventWriter::write(const AlgorithmContext& ctx) {
+  // Encode the complete block before taking the lock
+  std::vector<std::byte> block(sizeof(Format::BlockHeader));
+  Format::BlockHeader header;
+  header.eventId = ctx.eventNumber;
+  if (m_inputSimHits.isInitialized()) {
+    appendSimHits(block, m_inputSimHits(ctx));
+    ++header.nSections;
+  }
+  if (m_inputMeasurements.isInitialized()) {
+    appendMeasurements(block, m_inputMeasurements(ctx));
+    ++header.nSections;
+  }
+  if (m_inputSpacePoints.isInitialized()) {
+    appendSpacePoints(block, m_inputSpacePoints(ctx));
+    ++header.nSections;
+  }
+  header.nBytes = block.size();
+  std::memcpy(block.data(), &header, sizeof(header));
+
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_outputFile.write(reinterpret_cast<const char*>(block.data()),
+                     block.size());
+  if (!m_outputFile) {
+    ACTS_ERROR("Could not write event " << ctx.eventNumber << " to '"
+                                        << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+
+  ACTS_DEBUG("Wrote " << header.nSections << " collections with "
+                      << header.nBytes << " bytes for event "
+                      << ctx.eventNumber);
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,161 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackReader.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackFormat.hpp"
+#include "ActsExamples/Io/Binary/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+namespace ActsExamples {
+
+namespace Format = BinaryMaterialTrackFormat;
+
+BinaryMaterialTrackReader::BinaryMaterialTrackReader(
+    const Config& config, Acts::Logging::Level level)
+    : IReader(),
+      m_logger{Acts::getDefaultLogger(name(), level)},
+      m_cfg(config) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  m_outputMaterialTrackBatch.initialize(m_cfg.outputMaterialTrackBatch);
+
+  m_file = std::make_shared<const MappedFile>(m_cfg.filePath);
+  std::span<const std::byte> data = m_file->data();
+
+  Format::FileHeader fileHeader;
+  if (data.size() < sizeof(fileHeader)) {
+    throw std::ios_base::failure("Invalid material track file '" +
+                                 m_cfg.filePath + "'");
+  }
+  std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+  if (fileHeader.magic != Format::s_magic ||
+      fileHeader.version != Format::s_version) {
+    throw std::ios_base::failure("Invalid material track file '" +
+                                 m_cfg.filePath + "'");
+  }
+
+  // Index the event blocks, they are stored in the order they were written
+  std::vector<std::pair<std::uint64_t, std::size_t>> blocks;
+  std::size_t offset = sizeof(fileHeader);
+  while (offset < data.size()) {
+    Format::BlockHeader blockHeader;
+    if (data.size() - offset < sizeof(blockHeader)) {
+      throw std::ios_base::failure("Truncated material track file '" +
+                                   m_cfg.filePath + "'");
+    }
+    std::memcpy(&blockHeader, data.data() + offset, sizeof(blockHeader));
+    std::optional<std::size_t> size =
+        Format::blockSize(blockHeader.nTracks, blockHeader.nSteps);
+    if (!size.has_value() || data.size() - offset < *size) {
+      throw std::ios_base::failure("Truncated material track file '" +
+                                   m_cfg.filePath + "'");
+    }
+    // The step ranges are used without further checks when reading
+    const std::byte* offsets = data.data() + offset + sizeof(blockHeader) +
+                               Format::s_trackParameters *
+                                   blockHeader.nTracks * sizeof(float);
+    std::uint64_t previous = 0;
+    for (std::size_t it = 0; it <= blockHeader.nTracks; ++it) {
+      std::uint64_t current = 0;
+      std::memcpy(&current, offsets + it * sizeof(current), sizeof(current));
+      if (current < previous || current > blockHeader.nSteps) {
+        throw std::ios_base::failure("Corrupted material track file '" +
+                                     m_cfg.filePath + "'");
+      }
+      previous = current;
+    }
+    blocks.emplace_back(blockHeader.eventId, offset);
+    offset += *size;
+  }
+  std::ranges::sort(blocks);
+  m_blockOffsets.reserve(blocks.size());
+  for (const auto& [eventId, blockOffset] : blocks) {
+    m_blockOffsets.push_back(blockOffset);
+  }
+
+  ACTS_DEBUG("Indexed " << m_blockOffsets.size() << " events in '"
+                        << m_cfg.filePath << "'");
+}
+
+std::string BinaryMaterialTrackReader::name() const {
+  return "BinaryMaterialTrackReader";
+}
+
+std::pair<std::size_t, std::size_t>
+BinaryMaterialTrackReader::availableEvents() const {
+  return {0u, m_blockOffsets.size()};
+}
+
+ProcessCode BinaryMaterialTrackReader::read(const AlgorithmContext& context) {
+  if (context.eventNumber >= m_blockOffsets.size()) {
+    ACTS_ERROR("Event " << context.eventNumber << " is not available in '"
+                        << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+
+  // The block layout, see BinaryMaterialTrackFormat.hpp. The block size and
+  // the step ranges were validated when indexing the file.
+  const std::byte* block =
+      m_file->data().data() + m_blockOffsets[context.eventNumber];
+  Format::BlockHeader blockHeader;
+  std::memcpy(&blockHeader, block, sizeof(blockHeader));
+  const auto* tracks =
+      reinterpret_cast<const float*>(block + sizeof(blockHeader));
+  const auto* offsets = reinterpret_cast<const std::uint64_t*>(
+      tracks + Format::s_trackParameters * blockHeader.nTracks);
+  const auto* columns =
+      reinterpret_cast<const float*>(offsets + blockHeader.nTracks + 1);
+
+  MaterialTrackBatch batch;
+  batch.storage = m_file;
+  batch.tracks.reserve(blockHeader.nTracks);
+  for (std::size_t it = 0; it < blockHeader.nTracks; ++it) {
+    const float* start = tracks + Format::s_trackParameters * it;
+    std::size_t first = offsets[it];
+    std::size_t nSteps = offsets[it + 1] - first;
+    auto column = [&](Format::StepColumn col) {
+      return std::span<const float>(
+          columns + col * blockHeader.nSteps + first, nSteps);
+    };
+
+    Acts::MaterialTrackView& mtView = batch.tracks.emplace_back();
+    mtView.position = Acts::Vector3(start[0], start[1], start[2]);
+    mtView.momentum = Acts::Vector3(start[3], start[4], start[5]);
+    mtView.x = column(Format::eX);
+    mtView.y = column(Format::eY);
+    mtView.z = column(Format::eZ);
+    mtView.dx = column(Format::eDirX);
+    mtView.dy = column(Format::eDirY);
+    mtView.dz = column(Format::eDirZ);
+    mtView.length = column(Format::eLength);
+    mtView.X0 = column(Format::eX0);
+    mtView.L0 = column(Format::eL0);
+    mtView.A = column(Format::eA);
+    mtView.Z = column(Format::eZnumber);
+    mtView.rho = column(Format::eRho);
+  }
+
+  ACTS_VERBOSE("Read " << batch.tracks.size() << " material tracks with "
+                       << blockHeader.nSteps << " steps");
+  m_outputMaterialTrackBatch(context, std::move(batch));
+
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
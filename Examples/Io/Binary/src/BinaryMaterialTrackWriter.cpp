@@ -0,0 +1,133 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackWriter.hpp"
+
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackFormat.hpp"
+
+#include <algorithm>
+#include <ios>
+#include <stdexcept>
+
+namespace ActsExamples {
+
+namespace Format = BinaryMaterialTrackFormat;
+
+BinaryMaterialTrackWriter::BinaryMaterialTrackWriter(
+    const BinaryMaterialTrackWriter::Config& config, Acts::Logging::Level level)
+    : WriterT(config.inputMaterialTracks, "BinaryMaterialTrackWriter", level),
+      m_cfg(config) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+
+  m_outputFile.open(m_cfg.filePath, std::ios::binary | std::ios::trunc);
+  if (!m_outputFile) {
+    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
+  }
+  Format::FileHeader header;
+  m_outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+BinaryMaterialTrackWriter::~BinaryMaterialTrackWriter() {
+  if (m_outputFile.is_open()) {
+    m_outputFile.close();
+  }
+}
+
+ProcessCode BinaryMaterialTrackWriter::finalize() {
+  ACTS_INFO("Writing binary output File : " << m_cfg.filePath);
+  m_outputFile.close();
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode BinaryMaterialTrackWriter::writeT(
+    const AlgorithmContext& ctx,
+    const std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>&
+        materialTracks) {
+  // Exclusive access to the file and the scratch buffers
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+
+  // Write the tracks in a reproducible order
+  std::vector<std::size_t> trackIds;
+  trackIds.reserve(materialTracks.size());
+  for (const auto& [trackId, mtrack] : materialTracks) {
+    trackIds.push_back(trackId);
+  }
+  std::ranges::sort(trackIds);
+
+  // Fill the track table and the step offsets
+  m_tracks.clear();
+  m_offsets.assign(1u, 0u);
+  for (std::size_t trackId : trackIds) {
+    const auto& [startParameters, recordedMaterial] =
+        materialTracks.at(trackId);
+    const auto& [position, momentum] = startParameters;
+    for (int i = 0; i < 3; ++i) {
+      m_tracks.push_back(static_cast<float>(position[i]));
+    }
+    for (int i = 0; i < 3; ++i) {
+      m_tracks.push_back(static_cast<float>(momentum[i]));
+    }
+    m_offsets.push_back(m_offsets.back() +
+                        recordedMaterial.materialInteractions.size());
+  }
+
+  // Fill the step columns
+  std::uint64_t nSteps = m_offsets.back();
+  m_columns.resize(Format::eNumStepColumns * nSteps);
+  auto column = [&](Format::StepColumn col) {
+    return m_columns.begin() + col * nSteps;
+  };
+  std::size_t is = 0;
+  for (std::size_t trackId : trackIds) {
+    const auto& recordedMaterial = materialTracks.at(trackId).second;
+    for (const auto& mint : recordedMaterial.materialInteractions) {
+      const Acts::Material& material = mint.materialSlab.material();
+      column(Format::eX)[is] = static_cast<float>(mint.position.x());
+      column(Format::eY)[is] = static_cast<float>(mint.position.y());
+      column(Format::eZ)[is] = static_cast<float>(mint.position.z());
+      column(Format::eDirX)[is] = static_cast<float>(mint.direction.x());
+      column(Format::eDirY)[is] = static_cast<float>(mint.direction.y());
+      column(Format::eDirZ)[is] = static_cast<float>(mint.direction.z());
+      column(Format::eLength)[is] = mint.materialSlab.thickness();
+      column(Format::eX0)[is] = material.X0();
+      column(Format::eL0)[is] = material.L0();
+      column(Format::eA)[is] = material.Ar();
+      column(Format::eZnumber)[is] = material.Z();
+      column(Format::eRho)[is] = material.massDensity();
+      ++is;
+    }
+  }
+
+  Format::BlockHeader header;
+  header.eventId = ctx.eventNumber;
+  header.nTracks = trackIds.size();
+  header.nSteps = nSteps;
+  m_outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  m_outputFile.write(reinterpret_cast<const char*>(m_tracks.data()),
+                     m_tracks.size() * sizeof(float));
+  m_outputFile.write(reinterpret_cast<const char*>(m_offsets.data()),
+                     m_offsets.size() * sizeof(std::uint64_t));
+  m_outputFile.write(reinterpret_cast<const char*>(m_columns.data()),
+                     m_columns.size() * sizeof(float));
+  if (!m_outputFile) {
+    ACTS_ERROR("Could not write event " << ctx.eventNumber << " to '"
+                                        << m_cfg.filePath << "'");
+    return ProcessCode::ABORT;
+  }
+
+  ACTS_DEBUG("Wrote " << header.nTracks << " material tracks with " << nSteps
+                      << " steps for event " << ctx.eventNumber);
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,38 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryVolumeMaterial.hpp"
+
+#include "ActsExamples/Io/Binary/MappedFile.hpp"
+
+#include <fstream>
+#include <ios>
+#include <span>
+
+void ActsExamples::writeCompressedMaterialMap(
+    const std::string& path, const Acts::CompressedMaterialMap& map) {
+  std::ofstream outputFile(path, std::ios::binary | std::ios::trunc);
+  if (!outputFile) {
+    throw std::ios_base::failure("Could not open '" + path + "' to write");
+  }
+  std::span<const std::byte> buffer = map.buffer();
+  outputFile.write(reinterpret_cast<const char*>(buffer.data()),
+                   static_cast<std::streamsize>(buffer.size()));
+  if (!outputFile) {
+    throw std::ios_base::failure("Could not write '" + path + "'");
+  }
+}
+
+std::shared_ptr<const Acts::CompressedMaterialMap>
+ActsExamples::readCompressedMaterialMap(const std::string& path,
+                                        bool interpolate) {
+  auto file = std::make_shared<const MappedFile>(path);
+  std::span<const std::byte> data = file->data();
+  return std::make_shared<const Acts::CompressedMaterialMap>(
+      data, std::move(file), interpolate);
+}
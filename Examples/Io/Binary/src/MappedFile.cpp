@@ -0,0 +1,49 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/MappedFile.hpp"
+
+#include <ios>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ActsExamples::MappedFile::MappedFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::ios_base::failure("Could not open '" + path + "' to read");
+  }
+  struct stat fileStat{};
+  if (::fstat(fd, &fileStat) != 0) {
+    ::close(fd);
+    throw std::ios_base::failure("Could not stat '" + path + "'");
+  }
+  m_size = static_cast<std::size_t>(fileStat.st_size);
+  // an empty file can not be mapped, its content is an empty span. The
+  // readers reject it as it lacks the file header.
+  if (m_size > 0) {
+    void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      ::close(fd);
+      throw std::ios_base::failure("Could not map '" + path + "'");
+    }
+    // files are usually read front-to-back, let the kernel read ahead
+    ::madvise(addr, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const std::byte*>(addr);
+  }
+  // the mapping stays valid after the descriptor is closed
+  ::close(fd);
+}
+
+ActsExamples::MappedFile::~MappedFile() {
+  if (m_data != nullptr) {
+    ::munmap(const_cast<std::byte*>(m_data), m_size);
+  }
+}
@@ -8,11 +8,11 @@
 
 #pragma once
 
+#include "Acts/EventData/ParticleHypothesis.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Io/EDM4hep/EDM4hepOutputConverter.hpp"
 #include "ActsExamples/Io/Podio/CollectionBaseWriteHandle.hpp"
-#include "ActsFatras/EventData/Barcode.hpp"
 
 #include <string>
 
@@ -34,8 +34,6 @@ class EDM4hepMultiTrajectoryOutputConverter : public EDM4hepOutputConverter {
   struct Config {
     /// Input trajectory collection
     std::string inputTrajectories;
-    /// Input hit-particles map collection
-    std::string inputMeasurementParticlesMap;
     /// Where to place output file
     std::string outputTracks;
     /// B field in the longitudinal direction
@@ -43,6 +41,9 @@ class EDM4hepMultiTrajectoryOutputConverter : public EDM4hepOutputConverter {
     /// Particle hypothesis
     Acts::ParticleHypothesis particleHypothesis =
         Acts::ParticleHypothesis::pion();
+    /// Convert the trajectories of one event in parallel. The collection is
+    /// always filled sequentially afterwards.
+    bool parallelizeOverTracks = false;
   };
 
   /// constructor
@@ -65,9 +66,6 @@ class EDM4hepMultiTrajectoryOutputConverter : public EDM4hepOutputConverter {
  private:
   Config m_cfg;
 
-  ReadDataHandle<IndexMultimap<ActsFatras::Barcode>>
-      m_inputMeasurementParticlesMap{this, "InputMeasurementParticlesMaps"};
-
   ReadDataHandle<TrajectoriesContainer> m_inputTrajectories{
       this, "InputTrajectories"};
 
@@ -32,6 +32,9 @@ class EDM4hepTrackOutputConverter : public EDM4hepOutputConverter {
     /// Magnetic field along the z axis (needed for the conversion of
     /// parameters)
     double Bz;
+    /// Convert the tracks of one event in parallel. The collection is always
+    /// filled sequentially afterwards.
+    bool parallelizeOverTracks = false;
   };
 
   /// constructor
@@ -15,7 +15,10 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <vector>
 
 #include <edm4hep/MCParticle.h>
 #include <edm4hep/MutableMCParticle.h>
@@ -23,6 +26,7 @@
 #include <edm4hep/MutableTrack.h>
 #include <edm4hep/MutableTrackerHitPlane.h>
 #include <edm4hep/SimTrackerHit.h>
+#include <edm4hep/TrackState.h>
 #include <edm4hep/TrackerHitPlane.h>
 
 namespace ActsExamples::EDM4hepUtil {
@@ -109,6 +113,25 @@ void writeMeasurement(const ConstVariableBoundMeasurementProxy& from,
                       edm4hep::TrackerHit3DCollection& toClusters,
                       const MapGeometryIdTo& geometryMapper);
 
+/// Track level quantities and track states of a converted trajectory.
+struct ConvertedTrajectory {
+  float chi2 = 0;
+  std::int32_t ndf = 0;
+  std::vector<edm4hep::TrackState> trackStates;
+};
+
+/// Converts a trajectory without touching any podio collection.
+///
+/// This can be called concurrently for different trajectories, the result is
+/// filled into a collection with `writeTrajectory`.
+ConvertedTrajectory convertTrajectory(
+    const Acts::GeometryContext& gctx, double Bz, const Trajectories& from,
+    std::size_t fromIndex, const Acts::ParticleHypothesis& particleHypothesis);
+
+/// Writes a converted trajectory to EDM4hep.
+void writeTrajectory(const ConvertedTrajectory& from,
+                     edm4hep::MutableTrack to);
+
 /// Writes a trajectory to EDM4hep.
 ///
 /// Inpersistent information:
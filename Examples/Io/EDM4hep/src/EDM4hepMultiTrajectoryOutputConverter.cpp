@@ -9,12 +9,14 @@
 #include "ActsExamples/Io/EDM4hep/EDM4hepMultiTrajectoryOutputConverter.hpp"
 
 #include "ActsExamples/Io/EDM4hep/EDM4hepUtil.hpp"
-#include "ActsExamples/Validation/TrackClassification.hpp"
 
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <edm4hep/TrackCollection.h>
-#include <podio/Frame.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 namespace ActsExamples {
 
@@ -27,37 +29,52 @@ EDM4hepMultiTrajectoryOutputConverter::EDM4hepMultiTrajectoryOutputConverter(
     throw std::invalid_argument("Missing input trajectories collection");
   }
 
-  if (m_cfg.inputMeasurementParticlesMap.empty()) {
-    throw std::invalid_argument{"Missing input hit to particle map"};
-  }
-
   if (m_cfg.outputTracks.empty()) {
     throw std::invalid_argument("Missing output tracks collection");
   }
 
-  m_inputMeasurementParticlesMap.initialize(m_cfg.inputMeasurementParticlesMap);
   m_outputTracks.initialize(m_cfg.outputTracks);
   m_inputTrajectories.initialize(m_cfg.inputTrajectories);
 }
 
 ProcessCode EDM4hepMultiTrajectoryOutputConverter::execute(
     const AlgorithmContext& context) const {
-  podio::Frame frame{};
-
-  const auto& hitParticlesMap = m_inputMeasurementParticlesMap(context);
   const auto& trajectories = m_inputTrajectories(context);
 
-  edm4hep::TrackCollection trackCollection;
-
+  // Flatten the trajectories, the conversion is done for all of them before
+  // the collection is filled in one pass
+  std::vector<std::pair<const Trajectories*, std::size_t>> tips;
   for (const auto& from : trajectories) {
     for (const auto& trackTip : from.tips()) {
-      auto to = trackCollection.create();
-      EDM4hepUtil::writeTrajectory(context.geoContext, m_cfg.Bz, from, to,
-                                   trackTip, m_cfg.particleHypothesis,
-                                   hitParticlesMap);
+      tips.emplace_back(&from, trackTip);
     }
   }
 
+  std::vector<EDM4hepUtil::ConvertedTrajectory> converted(tips.size());
+  auto convert = [&](std::size_t i) {
+    converted[i] = EDM4hepUtil::convertTrajectory(
+        context.geoContext, m_cfg.Bz, *tips[i].first, tips[i].second,
+        m_cfg.particleHypothesis);
+  };
+  if (m_cfg.parallelizeOverTracks) {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, tips.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        for (std::size_t i = range.begin(); i != range.end();
+                             ++i) {
+                          convert(i);
+                        }
+                      });
+  } else {
+    for (std::size_t i = 0; i < tips.size(); ++i) {
+      convert(i);
+    }
+  }
+
+  edm4hep::TrackCollection trackCollection;
+  for (const auto& from : converted) {
+    EDM4hepUtil::writeTrajectory(from, trackCollection.create());
+  }
+
   m_outputTracks(context, std::move(trackCollection));
 
   return ProcessCode::SUCCESS;
@@ -21,9 +21,13 @@
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <iomanip>
-#include <map>
+#include <iterator>
+#include <numeric>
 #include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 #include <DD4hep/Detector.h>
 #include <edm4hep/MCParticle.h>
@@ -386,6 +390,8 @@ ProcessCode EDM4hepSimInputConverter::convert(const AlgorithmContext& ctx,
   std::vector<SimHit> simHitsUnordered;
   ACTS_DEBUG("Reading sim hits from " << m_cfg.inputSimHits.size()
                                       << " sim hit collections");
+  // Hits in the same cell share the detector element lookup
+  std::unordered_map<std::uint64_t, Acts::GeometryIdentifier> cellGeometryIds;
   for (const auto& name : m_cfg.inputSimHits) {
     const auto& inputHits = frame.get<edm4hep::SimTrackerHitCollection>(name);
 
@@ -412,6 +418,11 @@ ProcessCode EDM4hepSimInputConverter::convert(const AlgorithmContext& ctx,
           [&](std::uint64_t cellId) {
             ACTS_VERBOSE("CellID: " << cellId);
 
+            if (auto it = cellGeometryIds.find(cellId);
+                it != cellGeometryIds.end()) {
+              return it->second;
+            }
+
             const auto& vm =
                 m_cfg.dd4hepDetector->dd4hepDetector().volumeManager();
 
@@ -421,15 +432,15 @@ ProcessCode EDM4hepSimInputConverter::convert(const AlgorithmContext& ctx,
             ACTS_VERBOSE("   -> id: " << detElement.id());
             ACTS_VERBOSE("   -> key: " << detElement.key());
 
-            Acts::Vector3 position;
-            position << detElement.nominal()
-                            .worldTransformation()
-                            .GetTranslation()[0],
-                detElement.nominal().worldTransformation().GetTranslation()[1],
-                detElement.nominal().worldTransformation().GetTranslation()[2];
-            position *= Acts::UnitConstants::cm;
-
-            ACTS_VERBOSE("   -> detElement position: " << position.transpose());
+            if (logger().doPrint(Acts::Logging::VERBOSE)) {
+              const double* translation =
+                  detElement.nominal().worldTransformation().GetTranslation();
+              Acts::Vector3 position(translation[0], translation[1],
+                                     translation[2]);
+              position *= Acts::UnitConstants::cm;
+              ACTS_VERBOSE(
+                  "   -> detElement position: " << position.transpose());
+            }
 
             auto it = m_surfaceMap.find(detElement.key());
             if (it == m_surfaceMap.end()) {
@@ -444,6 +455,7 @@ ProcessCode EDM4hepSimInputConverter::convert(const AlgorithmContext& ctx,
               throw std::runtime_error("Unable to find surface for detElement");
             }
             ACTS_VERBOSE("   -> surface: " << surface->geometryId());
+            cellGeometryIds.emplace(cellId, surface->geometryId());
             return surface->geometryId();
           });
 
@@ -468,50 +480,39 @@ ProcessCode EDM4hepSimInputConverter::convert(const AlgorithmContext& ctx,
 
   if (m_cfg.sortSimHitsInTime) {
     ACTS_DEBUG("Sorting sim hits in time");
-    std::multimap<ActsFatras::Barcode, std::size_t> hitsByParticle;
-
-    for (std::size_t i = 0; i < simHits.size(); ++i) {
-      hitsByParticle.insert({simHits.nth(i)->particleId(), i});
-    }
-
-    for (auto it = hitsByParticle.begin(), end = hitsByParticle.end();
-         it != end; it = hitsByParticle.upper_bound(it->first)) {
-      ACTS_DEBUG("Particle " << it->first << " has "
-                             << hitsByParticle.count(it->first) << " hits");
-
-      std::vector<std::size_t> hitIndices;
-      hitIndices.reserve(hitsByParticle.count(it->first));
-      for (auto hitIndex : makeRange(hitsByParticle.equal_range(it->first))) {
-        hitIndices.push_back(hitIndex.second);
-      }
-
-      if (logger().doPrint(Acts::Logging::VERBOSE)) {
-        ACTS_VERBOSE("Before sorting:");
-        for (const auto& hitIdx : hitIndices) {
-          ACTS_VERBOSE(" - " << hitIdx << " / " << simHits.nth(hitIdx)->index()
-                             << " " << simHits.nth(hitIdx)->time());
-        }
+    // Order all hits by particle and time at once, the hits of each particle
+    // are then a contiguous range
+    std::vector<std::size_t> hitIndices(simHits.size());
+    std::iota(hitIndices.begin(), hitIndices.end(), 0u);
+    std::ranges::stable_sort(hitIndices, [&simHits](std::size_t a,
+                                                    std::size_t b) {
+      const auto& hitA = *simHits.nth(a);
+      const auto& hitB = *simHits.nth(b);
+      if (hitA.particleId() != hitB.particleId()) {
+        return hitA.particleId() < hitB.particleId();
       }
+      return hitA.time() < hitB.time();
+    });
 
-      std::ranges::sort(hitIndices, {}, [&simHits](std::size_t h) {
-        return simHits.nth(h)->time();
+    for (auto begin = hitIndices.begin(); begin != hitIndices.end();) {
+      ActsFatras::Barcode particleId = simHits.nth(*begin)->particleId();
+      auto end = std::find_if(begin, hitIndices.end(), [&](std::size_t h) {
+        return simHits.nth(h)->particleId() != particleId;
       });
-
-      for (std::size_t i = 0; i < hitIndices.size(); ++i) {
-        auto& hit = *simHits.nth(hitIndices[i]);
+      ACTS_DEBUG("Particle " << particleId << " has "
+                             << std::distance(begin, end) << " hits");
+
+      std::int32_t index = 0;
+      for (auto it = begin; it != end; ++it) {
+        auto& hit = *simHits.nth(*it);
+        ACTS_VERBOSE(" - " << *it << " / " << hit.index() << " -> " << index
+                           << " " << hit.time());
         SimHit updatedHit{hit.geometryId(),     hit.particleId(),
                           hit.fourPosition(),   hit.momentum4Before(),
-                          hit.momentum4After(), static_cast<std::int32_t>(i)};
+                          hit.momentum4After(), index++};
         hit = updatedHit;
       }
-
-      if (logger().doPrint(Acts::Logging::VERBOSE)) {
-        ACTS_VERBOSE("After sorting:");
-        for (const auto& hitIdx : hitIndices) {
-          ACTS_VERBOSE(" - " << hitIdx << " / " << simHits.nth(hitIdx)->index()
-                             << " " << simHits.nth(hitIdx)->time());
-        }
-      }
+      begin = end;
     }
   }
 
@@ -13,9 +13,13 @@
 #include "ActsExamples/Io/EDM4hep/EDM4hepUtil.hpp"
 
 #include <stdexcept>
+#include <vector>
 
 #include <edm4hep/TrackCollection.h>
+#include <edm4hep/TrackState.h>
 #include <podio/Frame.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 namespace ActsExamples {
 
@@ -29,13 +33,33 @@ EDM4hepTrackOutputConverter::EDM4hepTrackOutputConverter(
 
 ActsExamples::ProcessCode EDM4hepTrackOutputConverter::execute(
     const AlgorithmContext& context) const {
-  edm4hep::TrackCollection trackCollection;
-
   const auto& tracks = m_inputTracks(context);
 
-  for (const auto& from : tracks) {
-    auto to = trackCollection.create();
-    Acts::EDM4hepUtil::writeTrack(context.geoContext, from, to, m_cfg.Bz);
+  // The parameter conversion is the expensive part, it is done for all
+  // tracks before the collection is filled in one pass
+  std::vector<std::vector<edm4hep::TrackState>> trackStates(tracks.size());
+  auto convert = [&](std::size_t i) {
+    Acts::EDM4hepUtil::convertTrackStates(
+        context.geoContext, tracks.getTrack(i), trackStates[i], m_cfg.Bz);
+  };
+  if (m_cfg.parallelizeOverTracks) {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, tracks.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        for (std::size_t i = range.begin(); i != range.end();
+                             ++i) {
+                          convert(i);
+                        }
+                      });
+  } else {
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+      convert(i);
+    }
+  }
+
+  edm4hep::TrackCollection trackCollection;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    Acts::EDM4hepUtil::writeTrack(tracks.getTrack(i), trackStates[i],
+                                  trackCollection.create());
   }
 
   m_outputTracks(context, std::move(trackCollection));
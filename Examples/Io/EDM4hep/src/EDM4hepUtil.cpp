@@ -211,25 +211,20 @@ void EDM4hepUtil::writeMeasurement(
   // @TODO: Check if we can write cell info
 }
 
-void EDM4hepUtil::writeTrajectory(
+EDM4hepUtil::ConvertedTrajectory EDM4hepUtil::convertTrajectory(
     const Acts::GeometryContext& gctx, double Bz, const Trajectories& from,
-    edm4hep::MutableTrack to, std::size_t fromIndex,
-    const Acts::ParticleHypothesis& particleHypothesis,
-    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap) {
+    std::size_t fromIndex, const Acts::ParticleHypothesis& particleHypothesis) {
   const auto& multiTrajectory = from.multiTrajectory();
   auto trajectoryState =
       Acts::MultiTrajectoryHelpers::trajectoryState(multiTrajectory, fromIndex);
 
-  std::vector<ParticleHitCount> particleHitCount;
-  identifyContributingParticles(hitParticlesMap, from, fromIndex,
-                                particleHitCount);
-  // TODO use particles
-
   // TODO write track params
   // auto trackParameters = from.trackParameters(fromIndex);
 
-  to.setChi2(trajectoryState.chi2Sum / trajectoryState.NDF);
-  to.setNdf(trajectoryState.NDF);
+  ConvertedTrajectory to;
+  to.chi2 = trajectoryState.chi2Sum / trajectoryState.NDF;
+  to.ndf = trajectoryState.NDF;
+  to.trackStates.reserve(trajectoryState.nMeasurements);
 
   multiTrajectory.visitBackwards(fromIndex, [&](const auto& state) {
     // we only fill the track states with non-outlier measurement
@@ -238,7 +233,7 @@ void EDM4hepUtil::writeTrajectory(
       return true;
     }
 
-    edm4hep::TrackState trackState;
+    edm4hep::TrackState& trackState = to.trackStates.emplace_back();
 
     Acts::BoundTrackParameters parObj{state.referenceSurface().getSharedPtr(),
                                       state.parameters(), state.covariance(),
@@ -280,10 +275,33 @@ void EDM4hepUtil::writeTrajectory(
       // clang-format on
     }
 
-    to.addToTrackStates(trackState);
-
     return true;
   });
+
+  return to;
+}
+
+void EDM4hepUtil::writeTrajectory(const ConvertedTrajectory& from,
+                                  edm4hep::MutableTrack to) {
+  to.setChi2(from.chi2);
+  to.setNdf(from.ndf);
+  for (const auto& trackState : from.trackStates) {
+    to.addToTrackStates(trackState);
+  }
+}
+
+void EDM4hepUtil::writeTrajectory(
+    const Acts::GeometryContext& gctx, double Bz, const Trajectories& from,
+    edm4hep::MutableTrack to, std::size_t fromIndex,
+    const Acts::ParticleHypothesis& particleHypothesis,
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap) {
+  std::vector<ParticleHitCount> particleHitCount;
+  identifyContributingParticles(hitParticlesMap, from, fromIndex,
+                                particleHitCount);
+  // TODO use particles
+
+  writeTrajectory(
+      convertTrajectory(gctx, Bz, from, fromIndex, particleHypothesis), to);
 }
 
 }  // namespace ActsExamples
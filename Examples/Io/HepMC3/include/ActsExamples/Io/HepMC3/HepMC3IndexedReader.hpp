@@ -0,0 +1,123 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3InputConverter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// HepMC3 ASCII event reader with random access and direct conversion.
+///
+/// On construction the byte offsets of all events in the input file are
+/// collected into an index, which is stored in a sidecar file and re-used as
+/// long as the input file is unchanged. Each event is read by seeking to its
+/// offset, i.e. events can be read in any order and concurrently without
+/// locking, e.g. for pileup overlay or from a `PrefetchingReader`.
+///
+/// The byte range of each event is parsed by the HepMC3 ASCII reader and
+/// converted by the `HepMC3InputConverter`, i.e. the output is identical to
+/// the `HepMC3Reader` followed by the `HepMC3InputConverter`.
+///
+/// Only uncompressed files in the HepMC3 ASCII format (Asciiv3) are
+/// supported, other files, e.g. in the HepMC2 `IO_GenEvent` format, are
+/// rejected on construction based on their header.
+class HepMC3IndexedReader final : public IReader {
+ public:
+  struct Config {
+    /// The input file in HepMC3 ASCII format
+    std::filesystem::path inputPath;
+    /// The sidecar index file, defaults to the input path with `.idx` appended
+    std::filesystem::path indexPath;
+
+    /// The output particles collection
+    std::string outputParticles;
+    /// The output vertices collection
+    std::string outputVertices;
+
+    /// Merge primary vertices
+    bool mergePrimaries = true;
+    /// The spatial vertex threshold below which to consider primary vertices
+    /// candidates identical.
+    double primaryVertexSpatialThreshold = 1 * Acts::UnitConstants::nm;
+    /// The spatial vertex threshold below which to consider secondary vertices
+    /// candidates identical.
+    double vertexSpatialThreshold = 1 * Acts::UnitConstants::um;
+    /// If true, merge secondary vertices that are close to their parent vertex
+    bool mergeSecondaries = true;
+  };
+
+  /// Construct the reader and load or build the event index.
+  ///
+  /// @param [in] cfg The configuration object
+  /// @param [in] lvl The logging level
+  HepMC3IndexedReader(const Config& cfg, Acts::Logging::Level lvl);
+
+  std::string name() const override;
+
+  /// Return the available events range.
+  std::pair<std::size_t, std::size_t> availableEvents() const override;
+
+  /// Read and convert the requested event.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) override;
+
+  /// Read and convert an event independent of the event store.
+  ///
+  /// @param eventNumber is the position of the event in the file
+  /// @throws std::ios_base::failure if the event can not be read
+  /// @return the converted particles and vertices
+  std::pair<SimParticleContainer, SimVertexContainer> readEvent(
+      std::size_t eventNumber) const;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// Load the sidecar index if it matches the input file
+  bool loadIndex();
+  /// Scan the input file for the event offsets
+  void buildIndex();
+  /// Store the index in the sidecar file
+  void storeIndex() const;
+
+  /// The configuration of this reader
+  Config m_cfg;
+  /// The logger
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  /// The configuration of the event conversion
+  HepMC3InputConverter::Config m_converterConfig;
+
+  WriteDataHandle<SimParticleContainer> m_outputParticles{this,
+                                                          "OutputParticles"};
+  WriteDataHandle<SimVertexContainer> m_outputVertices{this, "OutputVertices"};
+
+  /// The input file size and modification time the index was built for
+  std::uint64_t m_fileSize = 0;
+  std::int64_t m_fileTime = 0;
+  /// Byte offsets of the events, followed by the end of the last event
+  std::vector<std::uint64_t> m_offsets;
+};
+
+}  // namespace ActsExamples
@@ -15,10 +15,10 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 
 #include <string>
+#include <utility>
 
 namespace HepMC3 {
 class GenEvent;
-class GenVertex;
 }  // namespace HepMC3
 
 namespace ActsExamples {
@@ -58,16 +58,22 @@ class HepMC3InputConverter : public IAlgorithm {
 
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
- private:
-  void convertHepMC3ToInternalEdm(const AlgorithmContext& ctx,
-                                  const HepMC3::GenEvent& genEvent) const;
-
-  void handleVertex(const HepMC3::GenVertex& genVertex, SimVertex& vertex,
-                    std::vector<SimVertex>& vertices,
-                    std::vector<SimParticle>& particles,
-                    std::size_t& nSecondaryVertices, std::size_t& nParticles,
-                    std::vector<bool>& seenVertices) const;
+  /// Convert a HepMC3 event into the internal EDM.
+  ///
+  /// Does not use the event store, e.g. for readers that create the HepMC3
+  /// events themselves.
+  ///
+  /// @param cfg is the conversion configuration, the collection names
+  ///        are not used
+  /// @param genEvent is the event to convert, in units of GeV and mm
+  /// @param logger is the logger used for the conversion messages
+  /// @return the converted particles and vertices
+  static std::pair<SimParticleContainer, SimVertexContainer>
+  convertHepMC3ToInternalEdm(const Config& cfg,
+                             const HepMC3::GenEvent& genEvent,
+                             const Acts::Logger& logger);
 
+ private:
   Config m_cfg;
 
   ReadDataHandle<std::shared_ptr<HepMC3::GenEvent>> m_inputEvent{this,
@@ -0,0 +1,231 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+
+#include <HepMC3/GenEvent.h>
+#include <HepMC3/ReaderAscii.h>
+#include <HepMC3/Units.h>
+
+#include <array>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace ActsExamples {
+
+namespace {
+
+/// The sidecar index layout, followed by `nEvents + 1` offsets
+struct IndexHeader {
+  std::array<char, 8> magic = {'A', 'C', 'T', 'S', 'H', 'I', 'D', 'X'};
+  std::uint64_t version = 1;
+  std::uint64_t fileSize = 0;
+  std::int64_t fileTime = 0;
+  std::uint64_t nEvents = 0;
+};
+
+/// Check the header lines written by the HepMC3 ASCII writer, other
+/// formats such as the HepMC2 `IO_GenEvent` also tag events with 'E'
+bool hasAsciiv3Header(std::istream& stream) {
+  std::string version;
+  std::string listing;
+  std::getline(stream, version);
+  std::getline(stream, listing);
+  return version.starts_with("HepMC::Version 3.") &&
+         listing.starts_with("HepMC::Asciiv3-START_EVENT_LISTING");
+}
+
+}  // namespace
+
+HepMC3IndexedReader::HepMC3IndexedReader(const Config& cfg,
+                                         Acts::Logging::Level lvl)
+    : m_cfg(cfg), m_logger(Acts::getDefaultLogger(name(), lvl)) {
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output particles collection");
+  }
+  if (m_cfg.outputVertices.empty()) {
+    throw std::invalid_argument("Missing output vertices collection");
+  }
+  if (m_cfg.indexPath.empty()) {
+    m_cfg.indexPath = m_cfg.inputPath;
+    m_cfg.indexPath += ".idx";
+  }
+  m_outputParticles.initialize(m_cfg.outputParticles);
+  m_outputVertices.initialize(m_cfg.outputVertices);
+
+  m_converterConfig.mergePrimaries = m_cfg.mergePrimaries;
+  m_converterConfig.primaryVertexSpatialThreshold =
+      m_cfg.primaryVertexSpatialThreshold;
+  m_converterConfig.vertexSpatialThreshold = m_cfg.vertexSpatialThreshold;
+  m_converterConfig.mergeSecondaries = m_cfg.mergeSecondaries;
+
+  m_fileSize = std::filesystem::file_size(m_cfg.inputPath);
+  m_fileTime = std::filesystem::last_write_time(m_cfg.inputPath)
+                   .time_since_epoch()
+                   .count();
+
+  if (!loadIndex()) {
+    buildIndex();
+    storeIndex();
+  }
+  ACTS_DEBUG("Indexed " << availableEvents().second << " events in "
+                        << m_cfg.inputPath);
+}
+
+std::string HepMC3IndexedReader::name() const {
+  return "HepMC3IndexedReader";
+}
+
+std::pair<std::size_t, std::size_t> HepMC3IndexedReader::availableEvents()
+    const {
+  return {0, m_offsets.empty() ? 0 : m_offsets.size() - 1};
+}
+
+bool HepMC3IndexedReader::loadIndex() {
+  std::ifstream file(m_cfg.indexPath, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  IndexHeader header;
+  IndexHeader expected;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file || header.magic != expected.magic ||
+      header.version != expected.version || header.fileSize != m_fileSize ||
+      header.fileTime != m_fileTime) {
+    ACTS_INFO("Ignore outdated index " << m_cfg.indexPath);
+    return false;
+  }
+  m_offsets.resize(header.nEvents + 1);
+  file.read(reinterpret_cast<char*>(m_offsets.data()),
+            m_offsets.size() * sizeof(std::uint64_t));
+  if (!file) {
+    m_offsets.clear();
+    return false;
+  }
+  ACTS_DEBUG("Loaded index " << m_cfg.indexPath);
+  return true;
+}
+
+void HepMC3IndexedReader::buildIndex() {
+  ACTS_INFO("Build the event index of " << m_cfg.inputPath);
+  std::ifstream file(m_cfg.inputPath, std::ios::binary);
+  if (!file) {
+    throw std::ios_base::failure("Could not open " +
+                                 m_cfg.inputPath.string());
+  }
+
+  if (!hasAsciiv3Header(file)) {
+    throw std::invalid_argument("Not a HepMC3 ASCII file " +
+                                m_cfg.inputPath.string());
+  }
+  file.seekg(0);
+
+  // Events start with a line 'E ...', the chunks are scanned for line
+  // starts and the tag is checked across chunk boundaries
+  std::vector<char> buffer(1u << 20);
+  std::uint64_t offset = 0;
+  bool lineStart = true;
+  std::optional<std::uint64_t> candidate;
+  m_offsets.clear();
+  while (file) {
+    file.read(buffer.data(), buffer.size());
+    std::size_t n = file.gcount();
+    for (std::size_t i = 0; i < n; ++i, ++offset) {
+      char c = buffer[i];
+      if (candidate.has_value()) {
+        if (c == ' ') {
+          m_offsets.push_back(*candidate);
+        }
+        candidate.reset();
+      }
+      if (lineStart && c == 'E') {
+        candidate = offset;
+      }
+      lineStart = c == '\n';
+    }
+  }
+  m_offsets.push_back(offset);
+}
+
+void HepMC3IndexedReader::storeIndex() const {
+  std::ofstream file(m_cfg.indexPath, std::ios::binary | std::ios::trunc);
+  IndexHeader header;
+  header.fileSize = m_fileSize;
+  header.fileTime = m_fileTime;
+  header.nEvents = m_offsets.size() - 1;
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(m_offsets.data()),
+             m_offsets.size() * sizeof(std::uint64_t));
+  if (!file) {
+    // The index is only a cache, it is rebuilt on the next run
+    ACTS_WARNING("Could not store the event index in " << m_cfg.indexPath);
+  }
+}
+
+std::pair<SimParticleContainer, SimVertexContainer>
+HepMC3IndexedReader::readEvent(std::size_t eventNumber) const {
+  if (eventNumber >= availableEvents().second) {
+    throw std::ios_base::failure("Event " + std::to_string(eventNumber) +
+                                 " is not available in " +
+                                 m_cfg.inputPath.string());
+  }
+
+  // Every call uses its own stream, no locking required
+  std::ifstream file(m_cfg.inputPath, std::ios::binary);
+  std::string text(m_offsets[eventNumber + 1] - m_offsets[eventNumber], '\0');
+  file.seekg(m_offsets[eventNumber]);
+  file.read(text.data(), text.size());
+  if (!file) {
+    throw std::ios_base::failure("Could not read event " +
+                                 std::to_string(eventNumber) + " from " +
+                                 m_cfg.inputPath.string());
+  }
+
+  // The HepMC3 reader parses the event from its byte range. The event has
+  // no run information, which is not needed for the conversion.
+  std::istringstream stream(text);
+  HepMC3::ReaderAscii reader(stream);
+  HepMC3::GenEvent genEvent(HepMC3::Units::GEV, HepMC3::Units::MM);
+  if (!reader.read_event(genEvent)) {
+    throw std::ios_base::failure("Could not parse event " +
+                                 std::to_string(eventNumber) + " from " +
+                                 m_cfg.inputPath.string());
+  }
+  reader.close();
+  ACTS_VERBOSE("Parsed event " << eventNumber << " with "
+                               << genEvent.particles_size()
+                               << " particles and " << genEvent.vertices_size()
+                               << " vertices");
+
+  return HepMC3InputConverter::convertHepMC3ToInternalEdm(m_converterConfig,
+                                                          genEvent, logger());
+}
+
+ProcessCode HepMC3IndexedReader::read(const AlgorithmContext& ctx) {
+  std::pair<SimParticleContainer, SimVertexContainer> event;
+  try {
+    event = readEvent(ctx.eventNumber);
+  } catch (const std::ios_base::failure& e) {
+    ACTS_ERROR("Error reading event " << ctx.eventNumber << ": " << e.what());
+    return ProcessCode::ABORT;
+  }
+  ACTS_DEBUG("Converted " << event.first.size() << " particles and "
+                          << event.second.size() << " vertices");
+
+  m_outputParticles(ctx, std::move(event.first));
+  m_outputVertices(ctx, std::move(event.second));
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
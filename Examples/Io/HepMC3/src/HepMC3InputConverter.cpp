@@ -46,7 +46,12 @@ ProcessCode HepMC3InputConverter::execute(const AlgorithmContext& ctx) const {
   ACTS_DEBUG("Have " << genEvent.particles_size() << " particles");
   ACTS_DEBUG("Have " << genEvent.event_number() << " event number");
 
-  convertHepMC3ToInternalEdm(ctx, genEvent);
+  auto [particles, vertices] =
+      convertHepMC3ToInternalEdm(m_cfg, genEvent, logger());
+
+  // move generated event to the store
+  m_outputParticles(ctx, std::move(particles));
+  m_outputVertices(ctx, std::move(vertices));
 
   return ProcessCode::SUCCESS;
 }
@@ -103,15 +108,14 @@ std::string printListing(const auto& vertices, const auto& particles) {
 
   return ss.str();
 };
-}  // namespace
 
-void HepMC3InputConverter::handleVertex(const HepMC3::GenVertex& genVertex,
-                                        SimVertex& vertex,
-                                        std::vector<SimVertex>& vertices,
-                                        std::vector<SimParticle>& particles,
-                                        std::size_t& nSecondaryVertices,
-                                        std::size_t& nParticles,
-                                        std::vector<bool>& seenVertices) const {
+void handleVertex(const HepMC3InputConverter::Config& cfg,
+                  const HepMC3::GenVertex& genVertex, SimVertex& vertex,
+                  std::vector<SimVertex>& vertices,
+                  std::vector<SimParticle>& particles,
+                  std::size_t& nSecondaryVertices, std::size_t& nParticles,
+                  std::vector<bool>& seenVertices,
+                  const Acts::Logger& logger) {
   for (const auto& particle : genVertex.particles_out()) {
     if (particle->end_vertex() != nullptr) {
       // This particle has an end vertex, we need to handle that vertex
@@ -131,10 +135,10 @@ void HepMC3InputConverter::handleVertex(const HepMC3::GenVertex& genVertex,
                             .squaredNorm();
 
       if (distance <=
-              m_cfg.vertexSpatialThreshold * m_cfg.vertexSpatialThreshold &&
-          m_cfg.mergeSecondaries) {
-        handleVertex(endVertex, vertex, vertices, particles, nSecondaryVertices,
-                     nParticles, seenVertices);
+              cfg.vertexSpatialThreshold * cfg.vertexSpatialThreshold &&
+          cfg.mergeSecondaries) {
+        handleVertex(cfg, endVertex, vertex, vertices, particles,
+                     nSecondaryVertices, nParticles, seenVertices, logger);
       } else {
         // Over threshold, make a new vertex
         SimVertex secondaryVertex;
@@ -143,8 +147,8 @@ void HepMC3InputConverter::handleVertex(const HepMC3::GenVertex& genVertex,
             SimVertexBarcode{vertex.id}.setVertexSecondary(nSecondaryVertices);
         secondaryVertex.position4 = convertPosition(endVertex.position());
 
-        handleVertex(endVertex, secondaryVertex, vertices, particles,
-                     nSecondaryVertices, nParticles, seenVertices);
+        handleVertex(cfg, endVertex, secondaryVertex, vertices, particles,
+                     nSecondaryVertices, nParticles, seenVertices, logger);
 
         // Only keep the secondary vertex if it has outgoing particles
         if (!secondaryVertex.outgoing.empty()) {
@@ -208,8 +212,12 @@ void HepMC3InputConverter::handleVertex(const HepMC3::GenVertex& genVertex,
   }
 }
 
-void HepMC3InputConverter::convertHepMC3ToInternalEdm(
-    const AlgorithmContext& ctx, const HepMC3::GenEvent& genEvent) const {
+}  // namespace
+
+std::pair<SimParticleContainer, SimVertexContainer>
+HepMC3InputConverter::convertHepMC3ToInternalEdm(
+    const Config& cfg, const HepMC3::GenEvent& genEvent,
+    const Acts::Logger& logger) {
   ACTS_DEBUG("Converting HepMC3 event to internal EDM");
 
   ACTS_VERBOSE("Have " << genEvent.vertices_size() << " vertices");
@@ -219,7 +227,7 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
   std::vector<VertexCluster> vertexClusters;
 
   ACTS_VERBOSE("Finding primary vertex clusters with threshold "
-               << m_cfg.primaryVertexSpatialThreshold);
+               << cfg.primaryVertexSpatialThreshold);
 
   // Find all vertices whose incoming particles are either all beam particles or
   // that don't have any incoming particles
@@ -251,9 +259,9 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
                   return (position - clusterPosition)
                              .template head<3>()
                              .cwiseAbs()
-                             .maxCoeff() < m_cfg.primaryVertexSpatialThreshold;
+                             .maxCoeff() < cfg.primaryVertexSpatialThreshold;
                 });
-            it != vertexClusters.end() && m_cfg.mergePrimaries) {
+            it != vertexClusters.end() && cfg.mergePrimaries) {
           // Add the vertex to the cluster
           it->push_back(vertex);
         } else {
@@ -320,9 +328,9 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
       std::size_t nParticles = 0;
 
       for (auto& genVertex : cluster) {
-        handleVertex(*genVertex, primaryVertex, verticesUnordered,
+        handleVertex(cfg, *genVertex, primaryVertex, verticesUnordered,
                      particlesUnordered, nSecondaryVertices, nParticles,
-                     seenVertices);
+                     seenVertices, logger);
       }
       verticesUnordered.push_back(primaryVertex);
     }
@@ -331,7 +339,7 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
   ACTS_DEBUG("Converted " << particlesUnordered.size() << " particles and "
                           << verticesUnordered.size() << " vertices");
 
-  if (m_cfg.printListing) {
+  if (cfg.printListing) {
     ACTS_VERBOSE("Converted event record:\n"
                  << printListing(verticesUnordered, particlesUnordered));
   }
@@ -348,7 +356,7 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
     });
   }
 
-  if (m_cfg.checkConsistency) {
+  if (cfg.checkConsistency) {
     ACTS_DEBUG("Checking consistency of particles");
     auto equalParticleIds = [](const auto& a, const auto& b) {
       return a.particleId() == b.particleId();
@@ -372,9 +380,7 @@ void HepMC3InputConverter::convertHepMC3ToInternalEdm(
   SimVertexContainer vertices{verticesUnordered.begin(),
                               verticesUnordered.end()};
 
-  // move generated event to the store
-  m_outputParticles(ctx, std::move(particles));
-  m_outputVertices(ctx, std::move(vertices));
+  return {std::move(particles), std::move(vertices)};
 }
 
 }  // namespace ActsExamples
@@ -12,6 +12,7 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -24,15 +25,14 @@ class PodioWriterImpl;
 /// This writer writes events to a PODIO file in the form of frame.
 ///
 /// The writer supports parallel execution by serializing the writes to the
-/// file.
+/// file on a dedicated I/O thread. The frames are assembled on the calling
+/// thread, which only waits if too many frames are pending.
 /// The writer is configured with a @c podio::Frame name to read from the white
 /// board. If empty, it will create a new frame.
 ///
 /// The writer is also configured with a list of collection names to write to
 /// the file. The collections must be present in the event store and be of type
 /// @c podio::CollectionBase.
-///
-/// @note The writer uses a mutex to ensure thread safety when writing to the file.
 class PodioWriter final : public IWriter {
  public:
   struct Config {
@@ -52,6 +52,10 @@ class PodioWriter final : public IWriter {
     /// @note Collection names must not be empty and must be unique.
     /// The collections must be present in the event store.
     std::vector<std::string> collections;
+
+    /// The maximum number of frames waiting to be written before the event
+    /// processing is blocked.
+    std::size_t maxPendingFrames = 16;
   };
 
   /// Construct the writer.
@@ -10,10 +10,12 @@
 
 #include "Acts/Plugins/Podio/PodioUtil.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AsyncWriteQueue.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <algorithm>
 #include <list>
+#include <memory>
 
 #include <podio/CollectionBase.h>
 #include <podio/Frame.h>
@@ -29,7 +31,8 @@ class PodioWriterImpl {
   PodioWriterImpl(const PodioWriter::Config& config, PodioWriter& parent)
       : m_cfg(config),
         m_inputPodioFrame(&parent, "InputPodioFrame"),
-        m_writer(config.outputPath) {}
+        m_writer(config.outputPath),
+        m_writeQueue(config.maxPendingFrames) {}
 
   PodioWriter::Config m_cfg;
 
@@ -37,8 +40,11 @@ class PodioWriterImpl {
 
   std::vector<std::unique_ptr<CollectionHandle>> m_collections;
 
-  std::mutex m_writeMutex;
   Acts::PodioUtil::ROOTWriter m_writer;
+
+  /// Writes the frames outside of the event processing threads, declared
+  /// after the writer such that it is stopped first
+  AsyncWriteQueue m_writeQueue;
 };
 }  // namespace detail
 
@@ -50,6 +56,9 @@ PodioWriter::PodioWriter(const Config& config, Acts::Logging::Level level)
   if (m_impl->m_cfg.category.empty()) {
     throw std::invalid_argument("Category name is not set");
   }
+  if (m_impl->m_cfg.maxPendingFrames == 0) {
+    throw std::invalid_argument("At least one pending frame is required");
+  }
   if (!m_impl->m_cfg.inputFrame.has_value()) {
     ACTS_DEBUG("No input frame name set, will create a new one");
   } else {
@@ -96,7 +105,8 @@ ProcessCode PodioWriter::write(const AlgorithmContext& ctx) {
     }
   }();
 
-  std::lock_guard guard(m_impl->m_writeMutex);
+  // The frame is assembled on the calling thread, only the file access is
+  // serialized on the I/O thread
   for (const auto& handle : m_impl->m_collections) {
     auto collectionPtr = (*handle)(ctx);
     if (!collectionPtr) {
@@ -105,12 +115,17 @@ ProcessCode PodioWriter::write(const AlgorithmContext& ctx) {
     }
     frame.put(std::move(collectionPtr), handle->name());
   }
-  m_impl->m_writer.writeFrame(frame, m_impl->m_cfg.category);
+
+  auto framePtr = std::make_shared<podio::Frame>(std::move(frame));
+  m_impl->m_writeQueue.push([impl = m_impl.get(), framePtr]() {
+    impl->m_writer.writeFrame(*framePtr, impl->m_cfg.category);
+  });
 
   return ProcessCode::SUCCESS;
 }
 
 ProcessCode PodioWriter::finalize() {
+  m_impl->m_writeQueue.flush();
   m_impl->m_writer.finish();
 
   return ProcessCode::SUCCESS;
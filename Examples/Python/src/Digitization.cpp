@@ -54,7 +54,8 @@ void addDigitization(Context& ctx) {
         outputMeasurementParticlesMap, outputMeasurementSimHitsMap,
         outputParticleMeasurementsMap, outputSimHitMeasurementsMap,
         surfaceByIdentifier, randomNumbers, doOutputCells, doClusterization,
-        doMerge, minEnergyDeposit, digitizationConfigs, minMaxRetries);
+        doMerge, minEnergyDeposit, digitizationConfigs, minMaxRetries,
+        parallelizeOverModules);
 
     c.def_readonly("mergeNsigma", &Config::mergeNsigma);
     c.def_readonly("mergeCommonCorner", &Config::mergeCommonCorner);
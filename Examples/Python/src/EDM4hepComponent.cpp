@@ -91,14 +91,15 @@ PYBIND11_MODULE(ActsPythonBindingsEDM4hep, m) {
     auto [alg, config] = declareAlgorithm<EDM4hepMultiTrajectoryOutputConverter,
                                           EDM4hepOutputConverter>(
         m, "EDM4hepMultiTrajectoryOutputConverter");
-    ACTS_PYTHON_STRUCT(config, inputTrajectories, inputMeasurementParticlesMap,
-                       outputTracks, Bz);
+    ACTS_PYTHON_STRUCT(config, inputTrajectories, outputTracks, Bz,
+                       parallelizeOverTracks);
   }
 
   {
     auto [alg, config] =
         declareAlgorithm<EDM4hepTrackOutputConverter, EDM4hepOutputConverter>(
             m, "EDM4hepTrackOutputConverter");
-    ACTS_PYTHON_STRUCT(config, inputTracks, outputTracks, Bz);
+    ACTS_PYTHON_STRUCT(config, inputTracks, outputTracks, Bz,
+                       parallelizeOverTracks);
   }
 }
@@ -8,16 +8,470 @@
 
 #include "Acts/Definitions/PdgParticle.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
 #include <type_traits>
+#include <vector>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+// Space points are bound as a container, not converted to a list
+PYBIND11_MAKE_OPAQUE(ActsExamples::SimSpacePointContainer);
+
 namespace py = pybind11;
 
 using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+/// Create a read-only numpy array on top of memory owned by `owner`.
+///
+/// Nothing is copied, the array only keeps the owner alive. Containers read
+/// from the whiteboard are owned by the event store, i.e. the views are only
+/// valid while the event is processed.
+template <typename T>
+py::array_t<T> makeView(py::handle owner, const T* data,
+                        std::vector<py::ssize_t> shape,
+                        std::vector<py::ssize_t> strides) {
+  py::array_t<T> view(std::move(shape), std::move(strides), data, owner);
+  py::detail::array_proxy(view.ptr())->flags &=
+      ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  return view;
+}
+
+/// Create a view of a contiguous column.
+template <typename T, typename Allocator>
+py::array_t<T> makeColumnView(py::handle owner,
+                              const std::vector<T, Allocator>& column) {
+  return makeView<T>(owner, column.data(),
+                     {static_cast<py::ssize_t>(column.size())},
+                     {sizeof(T)});
+}
+
+/// Create a strided view of one field in an array of structures.
+template <typename S, typename Projection>
+auto makeFieldView(py::handle owner, const std::vector<S>& rows,
+                   Projection projection) {
+  using T =
+      std::remove_cvref_t<std::invoke_result_t<Projection, const S&>>;
+  static_assert(std::is_reference_v<
+                    std::invoke_result_t<Projection, const S&>>,
+                "The field must be accessed by reference");
+  const T* data =
+      rows.empty() ? nullptr : &std::invoke(projection, rows.front());
+  return makeView<T>(owner, data, {static_cast<py::ssize_t>(rows.size())},
+                     {sizeof(S)});
+}
+
+/// Create a view of fixed-size Eigen blocks with the block index first.
+///
+/// Vectors are viewed as `(n, rows)` and matrices as `(n, rows, cols)`.
+template <typename Matrix>
+py::array_t<double> makeBlockView(py::handle owner,
+                                  const std::vector<Matrix>& blocks) {
+  static_assert(std::is_same_v<typename Matrix::Scalar, double>);
+  static_assert(!Matrix::IsRowMajor || Matrix::ColsAtCompileTime == 1);
+  constexpr py::ssize_t rows = Matrix::RowsAtCompileTime;
+  constexpr py::ssize_t cols = Matrix::ColsAtCompileTime;
+  const double* data = blocks.empty() ? nullptr : blocks.front().data();
+  auto size = static_cast<py::ssize_t>(blocks.size());
+  if constexpr (cols == 1) {
+    return makeView<double>(owner, data, {size, rows},
+                            {sizeof(Matrix), sizeof(double)});
+  } else {
+    return makeView<double>(owner, data, {size, rows, cols},
+                            {sizeof(Matrix), sizeof(double),
+                             rows * static_cast<py::ssize_t>(sizeof(double))});
+  }
+}
+
+/// Copy a fixed-size Eigen vector or matrix into a new numpy array.
+template <typename Derived>
+py::array_t<double> toArray(const Eigen::MatrixBase<Derived>& matrix) {
+  using Plain = typename Derived::PlainObject;
+  static_assert(!Plain::IsRowMajor || Plain::ColsAtCompileTime == 1);
+  const Plain plain = matrix;
+  constexpr py::ssize_t rows = Plain::RowsAtCompileTime;
+  constexpr py::ssize_t cols = Plain::ColsAtCompileTime;
+  // Without an owner, the data is copied
+  if constexpr (cols == 1) {
+    return py::array_t<double>({rows}, {sizeof(double)}, plain.data());
+  } else {
+    return py::array_t<double>(
+        {rows, cols},
+        {sizeof(double), rows * static_cast<py::ssize_t>(sizeof(double))},
+        plain.data());
+  }
+}
+
+/// Copy one quantity of every element into a new numpy array.
+template <typename T, typename Container, typename Getter>
+py::array_t<T> collect(const Container& container, std::size_t size,
+                       Getter getter) {
+  py::array_t<T> column(static_cast<py::ssize_t>(size));
+  auto out = column.template mutable_unchecked<1>();
+  for (std::size_t i = 0; i < size; ++i) {
+    out(i) = getter(container, i);
+  }
+  return column;
+}
+
+/// Copy one bound parameter vector per element into a new `(n, 6)` numpy
+/// array, where missing vectors are filled with NaN.
+template <typename Container, typename Getter>
+py::array_t<double> collectParameters(const Container& container,
+                                      std::size_t size, Getter getter) {
+  constexpr auto rows = static_cast<py::ssize_t>(eBoundSize);
+  py::array_t<double> column({static_cast<py::ssize_t>(size), rows});
+  auto out = column.template mutable_unchecked<2>();
+  for (std::size_t i = 0; i < size; ++i) {
+    std::optional<BoundVector> vector = getter(container, i);
+    for (py::ssize_t j = 0; j < rows; ++j) {
+      out(i, j) = vector.has_value()
+                      ? (*vector)[j]
+                      : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  return column;
+}
+
+/// The type flags of a track state as their raw bit pattern.
+template <typename Proxy>
+TrackStateType::raw_type rawTypeFlags(const Proxy& p) {
+  TrackStateType::raw_type raw = 0;
+  for (std::size_t i = 0; i < TrackStateType::kRawBits; ++i) {
+    if (p.typeFlags().test(i)) {
+      raw |= TrackStateType::raw_type{1} << i;
+    }
+  }
+  return raw;
+}
+
+template <typename T>
+void addReadDataHandle(py::module_& mex, const char* name) {
+  using Handle = ReadDataHandle<T>;
+  // The parent sequence element only stores a pointer to the handle
+  py::class_<Handle>(mex, name)
+      .def(py::init<SequenceElement*, const std::string&>(), py::arg("parent"),
+           py::arg("name"), py::keep_alive<2, 1>())
+      .def("initialize", &Handle::initialize, py::arg("key"))
+      .def("isInitialized", &Handle::isInitialized)
+      .def_property_readonly("key", &Handle::key)
+      .def(
+          "__call__",
+          [](const Handle& self, const AlgorithmContext& ctx) -> const T& {
+            return self(ctx);
+          },
+          py::return_value_policy::reference, py::arg("context"));
+}
+
+void addEventDataViews(py::module_& mex) {
+  {
+    using Value = GeometryIdentifier::Value;
+    static_assert(sizeof(GeometryIdentifier) == sizeof(Value) &&
+                  std::is_standard_layout_v<GeometryIdentifier>);
+
+    // Measurements of varying size are packed into flat columns, with the
+    // per-measurement offsets and sizes to slice them
+    py::class_<MeasurementContainer>(mex, "MeasurementContainer")
+        .def("__len__", &MeasurementContainer::size)
+        .def_property_readonly(
+            "geometryIds",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeView<Value>(
+                  self, reinterpret_cast<const Value*>(c.m_geometryIds.data()),
+                  {static_cast<py::ssize_t>(c.m_geometryIds.size())},
+                  {sizeof(GeometryIdentifier)});
+            })
+        .def_property_readonly(
+            "sizes",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeFieldView(
+                  self, c.m_entries,
+                  &MeasurementContainer::MeasurementEntry::size);
+            })
+        .def_property_readonly(
+            "subspaceIndexOffsets",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeFieldView(
+                  self, c.m_entries,
+                  &MeasurementContainer::MeasurementEntry::subspaceIndexOffset);
+            })
+        .def_property_readonly(
+            "parameterOffsets",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeFieldView(
+                  self, c.m_entries,
+                  &MeasurementContainer::MeasurementEntry::parameterOffset);
+            })
+        .def_property_readonly(
+            "covarianceOffsets",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeFieldView(
+                  self, c.m_entries,
+                  &MeasurementContainer::MeasurementEntry::covarianceOffset);
+            })
+        .def_property_readonly(
+            "subspaceIndices",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeColumnView(self, c.m_subspaceIndices);
+            })
+        .def_property_readonly(
+            "parameters",
+            [](py::object self) {
+              const auto& c = self.cast<const MeasurementContainer&>();
+              return makeColumnView(self, c.m_parameters);
+            })
+        .def_property_readonly("covariances", [](py::object self) {
+          const auto& c = self.cast<const MeasurementContainer&>();
+          return makeColumnView(self, c.m_covariances);
+        });
+  }
+
+  {
+    using Container = SimSpacePointContainer;
+
+    py::class_<SimSpacePoint>(mex, "SimSpacePoint")
+        .def_property_readonly("x", &SimSpacePoint::x)
+        .def_property_readonly("y", &SimSpacePoint::y)
+        .def_property_readonly("z", &SimSpacePoint::z)
+        .def_property_readonly("r", &SimSpacePoint::r)
+        .def_property_readonly("varianceR", &SimSpacePoint::varianceR)
+        .def_property_readonly("varianceZ", &SimSpacePoint::varianceZ);
+
+    // Space points are stored as an array of structures, every quantity is
+    // copied into its own array
+    auto sp = py::class_<Container>(mex, "SimSpacePointContainer")
+                  .def("__len__", &Container::size)
+                  .def(
+                      "__getitem__",
+                      [](const Container& self,
+                         std::size_t i) -> const SimSpacePoint& {
+                        if (i >= self.size()) {
+                          throw py::index_error();
+                        }
+                        return self[i];
+                      },
+                      py::return_value_policy::reference_internal);
+
+    auto field = [&](const char* name, auto getter) {
+      sp.def_property_readonly(name, [getter](const Container& self) {
+        return collect<double>(
+            self, self.size(),
+            [getter](const Container& c, std::size_t i) {
+              return (c[i].*getter)();
+            });
+      });
+    };
+    field("x", &SimSpacePoint::x);
+    field("y", &SimSpacePoint::y);
+    field("z", &SimSpacePoint::z);
+    field("r", &SimSpacePoint::r);
+    field("varianceR", &SimSpacePoint::varianceR);
+    field("varianceZ", &SimSpacePoint::varianceZ);
+  }
+
+  {
+    using Trajectory = ConstVectorMultiTrajectory;
+    using Proxy = Trajectory::ConstTrackStateProxy;
+
+    py::class_<Proxy>(mex, "ConstTrackStateProxy")
+        .def_property_readonly("index", &Proxy::index)
+        .def_property_readonly("previous",
+                               [](const Proxy& p) { return p.previous(); })
+        .def_property_readonly("hasPredicted", &Proxy::hasPredicted)
+        .def_property_readonly(
+            "predicted", [](const Proxy& p) { return toArray(p.predicted()); })
+        .def_property_readonly("predictedCovariance",
+                               [](const Proxy& p) {
+                                 return toArray(p.predictedCovariance());
+                               })
+        .def_property_readonly("hasFiltered", &Proxy::hasFiltered)
+        .def_property_readonly(
+            "filtered", [](const Proxy& p) { return toArray(p.filtered()); })
+        .def_property_readonly("filteredCovariance",
+                               [](const Proxy& p) {
+                                 return toArray(p.filteredCovariance());
+                               })
+        .def_property_readonly("hasSmoothed", &Proxy::hasSmoothed)
+        .def_property_readonly(
+            "smoothed", [](const Proxy& p) { return toArray(p.smoothed()); })
+        .def_property_readonly("smoothedCovariance",
+                               [](const Proxy& p) {
+                                 return toArray(p.smoothedCovariance());
+                               })
+        .def_property_readonly("hasJacobian", &Proxy::hasJacobian)
+        .def_property_readonly("chi2", [](const Proxy& p) { return p.chi2(); })
+        .def_property_readonly("pathLength",
+                               [](const Proxy& p) { return p.pathLength(); })
+        .def_property_readonly("typeFlags", [](const Proxy& p) {
+          return rawTypeFlags(p);
+        });
+
+    // The track states are only accessible through their proxies, the
+    // per-state quantities are copied into arrays in track state order
+    auto ts =
+        py::class_<Trajectory>(mex, "ConstVectorMultiTrajectory")
+            .def("__len__", [](const Trajectory& self) { return self.size(); })
+            .def(
+                "getTrackState",
+                [](const Trajectory& self, TrackIndexType i) {
+                  if (i >= self.size()) {
+                    throw py::index_error();
+                  }
+                  return self.getTrackState(i);
+                },
+                py::keep_alive<0, 1>(), py::arg("index"));
+
+    auto column = [&]<typename T>(const char* name,
+                                  T (*getter)(const Proxy&)) {
+      ts.def_property_readonly(name, [getter](const Trajectory& self) {
+        return collect<T>(self, self.size(),
+                          [getter](const Trajectory& t, std::size_t i) {
+                            return getter(t.getTrackState(i));
+                          });
+      });
+    };
+    column("previous",
+           +[](const Proxy& p) -> TrackIndexType { return p.previous(); });
+    column("chi2", +[](const Proxy& p) -> float { return p.chi2(); });
+    column("pathLength",
+           +[](const Proxy& p) -> double { return p.pathLength(); });
+    column("typeFlags", +[](const Proxy& p) -> TrackStateType::raw_type {
+      return rawTypeFlags(p);
+    });
+    column("hasPredicted", +[](const Proxy& p) { return p.hasPredicted(); });
+    column("hasFiltered", +[](const Proxy& p) { return p.hasFiltered(); });
+    column("hasSmoothed", +[](const Proxy& p) { return p.hasSmoothed(); });
+
+    // Missing parameters are filled with NaN
+    auto parameters = [&](const char* name,
+                          std::optional<BoundVector> (*getter)(const Proxy&)) {
+      ts.def_property_readonly(name, [getter](const Trajectory& self) {
+        return collectParameters(
+            self, self.size(), [getter](const Trajectory& t, std::size_t i) {
+              return getter(t.getTrackState(i));
+            });
+      });
+    };
+    parameters("predicted", +[](const Proxy& p) -> std::optional<BoundVector> {
+      return p.hasPredicted() ? std::optional<BoundVector>(p.predicted())
+                              : std::nullopt;
+    });
+    parameters("filtered", +[](const Proxy& p) -> std::optional<BoundVector> {
+      return p.hasFiltered() ? std::optional<BoundVector>(p.filtered())
+                             : std::nullopt;
+    });
+    parameters("smoothed", +[](const Proxy& p) -> std::optional<BoundVector> {
+      return p.hasSmoothed() ? std::optional<BoundVector>(p.smoothed())
+                             : std::nullopt;
+    });
+  }
+
+  {
+    using Container = ConstTrackContainer;
+    using Proxy = Container::ConstTrackProxy;
+
+    py::class_<Proxy>(mex, "ConstTrackProxy")
+        .def_property_readonly("index", &Proxy::index)
+        .def_property_readonly("tipIndex",
+                               [](const Proxy& p) { return p.tipIndex(); })
+        .def_property_readonly("stemIndex",
+                               [](const Proxy& p) { return p.stemIndex(); })
+        .def_property_readonly("nMeasurements",
+                               [](const Proxy& p) { return p.nMeasurements(); })
+        .def_property_readonly("nHoles",
+                               [](const Proxy& p) { return p.nHoles(); })
+        .def_property_readonly("nOutliers",
+                               [](const Proxy& p) { return p.nOutliers(); })
+        .def_property_readonly("nSharedHits",
+                               [](const Proxy& p) { return p.nSharedHits(); })
+        .def_property_readonly("chi2", [](const Proxy& p) { return p.chi2(); })
+        .def_property_readonly("nDoF", [](const Proxy& p) { return p.nDoF(); })
+        .def_property_readonly("parameters",
+                               [](const Proxy& p) {
+                                 return toArray(p.parameters());
+                               })
+        .def_property_readonly("covariance", [](const Proxy& p) {
+          return toArray(p.covariance());
+        });
+
+    auto tc =
+        py::class_<Container>(mex, "ConstTrackContainer")
+            .def("__len__", [](const Container& self) { return self.size(); })
+            .def(
+                "getTrack",
+                [](const Container& self, TrackIndexType i) {
+                  if (i >= self.size()) {
+                    throw py::index_error();
+                  }
+                  return self.getTrack(i);
+                },
+                py::keep_alive<0, 1>(), py::arg("index"))
+            .def_property_readonly(
+                "trackStates",
+                [](const Container& self) -> const ConstVectorMultiTrajectory& {
+                  return self.trackStateContainer();
+                },
+                py::return_value_policy::reference_internal)
+            .def_property_readonly(
+                "parameters",
+                [](py::object self) {
+                  const auto& c = self.cast<const Container&>().container();
+                  return makeBlockView(self, c.m_params);
+                })
+            .def_property_readonly("covariances", [](py::object self) {
+              const auto& c = self.cast<const Container&>().container();
+              return makeBlockView(self, c.m_cov);
+            });
+
+    auto column = [&](const char* name, auto member) {
+      tc.def_property_readonly(name, [member](py::object self) {
+        const auto& c = self.cast<const Container&>().container();
+        return makeColumnView(self, c.*member);
+      });
+    };
+    using Backend = ConstVectorTrackContainer;
+    column("tipIndices", &Backend::m_tipIndex);
+    column("stemIndices", &Backend::m_stemIndex);
+    column("nMeasurements", &Backend::m_nMeasurements);
+    column("nHoles", &Backend::m_nHoles);
+    column("chi2", &Backend::m_chi2);
+    column("nDoF", &Backend::m_ndf);
+    column("nOutliers", &Backend::m_nOutliers);
+    column("nSharedHits", &Backend::m_nSharedHits);
+  }
+
+  addReadDataHandle<MeasurementContainer>(mex,
+                                          "MeasurementContainerReadHandle");
+  addReadDataHandle<SimSpacePointContainer>(mex,
+                                            "SimSpacePointContainerReadHandle");
+  addReadDataHandle<ConstTrackContainer>(mex, "ConstTrackContainerReadHandle");
+}
+
+}  // namespace
 
 namespace Acts::Python {
 
@@ -78,6 +532,8 @@ void addEventData(Context& ctx) {
           "chargedGeantino", [](py::object /* self */) {
             return Acts::ParticleHypothesis::chargedGeantino();
           });
+
+  addEventDataViews(mex);
 }
 
 }  // namespace Acts::Python
@@ -14,7 +14,10 @@
 #include "ActsExamples/Generators/EventGenerator.hpp"
 #include "ActsExamples/Generators/MultiplicityGenerators.hpp"
 #include "ActsExamples/Generators/ParametricParticleGenerator.hpp"
+#include "ActsExamples/Generators/PileupLibrary.hpp"
+#include "ActsExamples/Generators/PileupOverlay.hpp"
 #include "ActsExamples/Generators/VertexGenerators.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
 
 #include <cstddef>
 #include <memory>
@@ -235,6 +238,19 @@ void addGenerators(Context& ctx) {
            }),
            py::arg("mean"))
       .def_readwrite("mean", &ActsExamples::PoissonMultiplicityGenerator::mean);
+
+  py::class_<ActsExamples::PileupLibrary,
+             std::shared_ptr<ActsExamples::PileupLibrary>>(mex, "PileupLibrary")
+      .def(py::init<const ActsExamples::HepMC3IndexedReader&, std::size_t>(),
+           py::arg("reader"), py::arg("nEvents"))
+      .def_property_readonly("size", &ActsExamples::PileupLibrary::size)
+      .def_property_readonly("numParticles",
+                             &ActsExamples::PileupLibrary::numParticles);
+
+  ACTS_PYTHON_DECLARE_ALGORITHM(
+      ActsExamples::PileupOverlay, mex, "PileupOverlay", inputParticles,
+      inputVertices, outputParticles, outputVertices, library, multiplicity,
+      vertex, randomNumbers, randomizePhi, randomizeMirrorZ);
 }
 
 }  // namespace Acts::Python
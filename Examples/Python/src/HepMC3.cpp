@@ -7,6 +7,7 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3InputConverter.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3OutputConverter.hpp"
 #include "ActsExamples/Io/HepMC3/HepMC3Reader.hpp"
@@ -35,6 +36,11 @@ void addHepMC3(Context& ctx) {
                              inputPath, perEvent, outputEvent, printListing,
                              numEvents);
 
+  ACTS_PYTHON_DECLARE_READER(
+      ActsExamples::HepMC3IndexedReader, hepmc3, "HepMC3IndexedReader",
+      inputPath, indexPath, outputParticles, outputVertices, mergePrimaries,
+      primaryVertexSpatialThreshold, vertexSpatialThreshold, mergeSecondaries);
+
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::HepMC3OutputConverter, hepmc3,
                                 "HepMC3OutputConverter", inputParticles,
                                 inputVertices, outputEvent);
@@ -9,6 +9,9 @@
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "ActsExamples/EventData/Cluster.hpp"
 #include "ActsExamples/Framework/BufferedReader.hpp"
+#include "ActsExamples/Framework/PrefetchingReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackReader.hpp"
 #include "ActsExamples/Io/Csv/CsvExaTrkXGraphReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMuonSegmentReader.hpp"
@@ -37,6 +40,19 @@ void addInput(Context& ctx) {
                              "BufferedReader", upstreamReader, selectionSeed,
                              bufferSize);
 
+  // Readahead reader
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::PrefetchingReader, mex,
+                             "PrefetchingReader", upstreamReader, nThreads,
+                             readahead);
+
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::BinaryMaterialTrackReader, mex,
+                             "BinaryMaterialTrackReader",
+                             outputMaterialTrackBatch, filePath);
+
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::BinaryEventReader, mex,
+                             "BinaryEventReader", outputSimHits,
+                             outputMeasurements, outputSpacePoints, filePath);
+
   ACTS_PYTHON_DECLARE_READER(ActsExamples::CsvParticleReader, mex,
                              "CsvParticleReader", inputDir, inputStem,
                              outputParticles);
@@ -241,9 +241,9 @@ void addMaterial(Context& ctx) {
 
     auto c = py::class_<CoreMaterialMapping::Config>(mmca, "Config")
                  .def(py::init<>());
-    ACTS_PYTHON_STRUCT(c, inputMaterialTracks, mappedMaterialTracks,
-                       unmappedMaterialTracks, materialMapper,
-                       materiaMaplWriters);
+    ACTS_PYTHON_STRUCT(c, inputMaterialTracks, inputMaterialTrackBatch,
+                       mappedMaterialTracks, unmappedMaterialTracks,
+                       materialMapper, materiaMaplWriters, nMappingStates);
   }
 
   {
@@ -10,6 +10,8 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Visualization/IVisualization3D.hpp"
 #include "Acts/Visualization/ViewConfig.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvBFieldWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvExaTrkXGraphWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementWriter.hpp"
@@ -88,6 +90,14 @@ void addOutput(Context& ctx) {
                              momentumThreshold, momentumThresholdTraj,
                              nInterpolatedPoints, keepOriginalHits);
 
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::BinaryMaterialTrackWriter, mex,
+                             "BinaryMaterialTrackWriter", inputMaterialTracks,
+                             filePath);
+
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::BinaryEventWriter, mex,
+                             "BinaryEventWriter", inputSimHits,
+                             inputMeasurements, inputSpacePoints, filePath);
+
   {
     auto c = py::class_<ViewConfig>(m, "ViewConfig").def(py::init<>());
 
@@ -25,5 +25,6 @@ PYBIND11_MODULE(ActsPythonBindingsPodio, m) {
                              inputPath, outputFrame, category);
 
   ACTS_PYTHON_DECLARE_WRITER(ActsExamples::PodioWriter, m, "PodioWriter",
-                             inputFrame, outputPath, category, collections);
+                             inputFrame, outputPath, category, collections,
+                             maxPendingFrames);
 }
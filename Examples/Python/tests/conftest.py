@@ -346,7 +346,7 @@ def ptcl_gun(rng):
 
 @pytest.fixture
 def fatras(ptcl_gun, trk_geo, rng):
-    def _factory(s):
+    def _factory(s, **digiKwargs):
         evGen, h3conv = ptcl_gun(s)
 
         field = acts.ConstantBField(acts.Vector3(0, 0, 2 * acts.UnitConstants.T))
@@ -378,6 +378,7 @@ def fatras(ptcl_gun, trk_geo, rng):
             surfaceByIdentifier=trk_geo.geoIdSurfaceMap(),
             randomNumbers=rng,
             inputSimHits=simAlg.config.outputSimHits,
+            **digiKwargs,
         )
         digiAlg = acts.examples.DigitizationAlgorithm(digiCfg, acts.logging.INFO)
 
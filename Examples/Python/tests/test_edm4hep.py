@@ -201,7 +201,6 @@ def test_edm4hep_multitrajectory_writer(tmp_path):
     converter = EDM4hepMultiTrajectoryOutputConverter(
         level=acts.logging.VERBOSE,
         inputTrajectories="trajectories",
-        inputMeasurementParticlesMap="measurement_particles_map",
         outputTracks="ActsTrajectories",
     )
     s.addAlgorithm(converter)
@@ -316,6 +315,113 @@ def test_edm4hep_tracks_writer(tmp_path):
             assert abs(perigee.Z0) < 1e1
 
 
+@pytest.mark.edm4hep
+@pytest.mark.skipif(not edm4hepEnabled, reason="EDM4hep is not set up")
+@pytest.mark.skipif(not podioEnabled, reason="podio is not set up")
+def test_edm4hep_tracks_writer_parallel(tmp_path):
+    from acts.examples.edm4hep import (
+        EDM4hepMultiTrajectoryOutputConverter,
+        EDM4hepTrackOutputConverter,
+    )
+    from acts.examples.podio import PodioWriter
+
+    detector = GenericDetector()
+    trackingGeometry = detector.trackingGeometry()
+    field = acts.ConstantBField(acts.Vector3(0, 0, 2 * u.T))
+
+    from truth_tracking_kalman import runTruthTrackingKalman
+
+    s = Sequencer(numThreads=1, events=10)
+    runTruthTrackingKalman(
+        trackingGeometry,
+        field,
+        digiConfigFile=Path(
+            str(
+                Path(__file__).parent.parent.parent.parent
+                / "Examples/Algorithms/Digitization/share/default-smearing-config-generic.json"
+            )
+        ),
+        outputDir=tmp_path,
+        s=s,
+    )
+
+    s.addAlgorithm(
+        acts.examples.TracksToTrajectories(
+            level=acts.logging.INFO,
+            inputTracks="tracks",
+            outputTrajectories="trajectories",
+        )
+    )
+
+    collections = []
+    for parallel in (False, True):
+        suffix = "Parallel" if parallel else "Sequential"
+        converter = EDM4hepTrackOutputConverter(
+            level=acts.logging.INFO,
+            inputTracks="tracks",
+            outputTracks=f"ActsTracks{suffix}",
+            Bz=2 * u.T,
+            parallelizeOverTracks=parallel,
+        )
+        s.addAlgorithm(converter)
+        collections += converter.collections
+
+        converter = EDM4hepMultiTrajectoryOutputConverter(
+            level=acts.logging.INFO,
+            inputTrajectories="trajectories",
+            outputTracks=f"ActsTrajectories{suffix}",
+            Bz=2 * u.T,
+            parallelizeOverTracks=parallel,
+        )
+        s.addAlgorithm(converter)
+        collections += converter.collections
+
+    out = tmp_path / "tracks_parallel_edm4hep.root"
+    s.addWriter(
+        PodioWriter(
+            level=acts.logging.INFO,
+            outputPath=str(out),
+            category="events",
+            collections=collections,
+        )
+    )
+    s.run()
+
+    from podio.root_io import Reader
+
+    def content(tracks):
+        result = []
+        for track in tracks:
+            states = []
+            for ts in track.getTrackStates():
+                rp = ts.referencePoint
+                states.append(
+                    (
+                        ts.location,
+                        ts.D0,
+                        ts.Z0,
+                        ts.phi,
+                        ts.omega,
+                        ts.tanLambda,
+                        ts.time,
+                        (rp.x, rp.y, rp.z),
+                        tuple(ts.covMatrix),
+                    )
+                )
+            result.append((track.getChi2(), track.getNdf(), states))
+        return result
+
+    nTracks = 0
+    reader = Reader(str(out))
+    for frame in reader.get("events"):
+        for name in ("ActsTracks", "ActsTrajectories"):
+            sequential = content(frame.get(f"{name}Sequential"))
+            parallel = content(frame.get(f"{name}Parallel"))
+            assert parallel == sequential
+            nTracks += len(sequential)
+    assert nTracks > 0
+
+
 def generate_input_test_edm4hep_simhit_reader(input, output):
     from DDSim.DD4hepSimulation import DD4hepSimulation
 
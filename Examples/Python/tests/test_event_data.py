@@ -1,4 +1,7 @@
+import numpy as np
+
 import acts
+import acts.examples
 
 
 def test_particle_hypothesis():
@@ -49,3 +52,192 @@ def test_particle_hypothesis():
     assert str(proton) == "ParticleHypothesis{absPdg=p, mass=0.938272, absCharge=1}"
     assert str(geantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=0}"
     assert str(chargedGeantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=1}"
+
+
+class MeasurementViewAlg(acts.examples.IAlgorithm):
+    events_seen = 0
+
+    def __init__(self, measurements, *args, **kwargs):
+        acts.examples.IAlgorithm.__init__(self, *args, **kwargs)
+        self.measurements = acts.examples.MeasurementContainerReadHandle(
+            self, "InputMeasurements"
+        )
+        self.measurements.initialize(measurements)
+
+    def execute(self, ctx):
+        measurements = self.measurements(ctx)
+        n = len(measurements)
+
+        geoIds = measurements.geometryIds
+        sizes = measurements.sizes
+        offsets = measurements.parameterOffsets
+        parameters = measurements.parameters
+        assert geoIds.dtype == np.uint64 and geoIds.shape == (n,)
+        assert sizes.shape == (n,) and offsets.shape == (n,)
+        assert np.all(offsets[1:] == offsets[:-1] + sizes[:-1])
+        assert parameters.shape == (int(sizes.sum()),)
+        assert np.all(
+            measurements.covarianceOffsets[1:]
+            == measurements.covarianceOffsets[:-1]
+            + sizes[:-1].astype(np.uint64) ** 2
+        )
+
+        # the views point into the containers on the whiteboard
+        assert not parameters.flags.owndata and not parameters.flags.writeable
+        assert parameters.base is not None
+
+        self.events_seen += 1
+        return acts.examples.ProcessCode.SUCCESS
+
+
+def test_measurement_views(fatras):
+    s = acts.examples.Sequencer(numThreads=1, events=3)
+    _, _, digiAlg = fatras(s)
+
+    alg = MeasurementViewAlg(
+        digiAlg.config.outputMeasurements,
+        name="measurement_views",
+        level=acts.logging.INFO,
+    )
+    s.addAlgorithm(alg)
+
+    s.run()
+
+    assert alg.events_seen == 3
+
+
+class SpacePointTrackViewAlg(acts.examples.IAlgorithm):
+    events_seen = 0
+
+    def __init__(self, spacePoints, tracks, *args, **kwargs):
+        acts.examples.IAlgorithm.__init__(self, *args, **kwargs)
+        self.spacePoints = acts.examples.SimSpacePointContainerReadHandle(
+            self, "InputSpacePoints"
+        )
+        self.spacePoints.initialize(spacePoints)
+        self.tracks = acts.examples.ConstTrackContainerReadHandle(self, "InputTracks")
+        self.tracks.initialize(tracks)
+
+    def checkSpacePoints(self, spacePoints):
+        n = len(spacePoints)
+        assert n > 0
+
+        # every quantity is copied into its own array
+        for name in ["x", "y", "z", "r", "varianceR", "varianceZ"]:
+            column = getattr(spacePoints, name)
+            assert column.dtype == np.float64 and column.shape == (n,)
+            assert np.array_equal(
+                column, [getattr(spacePoints[i], name) for i in range(n)]
+            )
+
+    def checkTrackStates(self, states):
+        n = len(states)
+        assert n > 0
+
+        dtypes = {
+            "previous": np.uint32,
+            "chi2": np.float32,
+            "pathLength": np.float64,
+            "typeFlags": np.uint64,
+            "hasPredicted": np.bool_,
+            "hasFiltered": np.bool_,
+            "hasSmoothed": np.bool_,
+        }
+        columns = {name: getattr(states, name) for name in dtypes}
+        for name, dtype in dtypes.items():
+            assert columns[name].dtype == dtype
+            assert columns[name].shape == (n,)
+
+        parameters = {
+            name: getattr(states, name)
+            for name in ["predicted", "filtered", "smoothed"]
+        }
+        for column in parameters.values():
+            assert column.dtype == np.float64 and column.shape == (n, 6)
+
+        for i in range(n):
+            state = states.getTrackState(i)
+            assert state.index == i
+            for name in dtypes:
+                assert columns[name][i] == getattr(state, name)
+            for name, column in parameters.items():
+                if getattr(state, "has" + name.capitalize()):
+                    assert np.array_equal(column[i], getattr(state, name))
+                else:
+                    assert np.all(np.isnan(column[i]))
+
+    def checkTracks(self, tracks):
+        n = len(tracks)
+        assert n > 0
+
+        parameters = tracks.parameters
+        covariances = tracks.covariances
+        assert parameters.shape == (n, 6) and parameters.strides == (48, 8)
+        assert covariances.shape == (n, 6, 6)
+        assert covariances.strides == (288, 8, 48)
+        assert not parameters.flags.writeable
+        assert not covariances.flags.writeable
+
+        names = {
+            "tipIndices": "tipIndex",
+            "stemIndices": "stemIndex",
+            "nMeasurements": "nMeasurements",
+            "nHoles": "nHoles",
+            "nOutliers": "nOutliers",
+            "nSharedHits": "nSharedHits",
+            "chi2": "chi2",
+            "nDoF": "nDoF",
+        }
+        columns = {name: getattr(tracks, name) for name in names}
+        for column in columns.values():
+            assert column.shape == (n,)
+            assert column.strides == (column.dtype.itemsize,)
+            assert not column.flags.writeable
+
+        for i in range(n):
+            track = tracks.getTrack(i)
+            assert track.index == i
+            for name, attribute in names.items():
+                assert columns[name][i] == getattr(track, attribute)
+            assert np.array_equal(parameters[i], track.parameters)
+            assert np.array_equal(covariances[i], track.covariance)
+
+    def execute(self, ctx):
+        self.checkSpacePoints(self.spacePoints(ctx))
+        tracks = self.tracks(ctx)
+        self.checkTracks(tracks)
+        self.checkTrackStates(tracks.trackStates)
+
+        self.events_seen += 1
+        return acts.examples.ProcessCode.SUCCESS
+
+
+def test_space_point_and_track_views(tmp_path, detector_config):
+    from ckf_tracks import runCKFTracks
+
+    field = acts.ConstantBField(acts.Vector3(0, 0, 2 * acts.UnitConstants.T))
+    s = acts.examples.Sequencer(numThreads=1, events=3)
+
+    with detector_config.detector:
+        runCKFTracks(
+            detector_config.trackingGeometry,
+            detector_config.decorators,
+            field=field,
+            outputCsv=False,
+            outputDir=tmp_path,
+            geometrySelection=detector_config.geometrySelection,
+            digiConfigFile=detector_config.digiConfigFile,
+            s=s,
+        )
+
+        alg = SpacePointTrackViewAlg(
+            "spacepoints",
+            "tracks",
+            name="space_point_track_views",
+            level=acts.logging.INFO,
+        )
+        s.addAlgorithm(alg)
+
+        s.run()
+
+    assert alg.events_seen == 3
@@ -361,6 +361,128 @@ def test_hepmc3_reader(tmp_path, rng, compression):
     assert "Failed to process event" in str(excinfo.value)
 
 
+def write_hepmc3_events(out, rng, events):
+    from acts.examples.hepmc3 import HepMC3Writer
+
+    s = Sequencer(numThreads=1, events=events)
+
+    evGen = acts.examples.EventGenerator(
+        level=acts.logging.DEBUG,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(50 * u.um, 50 * u.um, 150 * u.mm, 20 * u.ns),
+                    mean=acts.Vector4(0, 0, 0, 0),
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(100 * u.GeV, 100 * u.GeV),
+                    eta=(-2, 2),
+                    phi=(0, 360 * u.degree),
+                    randomizeCharge=True,
+                    numParticles=2,
+                ),
+            )
+        ],
+        randomNumbers=rng,
+    )
+
+    s.addReader(evGen)
+
+    out.parent.mkdir(parents=True, exist_ok=True)
+
+    s.addWriter(
+        HepMC3Writer(
+            acts.logging.DEBUG,
+            inputEvent="hepmc3_event",
+            outputPath=out,
+            perEvent=False,
+            compression=cm.none,
+        )
+    )
+
+    s.run()
+
+
+def test_hepmc3_indexed_reader(tmp_path, rng):
+    from acts.examples.hepmc3 import HepMC3IndexedReader
+
+    out = tmp_path / "out" / "events_pytest.hepmc3"
+    write_hepmc3_events(out, rng, 12)
+
+    # The second pass re-uses the index stored next to the input file
+    for _ in range(2):
+        s = Sequencer(numThreads=4)
+
+        s.addReader(
+            HepMC3IndexedReader(
+                acts.logging.DEBUG,
+                inputPath=out,
+                outputParticles="particles_read",
+                outputVertices="vertices_read",
+            )
+        )
+
+        alg = AssertCollectionExistsAlg(
+            [
+                "particles_read",
+                "vertices_read",
+            ],
+            "check_alg",
+            acts.logging.WARNING,
+        )
+        s.addAlgorithm(alg)
+
+        s.run()
+
+        assert alg.events_seen == 12
+        assert out.with_name(out.name + ".idx").exists()
+
+
+def test_pileup_overlay(tmp_path, rng):
+    from acts.examples.hepmc3 import HepMC3IndexedReader
+
+    out = tmp_path / "out" / "minbias_pytest.hepmc3"
+    write_hepmc3_events(out, rng, 6)
+
+    reader = HepMC3IndexedReader(
+        acts.logging.INFO,
+        inputPath=out,
+        outputParticles="particles_read",
+        outputVertices="vertices_read",
+    )
+    library = acts.examples.PileupLibrary(reader, nEvents=5)
+    # Every primary vertex is a separate entry
+    assert library.size == 10
+    assert library.numParticles == 20
+
+    s = Sequencer(numThreads=2, events=8)
+
+    s.addAlgorithm(
+        acts.examples.PileupOverlay(
+            level=acts.logging.DEBUG,
+            outputParticles="particles_pileup",
+            outputVertices="vertices_pileup",
+            library=library,
+            multiplicity=acts.examples.PoissonMultiplicityGenerator(mean=50),
+            vertex=acts.examples.GaussianVertexGenerator(
+                stddev=acts.Vector4(50 * u.um, 50 * u.um, 50 * u.mm, 0.2 * u.ns),
+                mean=acts.Vector4(0, 0, 0, 0),
+            ),
+            randomNumbers=rng,
+        )
+    )
+
+    alg = AssertCollectionExistsAlg(
+        ["particles_pileup", "vertices_pileup"], "check_alg", acts.logging.WARNING
+    )
+    s.addAlgorithm(alg)
+
+    s.run()
+
+    assert alg.events_seen == 8
+
+
 def test_hepmc3_reader_per_event(tmp_path, rng):
     from acts.examples.hepmc3 import (
         HepMC3Writer,
@@ -256,6 +256,36 @@ def test_csv_meas_writer(tmp_path, fatras, trk_geo, conf_const):
     assert all(f.stat().st_size > 10 for f in out.iterdir())
 
 
+@pytest.mark.csv
+def test_csv_meas_writer_parallel_over_modules(tmp_path, fatras, conf_const):
+    def run(numThreads):
+        s = Sequencer(numThreads=numThreads, events=10)
+        evGen, simAlg, digiAlg = fatras(s, parallelizeOverModules=True)
+
+        out = tmp_path / f"csv_{numThreads}"
+        out.mkdir()
+
+        s.addWriter(
+            conf_const(
+                CsvMeasurementWriter,
+                level=acts.logging.INFO,
+                inputMeasurements=digiAlg.config.outputMeasurements,
+                inputClusters=digiAlg.config.outputClusters,
+                inputMeasurementSimHitsMap=digiAlg.config.outputMeasurementSimHitsMap,
+                outputDir=str(out),
+            )
+        )
+        s.run()
+
+        return {f.name: f.read_bytes() for f in out.iterdir()}
+
+    # every module uses its own random number stream, which makes the output
+    # independent of the number of threads and of the processing order
+    single = run(1)
+    assert len(single) == 10 * 3
+    assert run(4) == single
+
+
 @pytest.mark.csv
 def test_csv_simhits_writer(tmp_path, fatras, conf_const):
     s = Sequencer(numThreads=1, events=10)
@@ -38,6 +38,33 @@ class Channelizer {
       const Hit& hit, const Acts::Surface& surface,
       const Acts::GeometryContext& gctx, const Acts::Vector3& driftDir,
       const Acts::BinUtility& segmentation, double thickness) const {
+    return channelizeImpl(hit, surface, gctx, driftDir, segmentation,
+                          thickness);
+  }
+
+  /// Do the geometric channelizing with a precomputed segmentation lookup
+  ///
+  /// @param hit The hit we want to channelize
+  /// @param surface the surface on which the hit is
+  /// @param gctx the Geometry context
+  /// @param driftDir the drift direction
+  /// @param lookup the precomputed segmentation lookup of the surface
+  /// @param thickness the thickness of the surface
+  ///
+  /// @return the list of channels
+  Acts::Result<std::vector<Segmentizer::ChannelSegment>> channelize(
+      const Hit& hit, const Acts::Surface& surface,
+      const Acts::GeometryContext& gctx, const Acts::Vector3& driftDir,
+      const Segmentizer::SegmentationLookup& lookup, double thickness) const {
+    return channelizeImpl(hit, surface, gctx, driftDir, lookup, thickness);
+  }
+
+ private:
+  template <typename segmentation_t>
+  Acts::Result<std::vector<Segmentizer::ChannelSegment>> channelizeImpl(
+      const Hit& hit, const Acts::Surface& surface,
+      const Acts::GeometryContext& gctx, const Acts::Vector3& driftDir,
+      const segmentation_t& segmentation, double thickness) const {
     auto driftedSegment = m_surfaceDrift.toReadout(
         gctx, surface, thickness, hit.position(), hit.direction(), driftDir);
 
@@ -10,13 +10,13 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
 
 #include <array>
 #include <utility>
 #include <vector>
 
 namespace Acts {
-class BinUtility;
 class Surface;
 }  // namespace Acts
 
@@ -80,6 +80,28 @@ struct Segmentizer {
         : bin(bin_), path2D(std::move(path2D_)), activation(activation_) {}
   };
 
+  /// Precomputed bin edges of a segmentation.
+  ///
+  /// Modules of the same type share their segmentation, so the lookup can be
+  /// built once per module type and reused for every hit. For cartesian
+  /// segmentations of planar surfaces it allows to traverse the channels
+  /// without allocating and sorting the boundary crossings.
+  struct SegmentationLookup {
+    /// The segmentation the lookup was built from
+    Acts::BinUtility segmentation;
+    /// The bin edges along the local x and y axes
+    std::array<std::vector<double>, 2> edges;
+    /// Whether the segmentation is cartesian and can use the edges
+    bool cartesian = false;
+
+    SegmentationLookup() = default;
+
+    /// Constructor from a segmentation
+    ///
+    /// @param segmentation_ The segmentation of the module type
+    explicit SegmentationLookup(const Acts::BinUtility& segmentation_);
+  };
+
   /// Divide the surface segment into channel segments.
   ///
   /// @note Channelizing is done in cartesian coordinates (start/end)
@@ -99,6 +121,24 @@ struct Segmentizer {
                                        const Acts::Surface& surface,
                                        const Acts::BinUtility& segmentation,
                                        const Segment2D& segment) const;
+
+  /// Divide the surface segment into channel segments using a precomputed
+  /// segmentation lookup.
+  ///
+  /// For planar surfaces with a cartesian segmentation the channels are
+  /// traversed in order along the segment, otherwise this falls back to the
+  /// generic method above. Both give the same channel segments.
+  ///
+  /// @param geoCtx The geometry context for the localToGlobal, etc.
+  /// @param surface The surface for the channelizing
+  /// @param lookup The precomputed segmentation lookup
+  /// @param segment The surface segment (cartesian coordinates)
+  ///
+  /// @return a vector of ChannelSegment objects
+  std::vector<ChannelSegment> segments(const Acts::GeometryContext& geoCtx,
+                                       const Acts::Surface& surface,
+                                       const SegmentationLookup& lookup,
+                                       const Segment2D& segment) const;
 };
 
 }  // namespace ActsFatras
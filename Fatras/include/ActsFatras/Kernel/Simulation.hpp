@@ -191,65 +191,14 @@ struct Simulation {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
-
     std::vector<FailedParticle> failedParticles;
 
     for (const Particle &inputParticle : inputParticles) {
-      // only consider simulatable particles
-      if (!selectParticle(inputParticle)) {
-        continue;
-      }
-      // required to allow correct particle id numbering for secondaries later
-      if ((inputParticle.particleId().generation() != 0u) ||
-          (inputParticle.particleId().subParticle() != 0u)) {
-        return detail::SimulationError::eInvalidInputParticleId;
-      }
-
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. To avoid issues, access must always
-      //         occur via indices.
-      auto iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
-
-        // only simulatable particles are pushed to the container and here we
-        // only need to switch between charged/neutral.
-        SingleParticleSimulationResult result =
-            SingleParticleSimulationResult::success({});
-        if (initialParticle.charge() != 0.) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
-
-        if (!result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
-
-        assert(result->particle.particleId() == initialParticle.particleId() &&
-               "Particle id must not change during simulation");
-
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+      auto result = simulateParticle(
+          geoCtx, magCtx, generator, inputParticle, simulatedParticlesInitial,
+          simulatedParticlesFinal, hits, failedParticles);
+      if (!result.ok()) {
+        return result.error();
       }
     }
 
@@ -264,6 +213,96 @@ struct Simulation {
     return failedParticles;
   }
 
+  /// Simulate a single input particle and its generated secondaries.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param inputParticle is the input particle that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param failedParticles contains all particles that failed to simulate
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  ///
+  /// This is the building block of `simulate` and has the same semantics for
+  /// a single input particle; input particles that do not pass the selection
+  /// are ignored. Since the simulation of one input particle is independent
+  /// of all others, the input particles of one event can be distributed over
+  /// multiple workers with separate generators and output containers.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_t, typename output_particles_t, typename hits_t>
+  Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &inputParticle,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::vector<FailedParticle> &failedParticles) const {
+    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
+
+    // only consider simulatable particles
+    if (!selectParticle(inputParticle)) {
+      return Acts::Result<void>::success();
+    }
+    // required to allow correct particle id numbering for secondaries later
+    if ((inputParticle.particleId().generation() != 0u) ||
+        (inputParticle.particleId().subParticle() != 0u)) {
+      return detail::SimulationError::eInvalidInputParticleId;
+    }
+
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are added to and failed
+    //         particles might be removed. To avoid issues, access must always
+    //         occur via indices.
+    auto iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
+      const auto &initialParticle = simulatedParticlesInitial[iinitial];
+
+      // only simulatable particles are pushed to the container and here we
+      // only need to switch between charged/neutral.
+      SingleParticleSimulationResult result =
+          SingleParticleSimulationResult::success({});
+      if (initialParticle.charge() != 0.) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
+      }
+
+      if (!result.ok()) {
+        // remove particle from output container since it was not simulated.
+        simulatedParticlesInitial.erase(
+            std::next(simulatedParticlesInitial.begin(), iinitial));
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        continue;
+      }
+
+      assert(result->particle.particleId() == initialParticle.particleId() &&
+             "Particle id must not change during simulation");
+
+      copyOutputs(result.value(), simulatedParticlesInitial,
+                  simulatedParticlesFinal, hits);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    }
+
+    return Acts::Result<void>::success();
+  }
+
  private:
   /// Select if the particle should be simulated at all.
   bool selectParticle(const Particle &particle) const {
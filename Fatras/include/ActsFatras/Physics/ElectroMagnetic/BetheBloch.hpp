@@ -14,6 +14,7 @@
 #include "ActsFatras/Utilities/LandauDistribution.hpp"
 
 #include <array>
+#include <span>
 
 namespace ActsFatras {
 
@@ -64,6 +65,36 @@ struct BetheBloch {
     // Generates no new particles
     return {};
   }
+
+  /// Simulate energy loss for particles crossing the same material.
+  ///
+  /// @param[in]     generator is the random number generator
+  /// @param[in]     slab      defines the passed material
+  /// @param[in,out] particles are the particles being updated
+  ///
+  /// @tparam generator_t is a RandomNumberEngine
+  ///
+  /// Equivalent to calling the single-particle operator for every particle in
+  /// order, i.e. it consumes the same random numbers.
+  template <typename generator_t>
+  void batch(generator_t &generator, const Acts::MaterialSlab &slab,
+             std::span<Particle> particles) const {
+    LandauDistribution lossDistribution;
+    for (Particle &particle : particles) {
+      const float m = particle.mass();
+      const float qOverP = particle.qOverP();
+      const float absQ = particle.absoluteCharge();
+      const float energyLoss =
+          Acts::computeEnergyLossLandau(slab, m, qOverP, absQ);
+      const float energyLossSigma =
+          Acts::computeEnergyLossLandauSigma(slab, m, qOverP, absQ);
+      const auto loss = lossDistribution(
+          generator,
+          LandauDistribution::param_type(scaleFactorMPV * energyLoss,
+                                         scaleFactorSigma * energyLossSigma));
+      particle.correctEnergy(-loss);
+    }
+  }
 };
 
 }  // namespace ActsFatras
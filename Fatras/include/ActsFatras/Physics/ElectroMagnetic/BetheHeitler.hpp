@@ -16,6 +16,8 @@
 #include <cmath>
 #include <numbers>
 #include <random>
+#include <span>
+#include <vector>
 
 namespace ActsFatras {
 
@@ -78,6 +80,46 @@ struct BetheHeitler {
 
     return {photon};
   }
+
+  /// Simulate energy loss for particles crossing the same material.
+  ///
+  /// @param[in]     generator is the random number generator
+  /// @param[in]     slab      defines the passed material
+  /// @param[in,out] particles are the particles being updated
+  /// @param[out]    photons   receives the produced photons, in particle order
+  ///
+  /// @tparam generator_t is a RandomNumberEngine
+  ///
+  /// The gamma distribution only depends on the material and is set up once
+  /// for all particles; its internal state is shared between the draws. The
+  /// random number sequence therefore differs from the single-particle
+  /// operator.
+  template <typename generator_t>
+  void batch(generator_t &generator, const Acts::MaterialSlab &slab,
+             std::span<Particle> particles,
+             std::vector<Particle> &photons) const {
+    std::gamma_distribution<double> gDist(
+        slab.thicknessInX0() / std::numbers::ln2, 1.);
+    std::uniform_real_distribution<double> uDist(0., 1.);
+    photons.reserve(photons.size() + particles.size());
+    for (Particle &particle : particles) {
+      const auto u = gDist(generator);
+      const auto z = std::exp(-u);  // MARK: fpeMask(FLTUND, 1, #2346)
+      const auto sampledEnergyLoss =
+          std::abs(scaleFactor * particle.energy() * (z - 1.));
+
+      const double rndPsi = uDist(generator);
+      const double rndTheta1 = uDist(generator);
+      const double rndTheta2 = uDist(generator);
+      const double rndTheta3 = uDist(generator);
+      const Particle &photon =
+          photons.emplace_back(bremPhoton(particle, sampledEnergyLoss, rndPsi,
+                                          rndTheta1, rndTheta2, rndTheta3));
+      particle.setDirection(particle.direction() * particle.absoluteMomentum() -
+                            photon.energy() * photon.direction());
+      particle.correctEnergy(-sampledEnergyLoss);
+    }
+  }
 };
 
 }  // namespace ActsFatras
@@ -17,8 +17,11 @@
 #include "ActsFatras/Physics/ElectroMagnetic/detail/Highland.hpp"
 
 #include <array>
+#include <cmath>
 #include <numbers>
 #include <random>
+#include <span>
+#include <vector>
 
 namespace ActsFatras {
 
@@ -58,6 +61,18 @@ struct GenericScattering {
     // draw the scattering angle
     const auto theta = angle(generator, slab, particle);
 
+    scatter(psi, theta, particle);
+
+    // scattering is non-destructive and produces no secondaries
+    return {};
+  }
+
+  /// Rotate the particle direction by the given scattering angles.
+  ///
+  /// @param[in]     psi      is the deflector orientation angle
+  /// @param[in]     theta    is the scattering angle
+  /// @param[in,out] particle is the particle being updated
+  static void scatter(double psi, double theta, Particle &particle) {
     Acts::Vector3 direction = particle.direction();
     // construct the combined rotation to the scattered direction
     Acts::RotationMatrix3 rotation(
@@ -67,9 +82,54 @@ struct GenericScattering {
         Acts::AngleAxis3(theta, Acts::createCurvilinearUnitU(direction)));
     direction.applyOnTheLeft(rotation);
     particle.setDirection(direction);
+  }
 
-    // scattering is non-destructive and produces no secondaries
-    return {};
+  /// Simulate scattering for particles crossing the same material.
+  ///
+  /// @param[in]     generator is the random number generator
+  /// @param[in]     slab      defines the passed material
+  /// @param[in,out] particles are the particles being updated
+  ///
+  /// @tparam generator_t is a RandomNumberEngine
+  ///
+  /// Statistically equivalent to calling the single-particle operator for
+  /// every particle. Scattering models that provide a batch interface sample
+  /// all angles in one go and the scattered directions are computed in closed
+  /// form instead of composing two rotation matrices per particle. The random
+  /// number sequence differs from the single-particle operator.
+  template <typename generator_t>
+  void batch(generator_t &generator, const Acts::MaterialSlab &slab,
+             std::span<Particle> particles) const {
+    std::vector<double> thetas(particles.size());
+    if constexpr (requires {
+                    angle.batch(generator, slab,
+                                std::span<const Particle>(particles),
+                                std::span<double>(thetas));
+                  }) {
+      angle.batch(generator, slab, std::span<const Particle>(particles),
+                  std::span<double>(thetas));
+    } else {
+      for (std::size_t i = 0; i < particles.size(); ++i) {
+        thetas[i] = angle(generator, slab, particles[i]);
+      }
+    }
+
+    std::uniform_real_distribution<double> psiDist(-std::numbers::pi,
+                                                   std::numbers::pi);
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+      const auto psi = psiDist(generator);
+      const Acts::Vector3 direction = particles[i].direction();
+      // rotating the direction by theta around the deflector axis U and then
+      // by psi around the initial direction is equivalent to
+      //   cos(theta) d + sin(theta) (sin(psi) U - cos(psi) V)
+      // with the curvilinear unit vectors U, V = d x U
+      const Acts::Vector3 u = Acts::createCurvilinearUnitU(direction);
+      const Acts::Vector3 v = direction.cross(u);
+      const double sinTheta = std::sin(thetas[i]);
+      particles[i].setDirection(
+          std::cos(thetas[i]) * direction +
+          sinTheta * (std::sin(psi) * u - std::cos(psi) * v));
+    }
   }
 };
 
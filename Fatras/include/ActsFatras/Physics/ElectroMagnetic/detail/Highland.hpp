@@ -12,6 +12,7 @@
 
 #include <numbers>
 #include <random>
+#include <span>
 
 namespace ActsFatras::detail {
 
@@ -39,6 +40,31 @@ struct Highland {
     return std::normal_distribution<double>(
         0., std::numbers::sqrt2 * theta0)(generator);
   }
+
+  /// Generate 3D scattering angles for particles crossing the same material.
+  ///
+  /// @param[in]  generator is the random number generator
+  /// @param[in]  slab      defines the passed material
+  /// @param[in]  particles are the particles being scattered
+  /// @param[out] angles    are the 3d scattering angles, one per particle
+  ///
+  /// @tparam generator_t is a RandomNumberEngine
+  ///
+  /// A single standard normal distribution is shared by all particles, so
+  /// both values of every generated pair are used.
+  template <typename generator_t>
+  void batch(generator_t &generator, const Acts::MaterialSlab &slab,
+             std::span<const Particle> particles,
+             std::span<double> angles) const {
+    std::normal_distribution<double> normal(0., 1.);
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+      const Particle &particle = particles[i];
+      const auto theta0 = Acts::computeMultipleScatteringTheta0(
+          slab, particle.absolutePdg(), particle.mass(), particle.qOverP(),
+          particle.absoluteCharge());
+      angles[i] = std::numbers::sqrt2 * theta0 * normal(generator);
+    }
+  }
 };
 
 }  // namespace ActsFatras::detail
@@ -0,0 +1,151 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "Acts/Material/Interactions.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/BetheBloch.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/BetheHeitler.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/Scattering.hpp"
+#include "ActsFatras/Utilities/LandauDistribution.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace ActsFatras {
+
+/// Fused electro-magnetic interactions for charged particles.
+///
+/// Implements the same physics as `StandardChargedElectroMagneticInteractions`
+/// and can be used as a drop-in replacement for it in the simulation. Instead
+/// of running each process separately through the generic interaction list,
+/// all continuous processes are evaluated in a single pass: the material
+/// constants of the slab and the relativistic quantities of the particle are
+/// computed only once and shared between scattering and ionisation loss.
+///
+/// The random numbers are consumed in the same order as by the standard list,
+/// i.e. both give identical results for identical random number generators.
+///
+/// @tparam kScattering enable Highland multiple scattering
+/// @tparam kIonisation enable Bethe-Bloch ionisation energy loss
+/// @tparam kBremsstrahlung enable Bethe-Heitler Bremsstrahlung energy loss
+///
+/// Disabled processes are removed at compile time.
+template <bool kScattering = true, bool kIonisation = true,
+          bool kBremsstrahlung = true>
+class FusedChargedElectroMagneticInteractions {
+ public:
+  /// Point-like interaction selection, compatible with `InteractionList`.
+  struct Selection {
+    double x0Limit = std::numeric_limits<double>::infinity();
+    double l0Limit = std::numeric_limits<double>::infinity();
+    std::size_t x0Process = std::numeric_limits<std::size_t>::max();
+    std::size_t l0Process = std::numeric_limits<std::size_t>::max();
+  };
+
+  /// Ionisation energy loss configuration
+  BetheBloch betheBloch;
+  /// Bremsstrahlung energy loss configuration
+  BetheHeitler betheHeitler;
+  /// Lower p cut on output and generated particles
+  double minimumAbsMomentum = 0.;
+
+  /// Simulate the effects from the continuous interactions.
+  ///
+  /// @tparam generator_t must be a RandomNumberEngine
+  /// @param[in]     rng       is the random number generator
+  /// @param[in]     slab      is the passed material
+  /// @param[in,out] particle  is the particle being updated
+  /// @param[out]    generated is the container of generated particles
+  /// @return Break condition, i.e. whether a process stopped the propagation
+  template <typename generator_t>
+  bool runContinuous(generator_t& rng, const Acts::MaterialSlab& slab,
+                     Particle& particle,
+                     std::vector<Particle>& generated) const {
+    if constexpr (kScattering || kIonisation) {
+      if (particle.charge() != 0. &&
+          runChargedContinuous(rng, slab, particle)) {
+        return true;
+      }
+    }
+    if constexpr (kBremsstrahlung) {
+      if (particle.absolutePdg() == Acts::PdgParticle::eElectron) {
+        auto [photon] = betheHeitler(rng, slab, particle);
+        if (minimumAbsMomentum <= photon.absoluteMomentum()) {
+          generated.push_back(photon);
+        }
+        return particle.absoluteMomentum() < minimumAbsMomentum;
+      }
+    }
+    return false;
+  }
+
+  /// Arm the point-like interactions; there are none.
+  template <typename generator_t>
+  Selection armPointLike(generator_t& /*rng*/,
+                         const Particle& /*particle*/) const {
+    return {};
+  }
+
+  /// Simulate a single point-like interaction; there are none.
+  template <typename generator_t>
+  bool runPointLike(generator_t& /*rng*/, std::size_t /*processIndex*/,
+                    Particle& /*particle*/,
+                    std::vector<Particle>& /*generated*/) const {
+    return false;
+  }
+
+ private:
+  template <typename generator_t>
+  bool runChargedContinuous(generator_t& rng, const Acts::MaterialSlab& slab,
+                            Particle& particle) const {
+    // scattering only changes the direction and leaves the inputs unchanged,
+    // the parameters stay valid for the ionisation loss
+    const Acts::MaterialSlabConstants constants(slab);
+    const Acts::ContinuousInteractionParameters parameters =
+        Acts::computeContinuousInteractionParameters(
+            constants, particle.absolutePdg(), particle.mass(),
+            particle.qOverP(), particle.absoluteCharge());
+
+    if constexpr (kScattering) {
+      const auto psi = std::uniform_real_distribution<double>(
+          -std::numbers::pi, std::numbers::pi)(rng);
+      const auto theta = std::normal_distribution<double>(
+          0., std::numbers::sqrt2 * parameters.theta0)(rng);
+      HighlandScattering::scatter(psi, theta, particle);
+    }
+    if constexpr (kIonisation) {
+      LandauDistribution lossDistribution(
+          betheBloch.scaleFactorMPV * parameters.energyLossLandau,
+          betheBloch.scaleFactorSigma * parameters.energyLossLandauSigma);
+      const auto loss = lossDistribution(rng);
+      particle.correctEnergy(-loss);
+      return particle.absoluteMomentum() < minimumAbsMomentum;
+    }
+    return false;
+  }
+};
+
+/// Construct the fused electro-magnetic interactions for charged particles.
+///
+/// @param minimumAbsMomentum lower p cut on output particles
+inline FusedChargedElectroMagneticInteractions<>
+makeFusedChargedElectroMagneticInteractions(double minimumAbsMomentum) {
+  FusedChargedElectroMagneticInteractions<> interactions;
+  interactions.minimumAbsMomentum = minimumAbsMomentum;
+  return interactions;
+}
+
+}  // namespace ActsFatras
@@ -17,8 +17,25 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 
+ActsFatras::Segmentizer::SegmentationLookup::SegmentationLookup(
+    const Acts::BinUtility& segmentation_)
+    : segmentation(segmentation_) {
+  const auto& binningData = segmentation.binningData();
+  // The cartesian traversal reads the first axis from local x and the second
+  // one from local y, like the generic planar method
+  cartesian = binningData.size() == 2 &&
+              binningData[0].binvalue == Acts::AxisDirection::AxisX &&
+              binningData[1].binvalue == Acts::AxisDirection::AxisY;
+  for (std::size_t i = 0; i < binningData.size() && i < 2; ++i) {
+    const auto& boundaries = binningData[i].boundaries();
+    edges[i].assign(boundaries.begin(), boundaries.end());
+  }
+}
+
 std::vector<ActsFatras::Segmentizer::ChannelSegment>
 ActsFatras::Segmentizer::segments(const Acts::GeometryContext& geoCtx,
                                   const Acts::Surface& surface,
@@ -163,3 +180,91 @@ ActsFatras::Segmentizer::segments(const Acts::GeometryContext& geoCtx,
 
   return cSegments;
 }
+
+std::vector<ActsFatras::Segmentizer::ChannelSegment>
+ActsFatras::Segmentizer::segments(const Acts::GeometryContext& geoCtx,
+                                  const Acts::Surface& surface,
+                                  const SegmentationLookup& lookup,
+                                  const Segment2D& segment) const {
+  if (!lookup.cartesian ||
+      surface.type() != Acts::Surface::SurfaceType::Plane) {
+    return segments(geoCtx, surface, lookup.segmentation, segment);
+  }
+
+  const auto& binningData = lookup.segmentation.binningData();
+
+  // Start and end point
+  const auto& start = segment[0];
+  const auto& end = segment[1];
+  const Acts::Vector2 segment2d = end - start;
+
+  const Bin2D bstart = {
+      static_cast<unsigned int>(binningData[0].searchLocal(start)),
+      static_cast<unsigned int>(binningData[1].searchLocal(start))};
+  const Bin2D bend = {
+      static_cast<unsigned int>(binningData[0].searchLocal(end)),
+      static_cast<unsigned int>(binningData[1].searchLocal(end))};
+
+  // Fast single channel exit
+  if (bstart == bend) {
+    return {ChannelSegment(bstart, {start, end}, segment2d.norm())};
+  }
+
+  // Digital differential analyzer: the number of boundary crossings along
+  // each axis is known from the start and end bins, and the next crossing is
+  // always the one with the smaller fraction of the segment
+  std::array<int, 2> step = {0, 0};
+  std::array<unsigned int, 2> nCrossings = {0, 0};
+  std::array<double, 2> nextFraction = {
+      std::numeric_limits<double>::infinity(),
+      std::numeric_limits<double>::infinity()};
+  std::array<std::size_t, 2> nextEdge = {0, 0};
+  for (std::size_t i = 0; i < 2; ++i) {
+    if (bstart[i] == bend[i]) {
+      continue;
+    }
+    step[i] = bstart[i] < bend[i] ? 1 : -1;
+    nCrossings[i] = static_cast<unsigned int>(
+        std::abs(static_cast<int>(bend[i]) - static_cast<int>(bstart[i])));
+    nextEdge[i] = step[i] > 0 ? bstart[i] + 1 : bstart[i];
+    nextFraction[i] = (lookup.edges[i][nextEdge[i]] - start[i]) / segment2d[i];
+  }
+
+  const double length = segment2d.norm();
+
+  std::vector<ChannelSegment> cSegments;
+  cSegments.reserve(nCrossings[0] + nCrossings[1] + 1);
+
+  Bin2D currentBin = bstart;
+  Acts::Vector2 lastIntersect = start;
+  double lastPath = 0.;
+  while (nCrossings[0] + nCrossings[1] > 0) {
+    // Ties, i.e. crossing through a corner, are resolved along x first
+    const std::size_t i =
+        (nCrossings[0] > 0 &&
+         (nCrossings[1] == 0 || nextFraction[0] <= nextFraction[1]))
+            ? 0
+            : 1;
+    const std::size_t j = 1 - i;
+
+    Acts::Vector2 intersect;
+    intersect[i] = lookup.edges[i][nextEdge[i]];
+    intersect[j] = start[j] + nextFraction[i] * segment2d[j];
+    const double path = (intersect - start).norm();
+    cSegments.push_back(ChannelSegment(currentBin, {lastIntersect, intersect},
+                                       path - lastPath));
+
+    currentBin[i] += step[i];
+    lastIntersect = intersect;
+    lastPath = path;
+    if (--nCrossings[i] > 0) {
+      nextEdge[i] = step[i] > 0 ? nextEdge[i] + 1 : nextEdge[i] - 1;
+      nextFraction[i] =
+          (lookup.edges[i][nextEdge[i]] - start[i]) / segment2d[i];
+    }
+  }
+  cSegments.push_back(
+      ChannelSegment(currentBin, {lastIntersect, end}, length - lastPath));
+
+  return cSegments;
+}
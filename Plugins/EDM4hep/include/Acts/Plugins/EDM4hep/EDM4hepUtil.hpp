@@ -22,7 +22,9 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
 
+#include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 #include <Eigen/src/Core/util/Memory.h>
 #include <boost/graph/graph_traits.hpp>
@@ -69,16 +71,25 @@ edm4hep::MCParticle getParticle(const edm4hep::SimTrackerHit& hit);
 void setParticle(edm4hep::MutableSimTrackerHit& hit,
                  const edm4hep::MCParticle& particle);
 
+/// Convert the measurement states and the IP parameters of a track into
+/// EDM4hep track states.
+///
+/// This does not touch any podio collection and can be called concurrently
+/// for different tracks, e.g. to convert all tracks of an event in parallel
+/// before they are added to a collection.
+///
+/// @param gctx The geometry context
+/// @param track The track to convert
+/// @param outTrackStates The converted track states are appended here
+/// @param Bz The magnetic field along the z axis
+/// @param logger The logger
 template <TrackProxyConcept track_proxy_t>
-void writeTrack(const Acts::GeometryContext& gctx, track_proxy_t track,
-                edm4hep::MutableTrack to, double Bz,
-                const Logger& logger = getDummyLogger()) {
-  ACTS_VERBOSE("Converting track to EDM4hep");
-  to.setChi2(track.chi2());
-  to.setNdf(track.nDoF());
-
-  std::vector<edm4hep::TrackState> outTrackStates;
-  outTrackStates.reserve(track.nTrackStates());
+void convertTrackStates(const Acts::GeometryContext& gctx,
+                        track_proxy_t track,
+                        std::vector<edm4hep::TrackState>& outTrackStates,
+                        double Bz, const Logger& logger = getDummyLogger()) {
+  const std::size_t firstState = outTrackStates.size();
+  outTrackStates.reserve(firstState + track.nTrackStates() + 1);
 
   auto setParameters = [](edm4hep::TrackState& trackState,
                           const detail::Parameters& params) {
@@ -130,8 +141,10 @@ void writeTrack(const Acts::GeometryContext& gctx, track_proxy_t track,
     trackState.referencePoint.z = center.z();
     ACTS_VERBOSE("- ref surface ctr: " << center.transpose());
   }
-  outTrackStates.front().location = edm4hep::TrackState::AtLastHit;
-  outTrackStates.back().location = edm4hep::TrackState::AtFirstHit;
+  if (outTrackStates.size() > firstState) {
+    outTrackStates[firstState].location = edm4hep::TrackState::AtLastHit;
+    outTrackStates.back().location = edm4hep::TrackState::AtFirstHit;
+  }
 
   // Add a track state that represents the IP parameters
   auto& ipState = outTrackStates.emplace_back();
@@ -163,12 +176,36 @@ void writeTrack(const Acts::GeometryContext& gctx, track_proxy_t track,
   ipState.referencePoint.z = center.z();
 
   ACTS_VERBOSE("- ref surface ctr: " << center.transpose());
+}
 
-  for (auto& trackState : outTrackStates) {
+/// Write a track with already converted track states to EDM4hep.
+///
+/// @param track The track to write the track level quantities from
+/// @param trackStates The track states converted with `convertTrackStates`
+/// @param to The EDM4hep track to fill
+template <TrackProxyConcept track_proxy_t>
+void writeTrack(track_proxy_t track,
+                const std::vector<edm4hep::TrackState>& trackStates,
+                edm4hep::MutableTrack to) {
+  to.setChi2(track.chi2());
+  to.setNdf(track.nDoF());
+
+  for (const auto& trackState : trackStates) {
     to.addToTrackStates(trackState);
   }
 }
 
+template <TrackProxyConcept track_proxy_t>
+void writeTrack(const Acts::GeometryContext& gctx, track_proxy_t track,
+                edm4hep::MutableTrack to, double Bz,
+                const Logger& logger = getDummyLogger()) {
+  ACTS_VERBOSE("Converting track to EDM4hep");
+  std::vector<edm4hep::TrackState> outTrackStates;
+  convertTrackStates(gctx, track, outTrackStates, Bz, logger);
+
+  writeTrack(track, outTrackStates, to);
+}
+
 template <TrackProxyConcept track_proxy_t>
 void readTrack(const edm4hep::Track& from, track_proxy_t& track, double Bz,
                const Logger& logger = getDummyLogger()) {
@@ -139,8 +139,8 @@ Acts::ISurfaceMaterial* indexedMaterialFromJson(nlohmann::json& jMaterial) {
   // Load accessor and grid
   nlohmann::json jMaterialAccessor = jMaterial["accessor"];
 
-  // Prepare the material and its accessor
-  IndexedAccessorType materialAccessor(std::vector<Acts::MaterialSlab>{});
+  // Prepare the material
+  std::vector<Acts::MaterialSlab> material;
 
   // If it's locally indexed, we need to load the material vector
   if constexpr (std::is_same_v<IndexedAccessorType,
@@ -149,10 +149,13 @@ Acts::ISurfaceMaterial* indexedMaterialFromJson(nlohmann::json& jMaterial) {
     for (const auto& msl : jMaterialAccessor["storage_vector"]) {
       Acts::MaterialSlab mat = Acts::MaterialSlab::Nothing();
       from_json(msl, mat);
-      materialAccessor.material.push_back(mat);
+      material.push_back(mat);
     }
   }
 
+  // The accessor is created with the complete material vector
+  IndexedAccessorType materialAccessor(std::move(material));
+
   // Now make the grid and the axes
   nlohmann::json jGrid = jMaterialAccessor["grid"];
   nlohmann::json jGridAxes = jGrid["axes"];
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <any>
+#include <cassert>
 #include <string>
 #include <string_view>
 
@@ -37,7 +38,8 @@ struct ConstDynamicColumn : public ConstDynamicColumnBase {
       : ConstDynamicColumnBase(name), m_collection{collection} {}
 
   std::any get(std::size_t i) const override {
-    return &m_collection.vec().at(i);
+    assert(i < m_collection.size() && "Index out of range");
+    return &m_collection.vec()[i];
   }
   std::size_t size() const override { return m_collection.size(); }
 
@@ -53,6 +55,7 @@ struct DynamicColumnBase : public ConstDynamicColumnBase {
 
   virtual void add() = 0;
   virtual void clear() = 0;
+  virtual void reserve(std::size_t size) = 0;
   virtual void erase(std::size_t i) = 0;
   virtual void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
                         std::size_t srcIdx) = 0;
@@ -72,14 +75,19 @@ struct DynamicColumn : public DynamicColumnBase {
                          podio::UserDataCollection<T> collection = {})
       : DynamicColumnBase(name), m_collection{std::move(collection)} {}
 
-  std::any get(std::size_t i) override { return &m_collection.vec().at(i); }
+  std::any get(std::size_t i) override {
+    assert(i < m_collection.size() && "Index out of range");
+    return &m_collection.vec()[i];
+  }
 
   std::any get(std::size_t i) const override {
-    return &m_collection.vec().at(i);
+    assert(i < m_collection.size() && "Index out of range");
+    return &m_collection.vec()[i];
   }
 
   void add() override { m_collection.vec().emplace_back(); }
   void clear() override { m_collection.clear(); }
+  void reserve(std::size_t size) override { m_collection.vec().reserve(size); }
   void erase(std::size_t i) override {
     m_collection.vec().erase(m_collection.vec().begin() + i);
   }
@@ -90,10 +98,7 @@ struct DynamicColumn : public DynamicColumnBase {
       return std::make_unique<DynamicColumn<T>>(m_name);
     }
     podio::UserDataCollection<T> copy;
-    copy.vec().reserve(m_collection.size());
-    for (const T& v : m_collection) {
-      copy.push_back(v);
-    }
+    copy.vec() = m_collection.vec();
     return std::make_unique<DynamicColumn<T>>(m_name, std::move(copy));
   }
 
@@ -27,9 +27,11 @@
 #include "ActsPodioEdm/TrackInfo.h"
 #pragma GCC diagnostic pop
 
+#include <cassert>
 #include <mutex>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <podio/Frame.h>
 
@@ -76,15 +78,10 @@ class PodioTrackContainerBase {
     }
 
     using namespace Acts::HashedStringLiteral;
-    auto track = instance.m_collection->at(itrack);
+    assert(itrack < instance.m_data.size() && "Track index out of range");
     std::conditional_t<EnsureConst, const ActsPodioEdm::TrackInfo*,
                        ActsPodioEdm::TrackInfo*>
-        dataPtr;
-    if constexpr (EnsureConst) {
-      dataPtr = &track.getData();
-    } else {
-      dataPtr = &PodioUtil::getDataMutable(track);
-    }
+        dataPtr = instance.m_data[itrack];
     auto& data = *dataPtr;
     switch (key) {
       case "tipIndex"_hash:
@@ -150,6 +147,18 @@ class PodioTrackContainerBase {
     }
   }
 
+  /// The track data is owned by the collection objects, which do not move
+  /// when the collection grows. Pointers to it are cached so that the hot
+  /// accessors do not need to go through the collection object handles.
+  static void populateDataBuffer(
+      const ActsPodioEdm::TrackCollection& collection,
+      std::vector<const ActsPodioEdm::TrackInfo*>& data) {
+    data.reserve(collection.size());
+    for (ActsPodioEdm::Track track : collection) {
+      data.push_back(&track.getData());
+    }
+  }
+
   std::reference_wrapper<const PodioUtil::ConversionHelper> m_helper;
   std::vector<std::shared_ptr<const Surface>> m_surfaces;
 };
@@ -195,12 +204,20 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
 
   std::size_t size_impl() const { return m_collection->size(); }
 
-  void clear() { m_collection->clear(); }
+  void clear() {
+    m_collection->clear();
+    m_data.clear();
+    m_surfaces.clear();
+    for (const auto& [key, col] : m_dynamic) {
+      col->clear();
+    }
+  }
 
   // END INTERFACE HELPER
 
   const Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_surfaces.at(itrack).get();
+    assert(itrack < m_surfaces.size() && "Track index out of range");
+    return m_surfaces[itrack].get();
   }
 
   ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
@@ -228,6 +245,7 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
     auto track = m_collection->create();
     PodioUtil::getReferenceSurfaceMutable(track).surfaceType =
         PodioUtil::kNoSurface;
+    m_data.push_back(&PodioUtil::getDataMutable(track));
     m_surfaces.emplace_back();
     for (const auto& [key, vec] : m_dynamic) {
       vec->add();
@@ -245,23 +263,19 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   }
 
   Parameters parameters(IndexType itrack) {
-    return Parameters{
-        PodioUtil::getDataMutable(m_collection->at(itrack)).parameters.data()};
+    return Parameters{m_data[itrack]->parameters.data()};
   }
 
   ConstParameters parameters(IndexType itrack) const {
-    return ConstParameters{
-        m_collection->at(itrack).getData().parameters.data()};
+    return ConstParameters{m_data[itrack]->parameters.data()};
   }
 
   Covariance covariance(IndexType itrack) {
-    return Covariance{
-        PodioUtil::getDataMutable(m_collection->at(itrack)).covariance.data()};
+    return Covariance{m_data[itrack]->covariance.data()};
   }
 
   ConstCovariance covariance(IndexType itrack) const {
-    return ConstCovariance{
-        m_collection->at(itrack).getData().covariance.data()};
+    return ConstCovariance{m_data[itrack]->covariance.data()};
   }
 
   void copyDynamicFrom_impl(IndexType dstIdx, HashedString key,
@@ -277,7 +291,16 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
 
   void ensureDynamicColumns_impl(const MutablePodioTrackContainer& other);
 
-  void reserve(IndexType /*size*/) {}
+  /// Podio collections cannot reserve storage for their objects, so this
+  /// only reserves the cached data pointers, the surface buffer and the
+  /// dynamic columns.
+  void reserve(IndexType size) {
+    m_data.reserve(size);
+    m_surfaces.reserve(size);
+    for (const auto& [key, col] : m_dynamic) {
+      col->reserve(size);
+    }
+  }
 
   ActsPodioEdm::TrackCollection& trackCollection() { return *m_collection; }
 
@@ -286,7 +309,12 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
     if (!s.empty()) {
       s = "_" + s;
     }
+    [[maybe_unused]] const auto* collection = m_collection.get();
     frame.put(std::move(m_collection), "tracks" + s);
+    assert(frame.get("tracks" + s) == collection &&
+           PodioUtil::isDataBufferConsistent(*collection, m_data) &&
+           "Cached track data does not match the collection");
+    m_data.clear();
     m_surfaces.clear();
 
     for (const auto& [key, col] : m_dynamic) {
@@ -314,6 +342,7 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   friend PodioTrackContainerBase;
 
   std::unique_ptr<ActsPodioEdm::TrackCollection> m_collection;
+  std::vector<ActsPodioEdm::TrackInfo*> m_data;
   std::vector<HashedString> m_dynamicKeys;
   std::unordered_map<HashedString,
                      std::unique_ptr<podio_detail::DynamicColumnBase>>
@@ -331,6 +360,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
       : PodioTrackContainerBase{helper}, m_collection{&collection} {
     // Not much we can do to recover dynamic columns here
     populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    populateDataBuffer(*m_collection, m_data);
   }
 
   ConstPodioTrackContainer(const PodioUtil::ConversionHelper& helper,
@@ -357,6 +387,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
     }
 
     populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    populateDataBuffer(*m_collection, m_data);
 
     podio_detail::recoverDynamicColumns(frame, tracksKey, m_dynamic);
   }
@@ -372,7 +403,8 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   std::size_t size_impl() const { return m_collection->size(); }
 
   const Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_surfaces.at(itrack).get();
+    assert(itrack < m_surfaces.size() && "Track index out of range");
+    return m_surfaces[itrack].get();
   }
 
   ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
@@ -380,13 +412,11 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   }
 
   ConstParameters parameters(IndexType itrack) const {
-    return ConstParameters{
-        m_collection->at(itrack).getData().parameters.data()};
+    return ConstParameters{m_data[itrack]->parameters.data()};
   }
 
   ConstCovariance covariance(IndexType itrack) const {
-    return ConstCovariance{
-        m_collection->at(itrack).getData().covariance.data()};
+    return ConstCovariance{m_data[itrack]->covariance.data()};
   }
 
   const ActsPodioEdm::TrackCollection& trackCollection() {
@@ -402,6 +432,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   friend PodioTrackContainerBase;
 
   const ActsPodioEdm::TrackCollection* m_collection;
+  std::vector<const ActsPodioEdm::TrackInfo*> m_data;
   std::unordered_map<HashedString,
                      std::unique_ptr<podio_detail::ConstDynamicColumnBase>>
       m_dynamic;
@@ -29,10 +29,12 @@
 #pragma GCC diagnostic pop
 
 #include <any>
+#include <cassert>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <podio/CollectionBase.h>
 #include <podio/Frame.h>
@@ -60,8 +62,8 @@ class PodioTrackStateContainerBase {
                                  TrackIndexType istate) {
     constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
     using namespace Acts::HashedStringLiteral;
-    auto trackState = instance.m_collection->at(istate);
-    const auto& data = trackState.getData();
+    assert(istate < instance.m_data.size() && "Track state out of range");
+    const ActsPodioEdm::TrackStateInfo& data = *instance.m_data[istate];
     switch (key) {
       case "predicted"_hash:
         return data.ipredicted != kInvalid;
@@ -102,15 +104,10 @@ class PodioTrackStateContainerBase {
                     "Is not const");
     }
     using namespace Acts::HashedStringLiteral;
-    auto trackState = instance.m_collection->at(istate);
+    assert(istate < instance.m_data.size() && "Track state out of range");
     std::conditional_t<EnsureConst, const ActsPodioEdm::TrackStateInfo*,
                        ActsPodioEdm::TrackStateInfo*>
-        dataPtr;
-    if constexpr (EnsureConst) {
-      dataPtr = &trackState.getData();
-    } else {
-      dataPtr = &PodioUtil::getDataMutable(trackState);
-    }
+        dataPtr = instance.m_data[istate];
     auto& data = *dataPtr;
     switch (key) {
       case "previous"_hash:
@@ -180,6 +177,18 @@ class PodioTrackStateContainerBase {
           helper, trackState.getReferenceSurface()));
     }
   }
+
+  /// The data is owned by the collection objects, which do not move when the
+  /// collection grows. Pointers to it are cached so that the hot accessors do
+  /// not need to go through the collection object handles.
+  template <typename collection_t, typename data_t>
+  static void populateDataBuffer(const collection_t& collection,
+                                 std::vector<const data_t*>& data) {
+    data.reserve(collection.size());
+    for (auto object : collection) {
+      data.push_back(&object.getData());
+    }
+  }
 };
 
 template <>
@@ -201,6 +210,7 @@ class ConstPodioTrackStateContainer final
         m_jacs{&jacs} {
     // Not much we can do to recover dynamic columns here
     populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    populateDataBuffers();
   }
 
   /// Construct a const track state container from a mutable
@@ -247,6 +257,7 @@ class ConstPodioTrackStateContainer final
     loadCollection<ActsPodioEdm::JacobianCollection>(m_jacs, frame, jacsKey);
 
     populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    populateDataBuffers();
 
     podio_detail::recoverDynamicColumns(frame, trackStatesKey, m_dynamic);
   }
@@ -257,6 +268,12 @@ class ConstPodioTrackStateContainer final
   }
 
  private:
+  void populateDataBuffers() {
+    populateDataBuffer(*m_collection, m_data);
+    populateDataBuffer(*m_params, m_paramsData);
+    populateDataBuffer(*m_jacs, m_jacsData);
+  }
+
   template <typename collection_t>
   static void loadCollection(collection_t const*& dest,
                              const podio::Frame& frame,
@@ -273,30 +290,30 @@ class ConstPodioTrackStateContainer final
 
  public:
   ConstParameters parameters_impl(IndexType istate) const {
-    return ConstParameters{m_params->at(istate).getData().values.data()};
+    return ConstParameters{m_paramsData[istate]->values.data()};
   }
 
   ConstCovariance covariance_impl(IndexType istate) const {
-    return ConstCovariance{m_params->at(istate).getData().covariance.data()};
+    return ConstCovariance{m_paramsData[istate]->covariance.data()};
   }
 
   ConstCovariance jacobian_impl(IndexType istate) const {
-    IndexType ijacobian = m_collection->at(istate).getData().ijacobian;
-    return ConstCovariance{m_jacs->at(ijacobian).getData().values.data()};
+    IndexType ijacobian = m_data[istate]->ijacobian;
+    return ConstCovariance{m_jacsData[ijacobian]->values.data()};
   }
 
   template <std::size_t measdim>
   ConstTrackStateProxy::Calibrated<measdim> calibrated_impl(
       IndexType index) const {
     return ConstTrackStateProxy::Calibrated<measdim>{
-        m_collection->at(index).getData().measurement.data()};
+        m_data[index]->measurement.data()};
   }
 
   template <std::size_t measdim>
   ConstTrackStateProxy::CalibratedCovariance<measdim> calibratedCovariance_impl(
       IndexType index) const {
     return ConstTrackStateProxy::CalibratedCovariance<measdim>{
-        m_collection->at(index).getData().measurementCovariance.data()};
+        m_data[index]->measurementCovariance.data()};
   }
 
   IndexType size_impl() const { return m_collection->size(); }
@@ -315,16 +332,17 @@ class ConstPodioTrackStateContainer final
   }
 
   MultiTrajectoryTraits::IndexType calibratedSize_impl(IndexType istate) const {
-    return m_collection->at(istate).getData().measdim;
+    return m_data[istate]->measdim;
   }
 
   SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
     return m_helper.get().identifierToSourceLink(
-        m_collection->at(istate).getData().uncalibratedIdentifier);
+        m_data[istate]->uncalibratedIdentifier);
   }
 
   const Surface* referenceSurface_impl(IndexType istate) const {
-    return m_surfaces.at(istate).get();
+    assert(istate < m_surfaces.size() && "Track state out of range");
+    return m_surfaces[istate].get();
   }
 
  private:
@@ -334,6 +352,9 @@ class ConstPodioTrackStateContainer final
   const ActsPodioEdm::TrackStateCollection* m_collection;
   const ActsPodioEdm::BoundParametersCollection* m_params;
   const ActsPodioEdm::JacobianCollection* m_jacs;
+  std::vector<const ActsPodioEdm::TrackStateInfo*> m_data;
+  std::vector<const ActsPodioEdm::BoundParametersInfo*> m_paramsData;
+  std::vector<const ActsPodioEdm::JacobianInfo*> m_jacsData;
   std::vector<std::shared_ptr<const Surface>> m_surfaces;
 
   std::unordered_map<HashedString,
@@ -367,60 +388,56 @@ class MutablePodioTrackStateContainer final
   }
 
   ConstParameters parameters_impl(IndexType istate) const {
-    return ConstParameters{m_params->at(istate).getData().values.data()};
+    return ConstParameters{m_paramsData[istate]->values.data()};
   }
 
   Parameters parameters_impl(IndexType istate) {
-    return Parameters{
-        PodioUtil::getDataMutable(m_params->at(istate)).values.data()};
+    return Parameters{m_paramsData[istate]->values.data()};
   }
 
   ConstCovariance covariance_impl(IndexType istate) const {
-    return ConstCovariance{m_params->at(istate).getData().covariance.data()};
+    return ConstCovariance{m_paramsData[istate]->covariance.data()};
   }
 
   Covariance covariance_impl(IndexType istate) {
-    return Covariance{
-        PodioUtil::getDataMutable(m_params->at(istate)).covariance.data()};
+    return Covariance{m_paramsData[istate]->covariance.data()};
   }
 
   ConstCovariance jacobian_impl(IndexType istate) const {
-    IndexType ijacobian = m_collection->at(istate).getData().ijacobian;
-    return ConstCovariance{m_jacs->at(ijacobian).getData().values.data()};
+    IndexType ijacobian = m_data[istate]->ijacobian;
+    return ConstCovariance{m_jacsData[ijacobian]->values.data()};
   }
 
   Covariance jacobian_impl(IndexType istate) {
-    IndexType ijacobian = m_collection->at(istate).getData().ijacobian;
-    return Covariance{
-        PodioUtil::getDataMutable(m_jacs->at(ijacobian)).values.data()};
+    IndexType ijacobian = m_data[istate]->ijacobian;
+    return Covariance{m_jacsData[ijacobian]->values.data()};
   }
 
   template <std::size_t measdim>
   ConstTrackStateProxy::Calibrated<measdim> calibrated_impl(
       IndexType index) const {
     return ConstTrackStateProxy::Calibrated<measdim>{
-        m_collection->at(index).getData().measurement.data()};
+        m_data[index]->measurement.data()};
   }
 
   template <std::size_t measdim>
   TrackStateProxy::Calibrated<measdim> calibrated_impl(IndexType index) {
     return TrackStateProxy::Calibrated<measdim>{
-        PodioUtil::getDataMutable(m_collection->at(index)).measurement.data()};
+        m_data[index]->measurement.data()};
   }
 
   template <std::size_t measdim>
   ConstTrackStateProxy::CalibratedCovariance<measdim> calibratedCovariance_impl(
       IndexType index) const {
     return ConstTrackStateProxy::CalibratedCovariance<measdim>{
-        m_collection->at(index).getData().measurementCovariance.data()};
+        m_data[index]->measurementCovariance.data()};
   }
 
   template <std::size_t measdim>
   TrackStateProxy::CalibratedCovariance<measdim> calibratedCovariance_impl(
       IndexType index) {
     return TrackStateProxy::CalibratedCovariance<measdim>{
-        PodioUtil::getDataMutable(m_collection->at(index))
-            .measurementCovariance.data()};
+        m_data[index]->measurementCovariance.data()};
   }
 
   IndexType size_impl() const { return m_collection->size(); }
@@ -448,6 +465,7 @@ class MutablePodioTrackStateContainer final
       TrackIndexType iprevious = kTrackIndexInvalid) {
     auto trackState = m_collection->create();
     auto& data = PodioUtil::getDataMutable(trackState);
+    m_data.push_back(&data);
     data.previous = iprevious;
     data.ipredicted = kInvalid;
     data.ifiltered = kInvalid;
@@ -458,20 +476,16 @@ class MutablePodioTrackStateContainer final
         PodioUtil::kNoSurface;
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Predicted)) {
-      m_params->create();
-      data.ipredicted = m_params->size() - 1;
+      data.ipredicted = addParameters();
     }
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Filtered)) {
-      m_params->create();
-      data.ifiltered = m_params->size() - 1;
+      data.ifiltered = addParameters();
     }
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Smoothed)) {
-      m_params->create();
-      data.ismoothed = m_params->size() - 1;
+      data.ismoothed = addParameters();
     }
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Jacobian)) {
-      m_jacs->create();
-      data.ijacobian = m_jacs->size() - 1;
+      data.ijacobian = addJacobian();
     }
     data.measdim = kInvalid;
     data.hasProjector = false;
@@ -492,30 +506,26 @@ class MutablePodioTrackStateContainer final
   }
 
   void addTrackStateComponents_impl(IndexType istate, TrackStatePropMask mask) {
-    auto& data = PodioUtil::getDataMutable(m_collection->at(istate));
+    auto& data = *m_data[istate];
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Predicted) &&
         data.ipredicted == kInvalid) {
-      m_params->create();
-      data.ipredicted = m_params->size() - 1;
+      data.ipredicted = addParameters();
     }
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Filtered) &&
         data.ifiltered == kInvalid) {
-      m_params->create();
-      data.ifiltered = m_params->size() - 1;
+      data.ifiltered = addParameters();
     }
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Smoothed) &&
         data.ismoothed == kInvalid) {
-      m_params->create();
-      data.ismoothed = m_params->size() - 1;
+      data.ismoothed = addParameters();
     }
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Jacobian) &&
         data.ijacobian == kInvalid) {
-      m_jacs->create();
-      data.ijacobian = m_jacs->size() - 1;
+      data.ijacobian = addJacobian();
     }
 
     if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Calibrated) &&
@@ -527,8 +537,8 @@ class MutablePodioTrackStateContainer final
   void shareFrom_impl(TrackIndexType iself, TrackIndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget) {
-    auto& self = PodioUtil::getDataMutable(m_collection->at(iself));
-    auto& other = PodioUtil::getDataMutable(m_collection->at(iother));
+    auto& self = *m_data[iself];
+    auto& other = *m_data[iother];
 
     assert(ACTS_CHECK_BIT(getTrackState(iother).getMask(), shareSource) &&
            "Source has incompatible allocation");
@@ -578,7 +588,7 @@ class MutablePodioTrackStateContainer final
   }
 
   void unset_impl(TrackStatePropMask target, TrackIndexType istate) {
-    auto& data = PodioUtil::getDataMutable(m_collection->at(istate));
+    auto& data = *m_data[istate];
     switch (target) {
       case TrackStatePropMask::Predicted:
         data.ipredicted = kInvalid;
@@ -603,12 +613,29 @@ class MutablePodioTrackStateContainer final
   void clear_impl() {
     m_collection->clear();
     m_params->clear();
+    m_jacs->clear();
+    m_data.clear();
+    m_paramsData.clear();
+    m_jacsData.clear();
     m_surfaces.clear();
     for (const auto& [key, vec] : m_dynamic) {
       vec->clear();
     }
   }
 
+  /// Podio collections cannot reserve storage for their objects, so this
+  /// only reserves the cached data pointers, the surface buffer and the
+  /// dynamic columns.
+  void reserve(std::size_t n) {
+    m_data.reserve(n);
+    m_paramsData.reserve(n * 2);
+    m_jacsData.reserve(n);
+    m_surfaces.reserve(n);
+    for (const auto& [key, vec] : m_dynamic) {
+      vec->reserve(n);
+    }
+  }
+
   template <typename T>
   constexpr void addColumn_impl(std::string_view key) {
     HashedString hashedKey = hashStringDynamic(key);
@@ -628,7 +655,7 @@ class MutablePodioTrackStateContainer final
   {
     constexpr std::size_t measdim = val_t::RowsAtCompileTime;
 
-    auto& data = PodioUtil::getDataMutable(m_collection->at(istate));
+    auto& data = *m_data[istate];
 
     if (data.measdim != kInvalid && data.measdim != measdim) {
       throw std::invalid_argument{
@@ -649,8 +676,7 @@ class MutablePodioTrackStateContainer final
                                       const SourceLink& sourceLink) {
     PodioUtil::Identifier id =
         m_helper.get().sourceLinkToIdentifier(sourceLink);
-    auto& data = PodioUtil::getDataMutable(m_collection->at(istate));
-    data.uncalibratedIdentifier = id;
+    m_data[istate]->uncalibratedIdentifier = id;
   }
 
   void setReferenceSurface_impl(IndexType istate,
@@ -662,16 +688,17 @@ class MutablePodioTrackStateContainer final
   }
 
   MultiTrajectoryTraits::IndexType calibratedSize_impl(IndexType istate) const {
-    return m_collection->at(istate).getData().measdim;
+    return m_data[istate]->measdim;
   }
 
   SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
     return m_helper.get().identifierToSourceLink(
-        m_collection->at(istate).getData().uncalibratedIdentifier);
+        m_data[istate]->uncalibratedIdentifier);
   }
 
   const Surface* referenceSurface_impl(IndexType istate) const {
-    return m_surfaces.at(istate).get();
+    assert(istate < m_surfaces.size() && "Track state out of range");
+    return m_surfaces[istate].get();
   }
 
   void releaseInto(podio::Frame& frame, const std::string& suffix = "") {
@@ -679,9 +706,22 @@ class MutablePodioTrackStateContainer final
     if (!s.empty()) {
       s = "_" + s;
     }
+    [[maybe_unused]] const auto* collection = m_collection.get();
+    [[maybe_unused]] const auto* params = m_params.get();
+    [[maybe_unused]] const auto* jacs = m_jacs.get();
     frame.put(std::move(m_collection), "trackStates" + s);
     frame.put(std::move(m_params), "trackStateParameters" + s);
     frame.put(std::move(m_jacs), "trackStateJacobians" + s);
+    assert(frame.get("trackStates" + s) == collection &&
+           frame.get("trackStateParameters" + s) == params &&
+           frame.get("trackStateJacobians" + s) == jacs &&
+           PodioUtil::isDataBufferConsistent(*collection, m_data) &&
+           PodioUtil::isDataBufferConsistent(*params, m_paramsData) &&
+           PodioUtil::isDataBufferConsistent(*jacs, m_jacsData) &&
+           "Cached track state data does not match the collections");
+    m_data.clear();
+    m_paramsData.clear();
+    m_jacsData.clear();
     m_surfaces.clear();
 
     for (const auto& [key, col] : m_dynamic) {
@@ -711,10 +751,25 @@ class MutablePodioTrackStateContainer final
   friend class PodioTrackStateContainerBase;
   friend class ConstPodioTrackStateContainer;
 
+  IndexType addParameters() {
+    auto params = m_params->create();
+    m_paramsData.push_back(&PodioUtil::getDataMutable(params));
+    return m_params->size() - 1;
+  }
+
+  IndexType addJacobian() {
+    auto jac = m_jacs->create();
+    m_jacsData.push_back(&PodioUtil::getDataMutable(jac));
+    return m_jacs->size() - 1;
+  }
+
   std::reference_wrapper<PodioUtil::ConversionHelper> m_helper;
   std::unique_ptr<ActsPodioEdm::TrackStateCollection> m_collection;
   std::unique_ptr<ActsPodioEdm::BoundParametersCollection> m_params;
   std::unique_ptr<ActsPodioEdm::JacobianCollection> m_jacs;
+  std::vector<ActsPodioEdm::TrackStateInfo*> m_data;
+  std::vector<ActsPodioEdm::BoundParametersInfo*> m_paramsData;
+  std::vector<ActsPodioEdm::JacobianInfo*> m_jacsData;
   std::vector<std::shared_ptr<const Surface>> m_surfaces;
 
   std::unordered_map<HashedString,
@@ -737,6 +792,9 @@ ConstPodioTrackStateContainer::ConstPodioTrackStateContainer(
       m_collection{other.m_collection.get()},
       m_params{other.m_params.get()},
       m_jacs{other.m_jacs.get()},
+      m_data{other.m_data.begin(), other.m_data.end()},
+      m_paramsData{other.m_paramsData.begin(), other.m_paramsData.end()},
+      m_jacsData{other.m_jacsData.begin(), other.m_jacsData.end()},
       m_surfaces{other.m_surfaces} {
   for (const auto& [key, col] : other.m_dynamic) {
     m_dynamic.insert({key, col->asConst()});
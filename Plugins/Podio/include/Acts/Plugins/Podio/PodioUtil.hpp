@@ -14,8 +14,10 @@
 #include "Acts/Plugins/Podio/PodioDynamicColumns.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <podio/podioVersion.h>
 
@@ -70,6 +72,29 @@ decltype(auto) getReferenceSurfaceMutable(T&& object) {
   }
 }
 
+/// Check that cached pointers to the object data of a collection still point
+/// at the data of the objects the collection owns. Podio (>= 1.0) allocates
+/// every object separately and keeps the data as a member of it, so these
+/// pointers survive both collection growth and moving the collection into a
+/// frame. The track containers assert this whenever they release their
+/// collections.
+/// @param collection The collection owning the objects
+/// @param data The cached data pointers, one per object
+/// @return true if all pointers refer to the data of the matching object
+template <typename collection_t, typename data_t>
+bool isDataBufferConsistent(const collection_t& collection,
+                            const std::vector<data_t*>& data) {
+  if (collection.size() != data.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    if (&collection[i].getData() != data[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 using Identifier = std::uint64_t;
 constexpr Identifier kNoIdentifier = std::numeric_limits<Identifier>::max();
 constexpr int kNoSurface = -1;
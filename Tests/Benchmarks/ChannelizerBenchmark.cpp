@@ -0,0 +1,128 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "ActsFatras/Digitization/Channelizer.hpp"
+#include "ActsFatras/Digitization/Segmentizer.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+#include "ActsFatras/EventData/Hit.hpp"
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  std::size_t nHits = 0;
+  std::size_t runs = 0;
+  double maxTilt = 0;
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("hits", po::value<std::size_t>(&nHits)->default_value(1000),
+       "number of hits to channelize per run")
+      ("tilt", po::value<double>(&maxTilt)->default_value(2.),
+       "maximum tangent of the incidence angle w.r.t. the module normal")
+      ("runs", po::value<std::size_t>(&runs)->default_value(100),
+       "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  Acts::GeometryContext gctx;
+  const double thickness = 150_um;
+  const double halfX = 8_mm;
+  const double halfY = 20_mm;
+
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Transform3::Identity(),
+      std::make_shared<Acts::RectangleBounds>(halfX, halfY));
+
+  // Pixel module with 50 um x 250 um pitch
+  Acts::BinUtility segmentation(320, -halfX, halfX, Acts::open,
+                                Acts::AxisDirection::AxisX);
+  segmentation += Acts::BinUtility(160, -halfY, halfY, Acts::open,
+                                   Acts::AxisDirection::AxisY);
+  const ActsFatras::Segmentizer::SegmentationLookup lookup(segmentation);
+  const Acts::Vector3 driftDir = Acts::Vector3::Zero();
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xDist(-0.9 * halfX, 0.9 * halfX);
+  std::uniform_real_distribution<double> yDist(-0.9 * halfY, 0.9 * halfY);
+  std::uniform_real_distribution<double> tiltDist(-maxTilt, maxTilt);
+
+  std::vector<ActsFatras::Hit> hits;
+  hits.reserve(nHits);
+  for (std::size_t i = 0; i < nHits; ++i) {
+    Acts::Vector4 pos4 = Acts::Vector4::Zero();
+    pos4.segment<3>(Acts::ePos0) = Acts::Vector3(xDist(rng), yDist(rng), 0.);
+    Acts::Vector4 mom4 = Acts::Vector4::Zero();
+    mom4.segment<3>(Acts::eMom0) =
+        Acts::Vector3(tiltDist(rng), tiltDist(rng), 1.).normalized();
+    hits.emplace_back(Acts::GeometryIdentifier{}, ActsFatras::Barcode{}, pos4,
+                      mom4, mom4);
+  }
+
+  ActsFatras::Channelizer channelizer;
+
+  std::cout << "Channelizing " << nHits << " hits:" << std::endl;
+  const auto genericResult = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t nChannels = 0;
+        for (const auto& hit : hits) {
+          auto res = channelizer.channelize(hit, *surface, gctx, driftDir,
+                                            segmentation, thickness);
+          nChannels += res.ok() ? res->size() : 0;
+        }
+        return nChannels;
+      },
+      1, runs);
+  std::cout << "- generic: " << genericResult << std::endl;
+  const auto lookupResult = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t nChannels = 0;
+        for (const auto& hit : hits) {
+          auto res = channelizer.channelize(hit, *surface, gctx, driftDir,
+                                            lookup, thickness);
+          nChannels += res.ok() ? res->size() : 0;
+        }
+        return nChannels;
+      },
+      1, runs);
+  std::cout << "- lookup: " << lookupResult << std::endl;
+  std::cout << "  per hit: generic "
+            << genericResult.iterTimeAverage().count() / nHits
+            << " ns, lookup " << lookupResult.iterTimeAverage().count() / nHits
+            << " ns" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,133 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace {
+
+struct Cell {
+  Cell(int rowv, int colv) : row(rowv), col(colv) {}
+  int row;
+  int col;
+  Acts::Ccl::Label label{Acts::Ccl::NO_LABEL};
+};
+
+int getCellRow(const Cell& cell) {
+  return cell.row;
+}
+
+int getCellColumn(const Cell& cell) {
+  return cell.col;
+}
+
+Acts::Ccl::Label& getCellLabel(Cell& cell) {
+  return cell.label;
+}
+
+using Cluster = std::vector<Cell>;
+
+void clusterAddCell(Cluster& cl, const Cell& cell) {
+  cl.push_back(cell);
+}
+
+// Same connectivity as the default, used to benchmark the generic labelling
+struct GenericConnect : public Acts::Ccl::Connect2D<Cell> {
+  explicit GenericConnect(bool commonCorner)
+      : Acts::Ccl::Connect2D<Cell>(commonCorner) {}
+};
+
+std::vector<Cell> makeCells(int nColumns, int nRows, double occupancy) {
+  std::mt19937 rng(42);
+  std::bernoulli_distribution occupied(occupancy);
+  std::vector<Cell> cells;
+  for (int col = 0; col < nColumns; ++col) {
+    for (int row = 0; row < nRows; ++row) {
+      if (occupied(rng)) {
+        cells.emplace_back(row, col);
+      }
+    }
+  }
+  std::shuffle(cells.begin(), cells.end(), rng);
+  return cells;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int nColumns = 0;
+  int nRows = 0;
+  std::size_t runs = 0;
+  bool commonCorner = true;
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("columns", po::value<int>(&nColumns)->default_value(400),
+       "number of columns of the module")
+      ("rows", po::value<int>(&nRows)->default_value(400),
+       "number of rows of the module")
+      ("conn8", po::value<bool>(&commonCorner)->default_value(true),
+       "use 8-cell instead of 4-cell connectivity")
+      ("runs", po::value<std::size_t>(&runs)->default_value(100),
+       "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  using CellCollection = std::vector<Cell>;
+  using ClusterCollection = std::vector<Cluster>;
+
+  for (double occupancy : {0.001, 0.01, 0.05, 0.2, 0.5, 0.9}) {
+    const CellCollection input = makeCells(nColumns, nRows, occupancy);
+    CellCollection cells;
+
+    std::cout << "Occupancy " << occupancy << " (" << input.size()
+              << " cells):" << std::endl;
+    const auto defaultResult = Acts::Test::microBenchmark(
+        [&] {
+          cells = input;
+          return Acts::Ccl::createClusters<CellCollection, ClusterCollection>(
+                     cells, Acts::Ccl::DefaultConnect<Cell>(commonCorner))
+              .size();
+        },
+        1, runs);
+    std::cout << "- default: " << defaultResult << std::endl;
+    const auto genericResult = Acts::Test::microBenchmark(
+        [&] {
+          cells = input;
+          return Acts::Ccl::createClusters<CellCollection, ClusterCollection,
+                                           2, GenericConnect>(
+                     cells, GenericConnect(commonCorner))
+              .size();
+        },
+        1, runs);
+    std::cout << "- generic: " << genericResult << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,197 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/BetheBloch.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/BetheHeitler.hpp"
+#include "ActsFatras/Physics/ElectroMagnetic/Scattering.hpp"
+#include "ActsFatras/Physics/FusedElectroMagneticInteractions.hpp"
+#include "ActsFatras/Physics/StandardInteractions.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+std::vector<ActsFatras::Particle> makeParticles(Acts::PdgParticle pdg,
+                                                std::size_t n) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-3.14, 3.14);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<double> pDist(0.5_GeV, 50_GeV);
+
+  std::vector<ActsFatras::Particle> particles;
+  particles.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto pid = ActsFatras::Barcode().setVertexPrimary(1).setParticle(i);
+    particles.push_back(
+        ActsFatras::Particle(pid, pdg)
+            .setDirection(
+                Acts::makeDirectionFromPhiEta(phiDist(rng), etaDist(rng)))
+            .setAbsoluteMomentum(pDist(rng)));
+  }
+  return particles;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t batchSize = 0;
+  std::size_t runs = 0;
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("batch", po::value<std::size_t>(&batchSize)->default_value(256),
+       "number of particles crossing the material together")
+      ("runs", po::value<std::size_t>(&runs)->default_value(1000),
+       "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  const Acts::MaterialSlab slab = Acts::Test::makePercentSlab();
+  const auto muons = makeParticles(Acts::PdgParticle::eMuon, batchSize);
+  const auto electrons = makeParticles(Acts::PdgParticle::eElectron, batchSize);
+
+  std::mt19937 generator(1234);
+  std::vector<ActsFatras::Particle> particles;
+  std::vector<ActsFatras::Particle> photons;
+
+  auto report = [&](const std::string& name,
+                    const Acts::Test::MicroBenchmarkResult& res) {
+    std::cout << "- " << name << ": " << res << std::endl;
+    std::cout << "  per particle: "
+              << res.iterTimeAverage().count() / batchSize << " ns"
+              << std::endl;
+  };
+
+  std::cout << "Highland scattering for " << batchSize
+            << " particles:" << std::endl;
+  ActsFatras::HighlandScattering scattering;
+  report("single", Acts::Test::microBenchmark(
+                       [&] {
+                         particles = muons;
+                         for (auto& particle : particles) {
+                           scattering(generator, slab, particle);
+                         }
+                         return particles.back().direction();
+                       },
+                       1, runs));
+  report("batch", Acts::Test::microBenchmark(
+                      [&] {
+                        particles = muons;
+                        scattering.batch(generator, slab, particles);
+                        return particles.back().direction();
+                      },
+                      1, runs));
+
+  std::cout << "Bethe-Bloch energy loss for " << batchSize
+            << " particles:" << std::endl;
+  ActsFatras::BetheBloch betheBloch;
+  report("single", Acts::Test::microBenchmark(
+                       [&] {
+                         particles = muons;
+                         for (auto& particle : particles) {
+                           betheBloch(generator, slab, particle);
+                         }
+                         return particles.back().energy();
+                       },
+                       1, runs));
+  report("batch", Acts::Test::microBenchmark(
+                      [&] {
+                        particles = muons;
+                        betheBloch.batch(generator, slab, particles);
+                        return particles.back().energy();
+                      },
+                      1, runs));
+
+  std::cout << "Bethe-Heitler energy loss for " << batchSize
+            << " particles:" << std::endl;
+  ActsFatras::BetheHeitler betheHeitler;
+  report("single", Acts::Test::microBenchmark(
+                       [&] {
+                         particles = electrons;
+                         photons.clear();
+                         for (auto& particle : particles) {
+                           auto outgoing =
+                               betheHeitler(generator, slab, particle);
+                           photons.push_back(outgoing[0]);
+                         }
+                         return photons.size();
+                       },
+                       1, runs));
+  report("batch", Acts::Test::microBenchmark(
+                      [&] {
+                        particles = electrons;
+                        photons.clear();
+                        betheHeitler.batch(generator, slab, particles,
+                                           photons);
+                        return photons.size();
+                      },
+                      1, runs));
+
+  std::cout << "Standard charged interactions for " << batchSize
+            << " particles:" << std::endl;
+  const auto standardList =
+      ActsFatras::makeStandardChargedElectroMagneticInteractions(0.);
+  const auto fused = ActsFatras::makeFusedChargedElectroMagneticInteractions(0.);
+  for (const auto& [name, input] :
+       {std::pair{"muons", &muons}, std::pair{"electrons", &electrons}}) {
+    report(std::string("list ") + name,
+           Acts::Test::microBenchmark(
+               [&] {
+                 particles = *input;
+                 photons.clear();
+                 for (auto& particle : particles) {
+                   standardList.runContinuous(generator, slab, particle,
+                                              photons);
+                 }
+                 return particles.back().energy();
+               },
+               1, runs));
+    report(std::string("fused ") + name,
+           Acts::Test::microBenchmark(
+               [&] {
+                 particles = *input;
+                 photons.clear();
+                 for (auto& particle : particles) {
+                   fused.runContinuous(generator, slab, particle, photons);
+                 }
+                 return particles.back().energy();
+               },
+               1, runs));
+  }
+
+  return 0;
+}
@@ -17,13 +17,25 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
 
+#ifdef ACTS_TRACK_EDM_BENCHMARK_PODIO
+#include "Acts/Plugins/Podio/PodioTrackContainer.hpp"
+#include "Acts/Plugins/Podio/PodioTrackStateContainer.hpp"
+#include "Acts/Plugins/Podio/PodioUtil.hpp"
+#endif
+
 #include <iostream>
 #include <numeric>
 #include <random>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/program_options.hpp>
 
+namespace po = boost::program_options;
 using namespace Acts;
 
 class BenchmarkSourceLink final {
@@ -56,39 +68,65 @@ class BenchmarkSourceLink final {
   }
 };
 
-int main(int /*argc*/, char** /*argv[]*/) {
-  std::size_t runs = 1000000;
-  std::size_t nTracks = 10000;
-
-  VectorMultiTrajectory mtj;
-  VectorTrackContainer vtc;
-  TrackContainer tc{vtc, mtj};
+#ifdef ACTS_TRACK_EDM_BENCHMARK_PODIO
+/// Identifies the benchmark surfaces, like a tracking geometry would, such
+/// that they are not serialized for every track state.
+class BenchmarkConversionHelper final : public PodioUtil::ConversionHelper {
+ public:
+  explicit BenchmarkConversionHelper(
+      const std::vector<std::shared_ptr<Surface>>& surfaces) {
+    for (const auto& surface : surfaces) {
+      m_identifiers.emplace(surface.get(), m_surfaces.size());
+      m_surfaces.push_back(surface.get());
+    }
+  }
 
-  VectorMultiTrajectory mtjOut;
-  VectorTrackContainer vtcOut;
-  TrackContainer output{vtcOut, mtjOut};
+  std::optional<PodioUtil::Identifier> surfaceToIdentifier(
+      const Surface& surface) const override {
+    auto it = m_identifiers.find(&surface);
+    if (it == m_identifiers.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
 
-  auto gid = GeometryIdentifier().withVolume(5).withLayer(3).withSensitive(1);
+  const Surface* identifierToSurface(
+      PodioUtil::Identifier identifier) const override {
+    return identifier < m_surfaces.size() ? m_surfaces[identifier] : nullptr;
+  }
 
-  static_assert(sizeof(BenchmarkSourceLink) <= ACTS_SOURCELINK_SBO_SIZE);
+  PodioUtil::Identifier sourceLinkToIdentifier(
+      const SourceLink& sourceLink) override {
+    m_sourceLinks.push_back(sourceLink);
+    return m_sourceLinks.size() - 1;
+  }
 
-  static_assert(std::is_trivially_move_constructible_v<BenchmarkSourceLink>);
+  SourceLink identifierToSourceLink(
+      PodioUtil::Identifier identifier) const override {
+    return m_sourceLinks.at(identifier);
+  }
 
+ private:
+  std::unordered_map<const Surface*, PodioUtil::Identifier> m_identifiers;
+  std::vector<const Surface*> m_surfaces;
+  std::vector<SourceLink> m_sourceLinks;
+};
+#endif
+
+/// Fill the track container and copy a subset of the tracks to the output,
+/// which mimics the track finding and the subsequent track selection.
+template <typename track_container_t, typename parameters_t>
+void fillAndCopy(track_container_t& tc, track_container_t& output,
+                 std::size_t nTracks, std::mt19937& rng,
+                 const std::vector<std::shared_ptr<Surface>>& surfaces,
+                 const parameters_t& parametersVector,
+                 const std::shared_ptr<PerigeeSurface>& perigee) {
   std::uniform_int_distribution<> nStatesDist(1, 20);
   std::uniform_int_distribution<> measDimDist(1, 3);
   std::uniform_real_distribution<> typeDist(0, 1);
   std::uniform_real_distribution<> copyDist(0, 1);
-  std::mt19937 rng{42};
-
-  std::vector<std::shared_ptr<Surface>> surfaces;
-  std::vector<std::pair<BoundVector, BoundMatrix>> parametersVector;
-  for (std::size_t s = 0; s < 50; ++s) {
-    surfaces.push_back(Surface::makeShared<PlaneSurface>(
-        Transform3::Identity(), std::make_shared<RectangleBounds>(50, 50)));
 
-    parametersVector.push_back(
-        detail::Test::generateBoundParametersCovariance(rng, {}));
-  }
+  auto gid = GeometryIdentifier().withVolume(5).withLayer(3).withSensitive(1);
 
   std::size_t nSurface = 0;
   auto surface = [&]() {
@@ -102,82 +140,168 @@ int main(int /*argc*/, char** /*argv[]*/) {
     return parametersVector.at(nParams % parametersVector.size());
   };
 
-  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  tc.clear();
+  output.clear();
 
-  std::cout << "Creating " << nTracks << " tracks x " << runs << " runs"
-            << std::endl;
-  for (std::size_t r = 0; r < runs; ++r) {
-    tc.clear();
-    output.clear();
-
-    for (std::size_t i = 0; i < nTracks; ++i) {
-      auto track = tc.makeTrack();
-
-      std::size_t nStates = nStatesDist(rng);
-
-      for (std::size_t j = 0; j < nStates; ++j) {
-        auto trackState = track.appendTrackState(TrackStatePropMask::All);
-        trackState.setReferenceSurface(surface());
-
-        trackState.jacobian().setZero();
-        trackState.jacobian().row(j % eBoundSize).setOnes();
-
-        double crit = typeDist(rng);
-
-        if (crit < 0.1) {
-          // hole
-          trackState.typeFlags().set(TrackStateFlag::HoleFlag);
-        } else if (crit < 0.2) {
-          // material
-          trackState.typeFlags().set(TrackStateFlag::MaterialFlag);
-        } else {
-          BenchmarkSourceLink bsl{gid, 123};
-          std::size_t measdim = measDimDist(rng);
-
-          const auto& [predicted, covariance] = parameters();
-          trackState.predicted() = predicted;
-          trackState.predictedCovariance() = covariance;
-
-          visit_measurement(
-              measdim,
-              [&]<std::size_t N>(std::integral_constant<std::size_t, N> /*d*/) {
-                trackState.allocateCalibrated(ActsVector<N>::Ones(),
-                                              ActsSquareMatrix<N>::Identity());
-
-                std::array<std::uint8_t, eBoundSize> indices{0};
-                std::iota(indices.begin(), indices.end(), 0);
-                trackState.setProjectorSubspaceIndices(indices);
-              });
-
-          trackState.typeFlags().set(TrackStateFlag::MeasurementFlag);
-          if (crit < 0.4) {
-            // outlier
-            trackState.typeFlags().set(TrackStateFlag::OutlierFlag);
-          }
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto track = tc.makeTrack();
+
+    std::size_t nStates = nStatesDist(rng);
+
+    for (std::size_t j = 0; j < nStates; ++j) {
+      auto trackState = track.appendTrackState(TrackStatePropMask::All);
+      trackState.setReferenceSurface(surface());
+
+      trackState.jacobian().setZero();
+      trackState.jacobian().row(j % eBoundSize).setOnes();
+
+      double crit = typeDist(rng);
+
+      if (crit < 0.1) {
+        // hole
+        trackState.typeFlags().set(TrackStateFlag::HoleFlag);
+      } else if (crit < 0.2) {
+        // material
+        trackState.typeFlags().set(TrackStateFlag::MaterialFlag);
+      } else {
+        BenchmarkSourceLink bsl{gid, 123};
+        std::size_t measdim = measDimDist(rng);
+
+        const auto& [predicted, covariance] = parameters();
+        trackState.predicted() = predicted;
+        trackState.predictedCovariance() = covariance;
+
+        visit_measurement(
+            measdim,
+            [&]<std::size_t N>(std::integral_constant<std::size_t, N> /*d*/) {
+              trackState.allocateCalibrated(ActsVector<N>::Ones(),
+                                            ActsSquareMatrix<N>::Identity());
+
+              std::array<std::uint8_t, eBoundSize> indices{0};
+              std::iota(indices.begin(), indices.end(), 0);
+              trackState.setProjectorSubspaceIndices(indices);
+            });
+
+        trackState.typeFlags().set(TrackStateFlag::MeasurementFlag);
+        if (crit < 0.4) {
+          // outlier
+          trackState.typeFlags().set(TrackStateFlag::OutlierFlag);
         }
       }
+    }
 
-      track.setReferenceSurface(perigee);
+    track.setReferenceSurface(perigee);
 
-      const auto& [ref, cov] = parameters();
-      track.parameters() = ref;
-      track.covariance() = cov;
+    const auto& [ref, cov] = parameters();
+    track.parameters() = ref;
+    track.covariance() = cov;
 
-      track.linkForward();
+    track.linkForward();
 
-      calculateTrackQuantities(track);
+    calculateTrackQuantities(track);
+  }
+
+  for (const auto& track : tc) {
+    if (copyDist(rng) > 0.1) {
+      // copy only 10% of tracks
+      continue;
     }
 
-    for (const auto& track : tc) {
-      if (copyDist(rng) > 0.1) {
-        // copy only 10% of tracks
-        continue;
-      }
+    auto target = output.makeTrack();
+    target.copyFrom(track);
+  }
+}
 
-      auto target = output.makeTrack();
-      target.copyFrom(track);
+int main(int argc, char* argv[]) {
+  std::size_t runs = 0;
+  std::size_t nTracks = 0;
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("tracks", po::value<std::size_t>(&nTracks)->default_value(10000),
+       "number of tracks to create per run")
+      ("runs", po::value<std::size_t>(&runs)->default_value(20),
+       "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
     }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
   }
 
+  static_assert(sizeof(BenchmarkSourceLink) <= ACTS_SOURCELINK_SBO_SIZE);
+
+  static_assert(std::is_trivially_move_constructible_v<BenchmarkSourceLink>);
+
+  std::mt19937 rng{42};
+
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  std::vector<std::pair<BoundVector, BoundMatrix>> parametersVector;
+  for (std::size_t s = 0; s < 50; ++s) {
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        Transform3::Identity(), std::make_shared<RectangleBounds>(50, 50)));
+
+    parametersVector.push_back(
+        detail::Test::generateBoundParametersCovariance(rng, {}));
+  }
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  std::cout << "Creating " << nTracks << " tracks x " << runs << " runs"
+            << std::endl;
+
+  VectorMultiTrajectory mtj;
+  VectorTrackContainer vtc;
+  TrackContainer tc{vtc, mtj};
+
+  VectorMultiTrajectory mtjOut;
+  VectorTrackContainer vtcOut;
+  TrackContainer output{vtcOut, mtjOut};
+
+  std::mt19937 vectorRng{1234};
+  const auto vectorResult = Acts::Test::microBenchmark(
+      [&] {
+        fillAndCopy(tc, output, nTracks, vectorRng, surfaces, parametersVector,
+                    perigee);
+        return output.size();
+      },
+      1, runs);
+  std::cout << "- vector: " << vectorResult << std::endl;
+
+#ifdef ACTS_TRACK_EDM_BENCHMARK_PODIO
+  BenchmarkConversionHelper helper{surfaces};
+
+  MutablePodioTrackStateContainer ptsc{helper};
+  MutablePodioTrackContainer ptc{helper};
+  TrackContainer podioTc{ptc, ptsc};
+
+  MutablePodioTrackStateContainer ptscOut{helper};
+  MutablePodioTrackContainer ptcOut{helper};
+  TrackContainer podioOutput{ptcOut, ptscOut};
+
+  std::mt19937 podioRng{1234};
+  const auto podioResult = Acts::Test::microBenchmark(
+      [&] {
+        fillAndCopy(podioTc, podioOutput, nTracks, podioRng, surfaces,
+                    parametersVector, perigee);
+        return podioOutput.size();
+      },
+      1, runs);
+  std::cout << "- podio: " << podioResult << std::endl;
+  std::cout << "  per track: vector "
+            << vectorResult.iterTimeAverage().count() / nTracks
+            << " ns, podio "
+            << podioResult.iterTimeAverage().count() / nTracks << " ns"
+            << std::endl;
+#endif
+
   return 0;
 }
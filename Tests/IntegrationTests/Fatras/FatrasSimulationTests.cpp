@@ -247,3 +247,86 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
     BOOST_CHECK(containsParticleId(simulatedFinal, hit));
   }
 }
+
+BOOST_AUTO_TEST_CASE(FatrasSimulationPerParticle) {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  Acts::Logging::Level logLevel = Acts::Logging::Level::INFO;
+
+  Acts::Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
+  auto trackingGeometry = geoBuilder();
+
+  Navigator navigator({trackingGeometry});
+  ChargedStepper chargedStepper(
+      std::make_shared<Acts::ConstantBField>(Acts::Vector3{0, 0, 1_T}));
+  ChargedPropagator chargedPropagator(std::move(chargedStepper), navigator);
+  NeutralPropagator neutralPropagator(NeutralStepper(), navigator);
+
+  ChargedSimulation simulatorCharged(
+      std::move(chargedPropagator),
+      Acts::getDefaultLogger("ChargedSimulation", logLevel));
+  NeutralSimulation simulatorNeutral(
+      std::move(neutralPropagator),
+      Acts::getDefaultLogger("NeutralSimulation", logLevel));
+  Simulation simulator(std::move(simulatorCharged),
+                       std::move(simulatorNeutral));
+
+  std::vector<ActsFatras::Particle> input;
+  for (int i = 1; i <= 4; ++i) {
+    const auto pid = ActsFatras::Barcode().setVertexPrimary(42).setParticle(i);
+    input.push_back(ActsFatras::Particle(pid, Acts::PdgParticle::eMuon)
+                        .setDirection(Acts::makeDirectionFromPhiEta(
+                            i * 30_degree, -1.0 + 0.5 * i))
+                        .setAbsoluteMomentum(i * 5_GeV));
+  }
+
+  struct Output {
+    std::vector<ActsFatras::Particle> initial;
+    std::vector<ActsFatras::Particle> final;
+    std::vector<ActsFatras::Hit> hits;
+  };
+
+  // simulate every input particle with a generator derived from its id and
+  // visit the particles in the given order
+  auto simulate = [&](const std::vector<std::size_t>& order) {
+    Output output;
+    std::vector<ActsFatras::FailedParticle> failed;
+    for (std::size_t i : order) {
+      Generator generator(input[i].particleId().value());
+      auto result = simulator.simulateParticle(geoCtx, magCtx, generator,
+                                               input[i], output.initial,
+                                               output.final, output.hits,
+                                               failed);
+      BOOST_CHECK(result.ok());
+    }
+    BOOST_CHECK(failed.empty());
+    sortByParticleId(output.initial);
+    sortByParticleId(output.final);
+    std::ranges::stable_sort(output.hits, std::less{},
+                             [](const auto& h) { return h.particleId(); });
+    return output;
+  };
+
+  Output forward = simulate({0, 1, 2, 3});
+  Output backward = simulate({3, 2, 1, 0});
+
+  // the outputs must not depend on the order of the particles
+  BOOST_CHECK_LE(input.size(), forward.initial.size());
+  BOOST_CHECK_EQUAL(forward.initial.size(), backward.initial.size());
+  BOOST_CHECK_EQUAL(forward.final.size(), backward.final.size());
+  BOOST_REQUIRE_EQUAL(forward.hits.size(), backward.hits.size());
+  for (std::size_t i = 0; i < forward.final.size(); ++i) {
+    BOOST_CHECK_EQUAL(forward.final[i].particleId(),
+                      backward.final[i].particleId());
+    BOOST_CHECK_EQUAL(forward.final[i].fourPosition(),
+                      backward.final[i].fourPosition());
+    BOOST_CHECK_EQUAL(forward.final[i].absoluteMomentum(),
+                      backward.final[i].absoluteMomentum());
+  }
+  for (std::size_t i = 0; i < forward.hits.size(); ++i) {
+    BOOST_CHECK_EQUAL(forward.hits[i].particleId(),
+                      backward.hits[i].particleId());
+    BOOST_CHECK_EQUAL(forward.hits[i].fourPosition(),
+                      backward.hits[i].fourPosition());
+  }
+}
@@ -247,4 +247,65 @@ BOOST_AUTO_TEST_CASE(Grid_2D_rand) {
   }
 }
 
+// Same connectivity as the default, but hides the type so that the generic
+// labelling is used
+struct GenericConnect2D : public Ccl::Connect2D<Cell2D> {
+  explicit GenericConnect2D(bool commonCorner)
+      : Ccl::Connect2D<Cell2D>(commonCorner) {}
+};
+
+// Cells of every cluster in output order
+std::vector<std::vector<std::pair<int, int>>> positions(
+    const std::vector<Cluster2D>& clusters) {
+  std::vector<std::vector<std::pair<int, int>>> out;
+  for (const Cluster2D& cl : clusters) {
+    std::vector<std::pair<int, int>>& cells = out.emplace_back();
+    for (const Cell2D& c : cl.cells) {
+      cells.emplace_back(c.col, c.row);
+    }
+  }
+  return out;
+}
+
+BOOST_AUTO_TEST_CASE(Grid_2D_default_vs_generic) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+  using ClusterC = std::vector<Cluster2D>;
+
+  std::mt19937_64 rnd(4242);
+  std::bernoulli_distribution duplicated(0.05);
+  for (int trial = 0; trial < 50; ++trial) {
+    // From sparse to fully occupied grids
+    for (double occupancy : {0.01, 0.1, 0.3, 0.5, 0.7, 1.0}) {
+      for (bool commonCorner : {true, false}) {
+        std::bernoulli_distribution occupied(occupancy);
+        CellC cells;
+        for (int col = 0; col < 60; ++col) {
+          for (int row = 0; row < 40; ++row) {
+            if (occupied(rnd)) {
+              cells.emplace_back(row, col);
+              // Duplicated cells are connected to each other
+              if (trial % 2 == 1 && duplicated(rnd)) {
+                cells.emplace_back(row, col);
+              }
+            }
+          }
+        }
+        std::shuffle(cells.begin(), cells.end(), rnd);
+        CellC genericCells = cells;
+
+        ClusterC defaultCls = Ccl::createClusters<CellC, ClusterC>(
+            cells, Ccl::DefaultConnect<Cell>(commonCorner));
+        ClusterC genericCls =
+            Ccl::createClusters<CellC, ClusterC, 2, GenericConnect2D>(
+                genericCells, GenericConnect2D(commonCorner));
+
+        // Same clusters in the same order, including the order of the cells
+        BOOST_CHECK_EQUAL(defaultCls.size(), genericCls.size());
+        BOOST_CHECK(positions(defaultCls) == positions(genericCls));
+      }
+    }
+  }
+}
+
 }  // namespace Acts::Test
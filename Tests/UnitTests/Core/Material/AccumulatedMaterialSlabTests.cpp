@@ -16,6 +16,7 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -198,4 +199,44 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// tracks accumulated separately and merged give the same average
+BOOST_AUTO_TEST_CASE(MergeDifferentTracks) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab three = unit;
+  three.scaleThickness(3);
+  MaterialSlab silicon(makeSilicon(), 2 * unit.thickness());
+  std::vector<MaterialSlab> tracks = {unit, three, silicon, silicon, unit};
+
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    all.accumulate(tracks[i]);
+    all.trackAverage();
+    AccumulatedMaterialSlab& part = (i < 2) ? first : second;
+    part.accumulate(tracks[i]);
+    part.trackAverage();
+  }
+
+  // merging into an empty accumulator copies the other one
+  AccumulatedMaterialSlab merged;
+  merged.merge(first);
+  BOOST_CHECK_EQUAL(merged.totalAverage().first, first.totalAverage().first);
+  BOOST_CHECK_EQUAL(merged.totalAverage().second, 2u);
+  merged.merge(second);
+  // merging an empty accumulator does not change anything
+  merged.merge(AccumulatedMaterialSlab());
+
+  auto [average, trackCount] = merged.totalAverage();
+  auto [expected, expectedCount] = all.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, expectedCount);
+  CHECK_CLOSE_REL(average.thickness(), expected.thickness(), eps);
+  CHECK_CLOSE_REL(average.material().X0(), expected.material().X0(), eps);
+  CHECK_CLOSE_REL(average.material().L0(), expected.material().L0(), eps);
+  CHECK_CLOSE_REL(average.material().Ar(), expected.material().Ar(), eps);
+  CHECK_CLOSE_REL(average.material().Z(), expected.material().Z(), eps);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  expected.material().molarDensity(), eps);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
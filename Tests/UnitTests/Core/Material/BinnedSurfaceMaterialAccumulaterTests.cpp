@@ -9,6 +9,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/BinnedSurfaceMaterialAccumulater.hpp"
@@ -17,13 +18,20 @@
 #include "Acts/Material/ProtoSurfaceMaterial.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <map>
+#include <memory>
 #include <numbers>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
+using namespace Acts::UnitLiterals;
+
 namespace Acts::Test {
 
 auto tContext = GeometryContext();
@@ -215,6 +223,97 @@ BOOST_AUTO_TEST_CASE(AccumulationTest) {
       std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(MergeTest) {
+  auto surface =
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 30.0, 100.0);
+  surface->assignGeometryId(GeometryIdentifier().withSensitive(1));
+  BinUtility sb(4, -std::numbers::pi, std::numbers::pi, closed,
+                AxisDirection::AxisPhi);
+  sb += BinUtility(2, -100., 100., open, AxisDirection::AxisZ);
+  surface->assignSurfaceMaterial(std::make_shared<ProtoSurfaceMaterial>(sb));
+
+  BinnedSurfaceMaterialAccumulater::Config bsmaConfig;
+  bsmaConfig.materialSurfaces = {surface.get()};
+  bsmaConfig.geoContext = tContext;
+  BinnedSurfaceMaterialAccumulater bsma(
+      bsmaConfig,
+      getDefaultLogger("BinnedSurfaceMaterialAccumulater", Logging::VERBOSE));
+
+  // Accumulate the same tracks into one state and split over two states
+  auto all = bsma.createState();
+  auto first = bsma.createState();
+  auto second = bsma.createState();
+
+  Material silicon = makeSilicon();
+  for (unsigned int it = 0; it < 6; ++it) {
+    Vector3 d = Vector3(10, it + 1., it * 0.5).normalized();
+    MaterialInteraction mi;
+    mi.surface = surface.get();
+    mi.position = 30 * d;
+    mi.direction = d;
+    mi.materialSlab = MaterialSlab(silicon, (it + 1) * 0.1_mm);
+    bsma.accumulate(*all, {mi}, {});
+    bsma.accumulate((it % 2 == 0) ? *first : *second, {mi}, {});
+  }
+  bsma.merge(*first, *second);
+
+  auto cAll =
+      static_cast<const BinnedSurfaceMaterialAccumulater::State*>(all.get());
+  auto cMerged =
+      static_cast<const BinnedSurfaceMaterialAccumulater::State*>(first.get());
+  const auto& allBins = cAll->accumulatedMaterial.at(0).accumulatedMaterial();
+  const auto& mergedBins =
+      cMerged->accumulatedMaterial.at(0).accumulatedMaterial();
+  BOOST_CHECK_EQUAL(allBins.size(), mergedBins.size());
+  for (std::size_t i1 = 0; i1 < allBins.size(); ++i1) {
+    for (std::size_t i0 = 0; i0 < allBins[i1].size(); ++i0) {
+      auto [expected, expectedCount] = allBins[i1][i0].totalAverage();
+      auto [merged, mergedCount] = mergedBins[i1][i0].totalAverage();
+      BOOST_CHECK_EQUAL(mergedCount, expectedCount);
+      if (expectedCount == 0u) {
+        continue;
+      }
+      CHECK_CLOSE_REL(merged.thickness(), expected.thickness(), 1e-6);
+      CHECK_CLOSE_REL(merged.material().X0(), expected.material().X0(), 1e-6);
+    }
+  }
+
+  // States of differently configured accumulaters can not be merged
+  auto otherSurface =
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 40.0, 100.0);
+  otherSurface->assignGeometryId(GeometryIdentifier().withSensitive(2));
+  otherSurface->assignSurfaceMaterial(
+      std::make_shared<ProtoSurfaceMaterial>(sb));
+  bsmaConfig.materialSurfaces = {otherSurface.get()};
+  BinnedSurfaceMaterialAccumulater otherBsma(
+      bsmaConfig,
+      getDefaultLogger("BinnedSurfaceMaterialAccumulater", Logging::VERBOSE));
+  auto otherState = otherBsma.createState();
+  BOOST_CHECK_THROW(bsma.merge(*first, *otherState), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(DefaultMergeTest) {
+  // An accumulater which does not implement merging states
+  struct Accumulater final : public ISurfaceMaterialAccumulater {
+    std::unique_ptr<State> createState() const override {
+      return std::make_unique<State>();
+    }
+    void accumulate(
+        State& /*state*/, const std::vector<MaterialInteraction>& /*mi*/,
+        const std::vector<IAssignmentFinder::SurfaceAssignment>& /*empty*/)
+        const override {}
+    std::map<GeometryIdentifier, std::shared_ptr<const ISurfaceMaterial>>
+    finalizeMaterial(State& /*state*/) const override {
+      return {};
+    }
+  };
+
+  Accumulater accumulater;
+  auto state = accumulater.createState();
+  auto other = accumulater.createState();
+  BOOST_CHECK_THROW(accumulater.merge(*state, *other), std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace Acts::Test
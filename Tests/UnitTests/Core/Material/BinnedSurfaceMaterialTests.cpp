@@ -9,11 +9,13 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/Material.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -57,4 +59,54 @@ BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_construction_test) {
   BinnedSurfaceMaterial bsmMoveAssigned(std::move(bsmAssigned));
 }
 
+/// Test the bin lookup and the per bin constants
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_lookup_test) {
+  BinUtility xyBinning(2, -1., 1., open, AxisDirection::AxisX);
+  xyBinning += BinUtility(3, -3., 3., open, AxisDirection::AxisY);
+
+  MaterialSlabMatrix m;
+  for (std::size_t iy = 0; iy < 3; ++iy) {
+    MaterialSlabVector row;
+    for (std::size_t ix = 0; ix < 2; ++ix) {
+      float v = 1.f + ix + 2.f * iy;
+      row.emplace_back(Material::fromMolarDensity(v, v, v, v, v), v);
+    }
+    m.push_back(std::move(row));
+  }
+
+  BinnedSurfaceMaterial bsm(xyBinning, m);
+  BOOST_CHECK(bsm.fullMaterial() == m);
+
+  for (std::size_t iy = 0; iy < 3; ++iy) {
+    for (std::size_t ix = 0; ix < 2; ++ix) {
+      BOOST_CHECK_EQUAL(bsm.materialSlab(ix, iy), m[iy][ix]);
+      // position in the center of the bin
+      Vector3 position(-0.5 + ix, -2. + 2. * iy, 0.);
+      BOOST_CHECK_EQUAL(bsm.materialSlab(position), m[iy][ix]);
+      BOOST_CHECK_EQUAL(bsm.materialSlab(Vector2(position.head<2>())),
+                        m[iy][ix]);
+
+      // the precomputed constants belong to the same bin
+      MaterialSlabConstants constants;
+      BOOST_CHECK_EQUAL(bsm.materialSlabWithConstants(position, constants),
+                        m[iy][ix]);
+      BOOST_CHECK_EQUAL(constants.thicknessInX0, m[iy][ix].thicknessInX0());
+    }
+  }
+
+  // scaling keeps slabs and constants consistent
+  bsm.scale(0.5);
+  MaterialSlabConstants constants;
+  const MaterialSlab& scaled =
+      bsm.materialSlabWithConstants(Vector3(0.5, 2., 0.), constants);
+  BOOST_CHECK_EQUAL(scaled.thickness(), 0.5 * m[2][1].thickness());
+  BOOST_CHECK_EQUAL(constants.thicknessInX0, scaled.thicknessInX0());
+  BOOST_CHECK_EQUAL(constants.thickness, scaled.thickness());
+  BOOST_CHECK_EQUAL(bsm.fullMaterial()[2][1], scaled);
+
+  // rows of different size are rejected
+  m.back().pop_back();
+  BOOST_CHECK_THROW(BinnedSurfaceMaterial(xyBinning, m), std::invalid_argument);
+}
+
 }  // namespace Acts::Test
@@ -0,0 +1,185 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/CompressedMaterialMap.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/AxisDefinitions.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Acts::Test {
+
+namespace {
+
+using MaterialMap3D = InterpolatedMaterialMap<MaterialMapper<MaterialGrid3D>>;
+
+/// Build an interpolated material map on the given binning, the grid points
+/// alternate between a few materials
+MaterialMap3D makeMap(const BinUtility& bu, std::size_t nDistinct) {
+  std::function<Vector3(Vector3)> transfoGlobalToLocal;
+  Grid3D grid = createGrid3D(bu, transfoGlobalToLocal);
+  MaterialGrid3D matGrid = mapMaterialPoints(grid);
+  for (std::size_t index = 0; index < matGrid.size(); ++index) {
+    float n = 1.f + (index % nDistinct);
+    matGrid.at(index) =
+        Material::fromMolarDensity(10.f * n, 20.f * n, 3.f * n, 2.f * n, n)
+            .parameters();
+  }
+  MaterialMapper<MaterialGrid3D> mapper(transfoGlobalToLocal,
+                                        std::move(matGrid));
+  return MaterialMap3D(std::move(mapper), bu);
+}
+
+void checkMaterial(const Material& compressed, const Material& reference) {
+  CHECK_CLOSE_REL(compressed.X0(), reference.X0(), 1e-5);
+  CHECK_CLOSE_REL(compressed.L0(), reference.L0(), 1e-5);
+  CHECK_CLOSE_REL(compressed.Ar(), reference.Ar(), 1e-5);
+  CHECK_CLOSE_REL(compressed.Z(), reference.Z(), 1e-5);
+  CHECK_CLOSE_REL(compressed.molarDensity(), reference.molarDensity(), 1e-5);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(CompressedMaterialMap_lookup_test) {
+  // Shifted cylindrical binning
+  BinUtility bu(4, 1., 4., open, AxisDirection::AxisR,
+                Transform3(Translation3(Vector3(0., 0., 5.))));
+  bu += BinUtility(3, -std::numbers::pi, std::numbers::pi, closed,
+                   AxisDirection::AxisPhi);
+  bu += BinUtility(5, -2., 2., open, AxisDirection::AxisZ);
+
+  MaterialMap3D reference = makeMap(bu, 3);
+  CompressedMaterialMap closest(CompressedMaterialMap::encode(reference));
+  CompressedMaterialMap interpolated(CompressedMaterialMap::encode(reference),
+                                     true);
+  BOOST_CHECK_EQUAL(closest.nMaterials(), 3u);
+
+  // The indices of 6 * 5 * 7 grid points are stored with 16 bit
+  BOOST_CHECK_EQUAL(closest.buffer().size(),
+                    sizeof(CompressedMaterialMap::Header) +
+                        3 * 5 * sizeof(float) + 6 * 5 * 7 * 2);
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-5., 5.);
+  for (std::size_t i = 0; i < 100; ++i) {
+    Vector3 position(dist(gen), dist(gen), dist(gen) + 5.);
+    BOOST_CHECK_EQUAL(closest.isInside(position), reference.isInside(position));
+    BOOST_CHECK_EQUAL(closest.material(position),
+                      reference.material(position));
+    if (reference.isInside(position)) {
+      checkMaterial(interpolated.material(position),
+                    reference.getMaterial(position));
+      checkMaterial(closest.getMaterial(position),
+                    reference.getMaterial(position));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CompressedMaterialMap_dictionary_test) {
+  BinUtility bu(40, -3., 3., open, AxisDirection::AxisX);
+  bu += BinUtility(40, -2., 2., open, AxisDirection::AxisY);
+  bu += BinUtility(40, -1., 1., open, AxisDirection::AxisZ);
+
+  // More distinct materials than a 16 bit index can address
+  const std::size_t nPoints = 42 * 42 * 42;
+  MaterialMap3D reference = makeMap(bu, nPoints);
+  CompressedMaterialMap full(CompressedMaterialMap::encode(reference));
+  BOOST_CHECK_EQUAL(full.nMaterials(), nPoints);
+  BOOST_CHECK_EQUAL(full.buffer().size(),
+                    sizeof(CompressedMaterialMap::Header) +
+                        nPoints * 5 * sizeof(float) + nPoints * 4);
+  Vector3 position(0.3, -0.7, 0.1);
+  BOOST_CHECK_EQUAL(full.material(position), reference.material(position));
+
+  // Reduced precision merges nearly identical materials
+  CompressedMaterialMap reduced(CompressedMaterialMap::encode(reference, 6));
+  BOOST_CHECK_LT(reduced.nMaterials(), nPoints);
+  const Material material = reduced.material(position);
+  const Material expected = reference.material(position);
+  CHECK_CLOSE_REL(material.X0(), expected.X0(), 1e-2);
+  CHECK_CLOSE_REL(material.molarDensity(), expected.molarDensity(), 1e-2);
+}
+
+BOOST_AUTO_TEST_CASE(CompressedMaterialMap_invalid_test) {
+  BinUtility bu(2, -1., 1., open, AxisDirection::AxisX);
+  bu += BinUtility(2, -1., 1., open, AxisDirection::AxisY);
+  bu += BinUtility(2, -1., 1., open, AxisDirection::AxisZ);
+  MaterialMap3D reference = makeMap(bu, 2);
+
+  std::vector<std::byte> buffer = CompressedMaterialMap::encode(reference);
+  std::vector<std::byte> truncated(buffer.begin(), buffer.end() - 1);
+  BOOST_CHECK_THROW(CompressedMaterialMap{truncated}, std::invalid_argument);
+  std::vector<std::byte> corrupted = buffer;
+  corrupted[0] = std::byte{0};
+  BOOST_CHECK_THROW(CompressedMaterialMap{corrupted}, std::invalid_argument);
+
+  // The material indices must point into the dictionary
+  CompressedMaterialMap::Header header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  BOOST_CHECK_EQUAL(header.indexBytes, 2u);
+  std::vector<std::byte> badIndex = buffer;
+  const std::uint16_t index = header.nMaterials;
+  std::memcpy(badIndex.data() + badIndex.size() - sizeof(index), &index,
+              sizeof(index));
+  BOOST_CHECK_THROW(CompressedMaterialMap{badIndex}, std::invalid_argument);
+
+  // Bin counts that overflow the size computation are rejected
+  std::vector<std::byte> overflow = buffer;
+  CompressedMaterialMap::Header bigHeader = header;
+  bigHeader.nBins = {0xffffffffu, 0xffffffffu, 0xffffffffu};
+  std::memcpy(overflow.data(), &bigHeader, sizeof(bigHeader));
+  BOOST_CHECK_THROW(CompressedMaterialMap{overflow}, std::invalid_argument);
+
+  // Empty or inverted axis ranges are rejected
+  std::vector<std::byte> inverted = buffer;
+  CompressedMaterialMap::Header invertedHeader = header;
+  std::swap(invertedHeader.min[1], invertedHeader.max[1]);
+  std::memcpy(inverted.data(), &invertedHeader, sizeof(invertedHeader));
+  BOOST_CHECK_THROW(CompressedMaterialMap{inverted}, std::invalid_argument);
+
+  // Positions far outside the grid or not a number end up in the
+  // under- and overflow bins
+  CompressedMaterialMap closest(buffer);
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double huge = std::numeric_limits<double>::max();
+  BOOST_CHECK_EQUAL(closest.material(Vector3(huge, 0., 0.)),
+                    closest.material(Vector3(1.5, 0., 0.)));
+  BOOST_CHECK_EQUAL(closest.material(Vector3(-huge, 0., 0.)),
+                    closest.material(Vector3(-1.5, 0., 0.)));
+  BOOST_CHECK_EQUAL(closest.material(Vector3(nan, 0., 0.)),
+                    closest.material(Vector3(-1.5, 0., 0.)));
+  BOOST_CHECK(!closest.isInside(Vector3(nan, 0., 0.)));
+  CompressedMaterialMap interpolated(buffer, true);
+  interpolated.material(Vector3(huge, -huge, nan));
+
+  // Only 3D binnings can be encoded
+  BinUtility bu2D(2, -1., 1., open, AxisDirection::AxisX);
+  bu2D += BinUtility(2, -1., 1., open, AxisDirection::AxisY);
+  BOOST_CHECK_THROW(CompressedMaterialMap::encode(
+                        reference.getMapper().getGrid(), bu2D),
+                    std::invalid_argument);
+}
+
+}  // namespace Acts::Test
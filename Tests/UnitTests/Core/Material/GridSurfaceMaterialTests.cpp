@@ -182,6 +182,30 @@ BOOST_AUTO_TEST_CASE(GridMaterial1D) {
   BOOST_CHECK_EQUAL(mg3.material().X0(), 21.);
   BOOST_CHECK_EQUAL(mg4.material().X0(), 31.);
 
+  // The constants are precomputed from the filled grid
+  using GridX = Acts::Grid<Acts::MaterialSlab,
+                           Acts::Axis<Acts::AxisType::Equidistant,
+                                      Acts::AxisBoundaryType::Bound>>;
+  auto& gsmX = dynamic_cast<
+      Acts::GridSurfaceMaterialT<GridX, Acts::GridMaterialAccessor>&>(*ismX);
+  BOOST_CHECK_EQUAL(gsmX.materialAccessor().constants.size(),
+                    gsmX.grid().size());
+  Acts::MaterialSlabConstants cg3;
+  BOOST_CHECK_EQUAL(ismX->materialSlabWithConstants(g3, cg3), mg3);
+  BOOST_CHECK_EQUAL(cg3.thicknessInX0, mg3.thicknessInX0());
+
+  // Scaling keeps them in sync
+  ismX->scale(2.);
+  BOOST_CHECK_EQUAL(ismX->materialSlabWithConstants(g3, cg3).thickness(), 6.);
+  BOOST_CHECK_EQUAL(cg3.thickness, 6.f);
+  BOOST_CHECK_EQUAL(cg3.thicknessInX0, mg3.thicknessInX0());
+
+  // Writable grid access drops them, they are computed on the fly then
+  ismX->gridView();
+  BOOST_CHECK(gsmX.materialAccessor().constants.empty());
+  BOOST_CHECK_EQUAL(ismX->materialSlabWithConstants(g3, cg3), mg3);
+  BOOST_CHECK_EQUAL(cg3.thicknessInX0, mg3.thicknessInX0());
+
   // Try the same with Closed access
   // Bound, equidistant axis
   Acts::ProtoAxis pAxisPhi(Acts::AxisBoundaryType::Closed, -std::numbers::pi,
@@ -672,6 +696,12 @@ BOOST_AUTO_TEST_CASE(GridGloballyIndexedMaterialNonShared) {
   const Acts::MaterialSlab& sml0g1 = ism1.materialSlab(l0g1);
   BOOST_CHECK_EQUAL(sml0g1.thickness(), 8.);
 
+  // The precomputed constants follow the scaling
+  Acts::MaterialSlabConstants cl0g1;
+  ism1.materialSlabWithConstants(Acts::Vector3(2.5, 0., 0.), cl0g1);
+  BOOST_CHECK_EQUAL(cl0g1.thickness, 8.f);
+  BOOST_CHECK_EQUAL(cl0g1.thicknessInX0, sml0g1.thicknessInX0());
+
   // First one stays unscaled
   const Acts::MaterialSlab& sml0 = ism.materialSlab(l0);
   BOOST_CHECK_EQUAL(sml0.thickness(), 1.);
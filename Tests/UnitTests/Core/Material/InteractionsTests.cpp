@@ -120,6 +120,79 @@ BOOST_DATA_TEST_CASE(vacuum, thickness* particle* momentum, x, i, m, q, p) {
       computeMultipleScatteringTheta0(vacuum, absPdg, m, qOverP, absQ), 0);
 }
 
+// precomputed slab constants give the same results as the slab functions
+BOOST_DATA_TEST_CASE(continuous_parameters, thickness* particle* momentum, x, i,
+                     m, q, p) {
+  const auto slab = Acts::MaterialSlab(material, x);
+  const auto qOverP = q / p;
+  const auto absQ = std::abs(q);
+  const auto absPdg = Acts::makeAbsolutePdgParticle(i);
+
+  const Acts::MaterialSlabConstants constants(slab);
+  const auto parameters = Acts::computeContinuousInteractionParameters(
+      constants, absPdg, m, qOverP, absQ);
+
+  BOOST_CHECK_CLOSE(
+      parameters.theta0,
+      computeMultipleScatteringTheta0(slab, absPdg, m, qOverP, absQ), 1e-4);
+  BOOST_CHECK_CLOSE(parameters.energyLossLandau,
+                    computeEnergyLossLandau(slab, m, qOverP, absQ), 1e-4);
+  BOOST_CHECK_CLOSE(parameters.energyLossLandauSigma,
+                    computeEnergyLossLandauSigma(slab, m, qOverP, absQ), 1e-4);
+
+  // no material -> no interactions
+  const auto vacuum = Acts::computeContinuousInteractionParameters(
+      Acts::MaterialSlabConstants(Acts::MaterialSlab::Vacuum(x)), absPdg, m,
+      qOverP, absQ);
+  BOOST_CHECK_EQUAL(vacuum.theta0, 0);
+  BOOST_CHECK_EQUAL(vacuum.energyLossLandau, 0);
+  BOOST_CHECK_EQUAL(vacuum.energyLossLandauSigma, 0);
+}
+
+// formulas with precomputed constants give bit-identical results, also after
+// scaling the thickness by the split factor and the path correction as done
+// in the point-wise material interaction
+BOOST_DATA_TEST_CASE(slab_constants, thickness* particle* momentum, x, i, m, q,
+                     p) {
+  auto slab = Acts::MaterialSlab(material, x);
+  const auto qOverP = q / p;
+  const auto absQ = std::abs(q);
+  const auto absPdg = Acts::makeAbsolutePdgParticle(i);
+
+  Acts::MaterialSlabConstants constants(slab);
+  for (double scale : {1.0, 0.5, 1.0 / 3.0, 1.7, 2.5}) {
+    slab.scaleThickness(scale);
+    constants.scaleThickness(scale);
+    BOOST_CHECK_EQUAL(constants.thickness, slab.thickness());
+    BOOST_CHECK_EQUAL(constants.thicknessInX0, slab.thicknessInX0());
+    BOOST_CHECK_EQUAL(computeEnergyLossBethe(constants, m, qOverP, absQ),
+                      computeEnergyLossBethe(slab, m, qOverP, absQ));
+    BOOST_CHECK_EQUAL(
+        computeEnergyLossLandauSigmaQOverP(constants, m, qOverP, absQ),
+        computeEnergyLossLandauSigmaQOverP(slab, m, qOverP, absQ));
+    BOOST_CHECK_EQUAL(
+        computeMultipleScatteringTheta0(constants, absPdg, m, qOverP, absQ),
+        computeMultipleScatteringTheta0(slab, absPdg, m, qOverP, absQ));
+
+    const auto parameters = Acts::computeContinuousInteractionParameters(
+        constants, absPdg, m, qOverP, absQ);
+    BOOST_CHECK_EQUAL(
+        parameters.theta0,
+        computeMultipleScatteringTheta0(slab, absPdg, m, qOverP, absQ));
+    BOOST_CHECK_EQUAL(parameters.energyLossLandau,
+                      computeEnergyLossLandau(slab, m, qOverP, absQ));
+    BOOST_CHECK_EQUAL(parameters.energyLossLandauSigma,
+                      computeEnergyLossLandauSigma(slab, m, qOverP, absQ));
+  }
+
+  // scaling to zero thickness gives vacuum
+  constants.scaleThickness(0.0f);
+  BOOST_CHECK(constants.isVacuum);
+  BOOST_CHECK_EQUAL(computeEnergyLossBethe(constants, m, qOverP, absQ), 0);
+  BOOST_CHECK_EQUAL(
+      computeMultipleScatteringTheta0(constants, absPdg, m, qOverP, absQ), 0);
+}
+
 // Silicon Bethe Energy Loss Validation
 // PDG value from https://pdg.lbl.gov/2022/AtomicNuclearProperties
 static const double momentum[] = {0.1003_GeV, 1.101_GeV, 10.11_GeV, 100.1_GeV};
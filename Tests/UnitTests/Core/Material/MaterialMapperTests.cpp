@@ -16,14 +16,17 @@
 #include "Acts/Material/MaterialInteraction.hpp"
 #include "Acts/Material/MaterialMapper.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Material/MaterialTrackView.hpp"
 #include "Acts/Material/interface/IAssignmentFinder.hpp"
 #include "Acts/Material/interface/ISurfaceMaterialAccumulater.hpp"
 #include "Acts/Propagator/SurfaceCollector.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
 #include <limits>
+#include <vector>
 
 namespace Acts::Test {
 
@@ -135,6 +138,20 @@ class MaterialBlender : public ISurfaceMaterialAccumulater {
     }
   };
 
+  /// Merge the material accumulated in another state
+  ///
+  /// @param state the state to merge into
+  /// @param other the state filled with other tracks
+  void merge(ISurfaceMaterialAccumulater::State& state,
+             const ISurfaceMaterialAccumulater::State& other) const override {
+    auto cState = static_cast<State*>(&state);
+    auto cOther = static_cast<const State*>(&other);
+    for (const auto& [surface, accumulatedMaterial] :
+         cOther->accumulatedMaterial) {
+      cState->accumulatedMaterial.at(surface).merge(accumulatedMaterial);
+    }
+  }
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
@@ -226,6 +243,90 @@ BOOST_AUTO_TEST_CASE(MaterialMapperFlowTest) {
   BOOST_CHECK(volumeMaps.empty());
 }
 
+/// @brief Columnar track views have to give the same maps as recorded tracks
+BOOST_AUTO_TEST_CASE(MaterialMapperTrackViewTest) {
+  std::vector<std::shared_ptr<Surface>> surfaces = {
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 20.0, 100.0),
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 30.0, 100.0),
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 50.0,
+                                           100.0)};
+
+  for (auto [is, surface] : enumerate(surfaces)) {
+    surface->assignGeometryId(GeometryIdentifier().withSensitive(is + 1));
+  }
+
+  auto assigner = std::make_shared<IntersectSurfacesFinder>();
+  assigner->surfaces = {surfaces[0].get(), surfaces[1].get(),
+                        surfaces[2].get()};
+  auto accumulator = std::make_shared<MaterialBlender>(surfaces);
+
+  MaterialMapper::Config mmConfig;
+  mmConfig.assignmentFinder = assigner;
+  mmConfig.surfaceMaterialAccumulater = accumulator;
+  MaterialMapper mapper(mmConfig);
+
+  auto trackState = mapper.createState();
+  auto viewState = mapper.createState();
+
+  Vector3 position(0., 0., 0.);
+  for (unsigned int it = 0; it < 11; ++it) {
+    Vector3 direction =
+        Vector3(0.9 + it * 0.02, 1.1 - it * 0.02, 0.).normalized();
+    RecordedMaterialTrack mTrack{{position, direction}, {}};
+    // The columns, with one invalid zero length step at the end
+    std::vector<float> x, y, z, dx, dy, dz, length, X0, L0, A, Z, rho;
+    for (unsigned int im = 0; im < 61; ++im) {
+      float val = it + 1.f;
+      Vector3 stepPosition = position + (im + 1) * direction;
+      x.push_back(stepPosition.x());
+      y.push_back(stepPosition.y());
+      z.push_back(stepPosition.z());
+      dx.push_back(direction.x());
+      dy.push_back(direction.y());
+      dz.push_back(direction.z());
+      length.push_back(im < 60 ? 0.1f : 0.f);
+      X0.push_back(val);
+      L0.push_back(val);
+      A.push_back(val);
+      Z.push_back(val);
+      rho.push_back(val);
+      if (im < 60) {
+        MaterialInteraction mi;
+        mi.materialSlab =
+            MaterialSlab(Material::fromMassDensity(val, val, val, val, val),
+                         length.back());
+        mi.position = Vector3(x.back(), y.back(), z.back());
+        mi.direction = Vector3(dx.back(), dy.back(), dz.back());
+        mTrack.second.materialInteractions.push_back(mi);
+      }
+    }
+    MaterialTrackView mtView{position, direction, x, y, z, dx, dy,
+                             dz, length, X0, L0, A, Z, rho};
+    BOOST_CHECK_EQUAL(mtView.size(), 61u);
+
+    auto [mapped, unmapped] =
+        mapper.mapMaterial(*trackState, tContext, {}, mTrack);
+    auto [nAssigned, nUnassigned] =
+        mapper.mapMaterial(*viewState, tContext, {}, mtView);
+    BOOST_CHECK_EQUAL(nAssigned, mapped.second.materialInteractions.size());
+    BOOST_CHECK_EQUAL(nUnassigned,
+                      unmapped.second.materialInteractions.size());
+    BOOST_CHECK_EQUAL(nAssigned + nUnassigned, 60u);
+  }
+
+  auto [trackMaps, trackVolumeMaps] = mapper.finalizeMaps(*trackState);
+  auto [viewMaps, viewVolumeMaps] = mapper.finalizeMaps(*viewState);
+  BOOST_CHECK_EQUAL(trackMaps.size(), viewMaps.size());
+  for (const auto& [geoId, trackMaterial] : trackMaps) {
+    const auto& viewMaterial = viewMaps.at(geoId);
+    Vector3 origin(0., 0., 0.);
+    const MaterialSlab& trackSlab = trackMaterial->materialSlab(origin);
+    const MaterialSlab& viewSlab = viewMaterial->materialSlab(origin);
+    CHECK_CLOSE_REL(viewSlab.thickness(), trackSlab.thickness(), 1e-6);
+    CHECK_CLOSE_REL(viewSlab.material().X0(), trackSlab.material().X0(), 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MaterialMapperInvalidTest) {
   // The assigner
   auto assigner = std::make_shared<IntersectSurfacesFinder>();
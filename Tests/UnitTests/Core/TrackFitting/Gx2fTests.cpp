@@ -32,6 +32,7 @@
 #include "Acts/Visualization/GeometryView3D.hpp"
 #include "Acts/Visualization/ObjVisualization3D.hpp"
 
+#include <filesystem>
 #include <numbers>
 #include <vector>
 
@@ -1068,9 +1069,10 @@ BOOST_AUTO_TEST_CASE(Material) {
     const Acts::TrackingVolume& tgVolume =
         *(detector.geometry->highestTrackingVolume());
 
-    GeometryView3D::drawTrackingVolume(obj, tgVolume, geoCtx, viewContainer,
-                                       viewVolume, viewPassive, viewSensitive,
-                                       viewGrid, true, tag);
+    GeometryView3D::drawTrackingVolume(
+        obj, tgVolume, geoCtx, viewContainer, viewVolume, viewPassive,
+        viewSensitive, viewGrid, true, tag,
+        std::filesystem::temp_directory_path());
   }
   // Helper to visualise the measurements
   {
@@ -1085,7 +1087,7 @@ BOOST_AUTO_TEST_CASE(Material) {
     drawMeasurements(obj, measurements, detector.geometry, geoCtx,
                      localErrorScale, mcolor);
 
-    obj.write("meas");
+    obj.write(std::filesystem::temp_directory_path() / "meas");
   }
 
   BOOST_REQUIRE(res.ok());
@@ -22,6 +22,7 @@
 #include <numbers>
 #include <optional>
 #include <utility>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -646,4 +647,65 @@ BOOST_AUTO_TEST_CASE(track_removing) {
   CHECK_CLOSE_ABS(0., sixthDensitySum2D, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(bulk_track_adding_and_removing) {
+  for (bool useTime : {false, true}) {
+    AdaptiveGridTrackDensity::Config cfg;
+    cfg.spatialTrkGridSizeRange = {29, 29};
+    cfg.spatialBinExtent = 0.05;
+    cfg.temporalTrkGridSizeRange = {9, 9};
+    cfg.temporalBinExtent = 0.05;
+    cfg.useTime = useTime;
+    AdaptiveGridTrackDensity grid(cfg);
+
+    Covariance covMat = makeRandomCovariance();
+
+    std::shared_ptr<PerigeeSurface> perigeeSurface =
+        Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+
+    // Partially overlapping tracks, including a duplicate
+    std::vector<BoundTrackParameters> tracks;
+    for (double z0 : {-0.45, -0.25, 0.3, -0.45, 0.33}) {
+      BoundVector paramVec;
+      paramVec << 0.1, z0, 0, 0, 0, -0.15;
+      tracks.emplace_back(perigeeSurface, paramVec, covMat,
+                          ParticleHypothesis::pion());
+    }
+
+    std::vector<AdaptiveGridTrackDensity::DensityMap> trackDensityMaps;
+    std::vector<const AdaptiveGridTrackDensity::DensityMap*> trackDensities;
+    for (const auto& trk : tracks) {
+      trackDensityMaps.push_back(grid.createTrackDensityMap(trk));
+    }
+    for (const auto& trackDensityMap : trackDensityMaps) {
+      trackDensities.push_back(&trackDensityMap);
+    }
+
+    // Reference: add the tracks bin by bin
+    AdaptiveGridTrackDensity::DensityMap expected;
+    for (const auto& trackDensityMap : trackDensityMaps) {
+      for (const auto& [bin, density] : trackDensityMap) {
+        expected[bin] += density;
+      }
+    }
+
+    AdaptiveGridTrackDensity::DensityMap singleAdded;
+    for (const auto& trk : tracks) {
+      grid.addTrack(trk, singleAdded);
+    }
+    BOOST_CHECK(singleAdded == expected);
+
+    AdaptiveGridTrackDensity::DensityMap mainDensityMap;
+    grid.addTrackDensities(trackDensities, mainDensityMap);
+    BOOST_CHECK(mainDensityMap == expected);
+
+    // Reference: remove two tracks one by one
+    grid.subtractTrack(trackDensityMaps[1], expected);
+    grid.subtractTrack(trackDensityMaps[3], expected);
+
+    grid.subtractTrackDensities({trackDensities[1], trackDensities[3]},
+                                mainDensityMap);
+    BOOST_CHECK(mainDensityMap == expected);
+  }
+}
+
 }  // namespace Acts::Test
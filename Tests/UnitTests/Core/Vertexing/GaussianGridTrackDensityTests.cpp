@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -237,6 +238,53 @@ BOOST_AUTO_TEST_CASE(gaussian_grid_sum_max_densitytest) {
   BOOST_CHECK_EQUAL(*maxRes, posZ2);
 }
 
+/// @brief Tests that the first of several equal maxima is returned
+BOOST_AUTO_TEST_CASE(gaussian_grid_equal_max_density_test) {
+  constexpr int mainGridSize = 50;
+  constexpr int trkGridSize = 11;
+
+  using Grid = Acts::GaussianGridTrackDensity;
+
+  double binSize = 0.1;  // mm
+  double zMinMax = mainGridSize / 2 * binSize;
+
+  Grid::Config cfg(zMinMax, mainGridSize, trkGridSize);
+  Grid grid(cfg);
+
+  Grid::MainGridVector mainGrid = Grid::MainGridVector::Zero(mainGridSize);
+  mainGrid(10) = 1.;
+  mainGrid(20) = 0.5;
+  mainGrid(30) = 1.;
+
+  auto maxRes = grid.getMaxZPosition(mainGrid);
+  BOOST_CHECK(maxRes.ok());
+  BOOST_CHECK_EQUAL(*maxRes, (10 - mainGridSize / 2.0f + 0.5f) * cfg.binSize);
+}
+
+/// @brief Tests that a NaN density still gives a bin inside the grid
+BOOST_AUTO_TEST_CASE(gaussian_grid_nan_density_test) {
+  constexpr int mainGridSize = 50;
+  constexpr int trkGridSize = 11;
+
+  using Grid = Acts::GaussianGridTrackDensity;
+
+  double binSize = 0.1;  // mm
+  double zMinMax = mainGridSize / 2 * binSize;
+
+  Grid::Config cfg(zMinMax, mainGridSize, trkGridSize);
+  cfg.useHighestSumZPosition = true;
+  Grid grid(cfg);
+
+  Grid::MainGridVector mainGrid = Grid::MainGridVector::Zero(mainGridSize);
+  mainGrid(0) = std::numeric_limits<float>::quiet_NaN();
+  mainGrid(20) = 1.;
+
+  auto maxRes = grid.getMaxZPosition(mainGrid);
+  BOOST_REQUIRE(maxRes.ok());
+  BOOST_CHECK_GE(*maxRes, -zMinMax);
+  BOOST_CHECK_LE(*maxRes, zMinMax);
+}
+
 /// @brief Tests the seed width
 BOOST_AUTO_TEST_CASE(gaussian_grid_seed_width_test) {
   // Define the size of the grids
@@ -0,0 +1,192 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
+#include "Acts/Vertexing/TrackLinearizationCache.hpp"
+#include "Acts/Vertexing/TrackLinearizer.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+using HelicalPropagator = Propagator<EigenStepper<>>;
+
+GeometryContext geoContext = GeometryContext();
+MagneticFieldContext magFieldContext = MagneticFieldContext();
+
+std::vector<BoundTrackParameters> makeTracks(
+    const std::shared_ptr<PerigeeSurface>& perigeeSurface) {
+  std::vector<BoundTrackParameters> tracks;
+  for (unsigned int iTrack = 0; iTrack < 5; iTrack++) {
+    BoundVector paramVec;
+    paramVec << 0.01_mm * iTrack, 0.1_mm * iTrack, 0.3 * iTrack,
+        1. + 0.2 * iTrack, (iTrack % 2 == 0 ? 1. : -1.) / (1_GeV + iTrack),
+        0.;
+    BoundSquareMatrix covMat = BoundSquareMatrix::Identity() * 0.01;
+    tracks.emplace_back(perigeeSurface, paramVec, covMat,
+                        ParticleHypothesis::pion());
+  }
+  return tracks;
+}
+
+BOOST_AUTO_TEST_CASE(track_linearization_cache_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 2_T});
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<HelicalPropagator>(stepper);
+
+  HelicalTrackLinearizer::Config linConfig;
+  linConfig.bField = bField;
+  linConfig.propagator = propagator;
+  HelicalTrackLinearizer linFactory(linConfig);
+
+  TrackLinearizer linearizer;
+  linearizer.connect<&HelicalTrackLinearizer::linearizeTrack>(&linFactory);
+
+  MagneticFieldProvider::Cache fieldCache = bField->makeCache(magFieldContext);
+
+  auto perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3{0., 0., 0.});
+  std::vector<BoundTrackParameters> tracks = makeTracks(perigeeSurface);
+
+  auto linSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3{0.1_mm, 0., 1_mm});
+  auto otherLinSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3{0.1_mm, 0., 2_mm});
+
+  TrackLinearizationCache cache;
+
+  // First pass computes all linearizations
+  auto linTracks = cache.linearizeTracks(linearizer, tracks, 0., *linSurface,
+                                         geoContext, magFieldContext,
+                                         fieldCache);
+  BOOST_CHECK_EQUAL(linTracks.size(), tracks.size());
+  BOOST_CHECK_EQUAL(cache.nHits(), 0u);
+  BOOST_CHECK_EQUAL(cache.nMisses(), tracks.size());
+
+  // Second pass around the same point is served from the cache and agrees
+  // with a direct linearization
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    LinearizedTrack cached =
+        cache
+            .linearizeTrack(linearizer, tracks[i], 0., *linSurface, geoContext,
+                            magFieldContext, fieldCache)
+            .value();
+    LinearizedTrack direct =
+        linFactory
+            .linearizeTrack(tracks[i], 0., *linSurface, geoContext,
+                            magFieldContext, fieldCache)
+            .value();
+    BOOST_CHECK_EQUAL(cached.parametersAtPCA, direct.parametersAtPCA);
+    BOOST_CHECK_EQUAL(cached.covarianceAtPCA, direct.covarianceAtPCA);
+    BOOST_CHECK_EQUAL(cached.positionJacobian, direct.positionJacobian);
+    BOOST_CHECK_EQUAL(cached.momentumJacobian, direct.momentumJacobian);
+    BOOST_CHECK_EQUAL(cached.constantTerm, direct.constantTerm);
+    BOOST_CHECK_EQUAL(cached.linearizationPoint, direct.linearizationPoint);
+    BOOST_CHECK_EQUAL(linTracks[i].value().parametersAtPCA,
+                      direct.parametersAtPCA);
+  }
+  BOOST_CHECK_EQUAL(cache.nHits(), tracks.size());
+  BOOST_CHECK_EQUAL(cache.nMisses(), tracks.size());
+
+  // A different linearization point or time is a miss
+  BOOST_CHECK(cache
+                  .linearizeTrack(linearizer, tracks[0], 0., *otherLinSurface,
+                                  geoContext, magFieldContext, fieldCache)
+                  .ok());
+  BOOST_CHECK(cache
+                  .linearizeTrack(linearizer, tracks[0], 1_ns, *linSurface,
+                                  geoContext, magFieldContext, fieldCache)
+                  .ok());
+  BOOST_CHECK_EQUAL(cache.nMisses(), tracks.size() + 2);
+
+  // Impact parameters are cached as well
+  ImpactPointEstimator::Config ipEstCfg(bField, propagator);
+  ImpactPointEstimator ipEst(ipEstCfg);
+  ImpactPointEstimator::State ipState{bField->makeCache(magFieldContext)};
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.nHits(), 0u);
+  BOOST_CHECK_EQUAL(cache.nMisses(), 0u);
+
+  Vector3 vtxPos{0.1_mm, 0., 1_mm};
+  BoundTrackParameters first =
+      cache
+          .estimate3DImpactParameters(ipEst, geoContext, magFieldContext,
+                                      tracks[1], vtxPos, ipState)
+          .value();
+  BoundTrackParameters second =
+      cache
+          .estimate3DImpactParameters(ipEst, geoContext, magFieldContext,
+                                      tracks[1], vtxPos, ipState)
+          .value();
+  BOOST_CHECK_EQUAL(first.parameters(), second.parameters());
+  BOOST_CHECK_EQUAL(&first.referenceSurface(), &second.referenceSurface());
+  BOOST_CHECK_EQUAL(cache.nHits(), 1u);
+  BOOST_CHECK_EQUAL(cache.nMisses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(track_linearization_cache_tolerance_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 2_T});
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<HelicalPropagator>(stepper);
+
+  HelicalTrackLinearizer::Config linConfig;
+  linConfig.bField = bField;
+  linConfig.propagator = propagator;
+  HelicalTrackLinearizer linFactory(linConfig);
+
+  TrackLinearizer linearizer;
+  linearizer.connect<&HelicalTrackLinearizer::linearizeTrack>(&linFactory);
+
+  MagneticFieldProvider::Cache fieldCache = bField->makeCache(magFieldContext);
+
+  auto perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3{0., 0., 0.});
+  std::vector<BoundTrackParameters> tracks = makeTracks(perigeeSurface);
+
+  auto linSurface = Surface::makeShared<PerigeeSurface>(Vector3{0., 0., 1_mm});
+  auto closeLinSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3{0., 0., 1_mm + 1_um});
+
+  TrackLinearizationCache::Config cfg;
+  cfg.positionTolerance = 10_um;
+  TrackLinearizationCache cache(cfg);
+
+  BOOST_CHECK(cache
+                  .linearizeTrack(linearizer, tracks[2], 0., *linSurface,
+                                  geoContext, magFieldContext, fieldCache)
+                  .ok());
+  BOOST_CHECK(cache
+                  .linearizeTrack(linearizer, tracks[2], 0., *closeLinSurface,
+                                  geoContext, magFieldContext, fieldCache)
+                  .ok());
+  BOOST_CHECK_EQUAL(cache.nHits(), 1u);
+  BOOST_CHECK_EQUAL(cache.nMisses(), 1u);
+}
+
+}  // namespace Acts::Test
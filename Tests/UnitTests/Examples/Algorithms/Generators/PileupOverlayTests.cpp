@@ -0,0 +1,312 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Zip.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Generators/MultiplicityGenerators.hpp"
+#include "ActsExamples/Generators/PileupLibrary.hpp"
+#include "ActsExamples/Generators/PileupOverlay.hpp"
+#include "ActsExamples/Generators/VertexGenerators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace ActsExamples;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+SimParticle makeParticle(SimBarcode id, Acts::PdgParticle pdg,
+                         const Acts::Vector4& position4,
+                         const Acts::Vector3& direction, double p) {
+  SimParticle particle(id, pdg, -1, 0.1_GeV);
+  particle.initial()
+      .setPosition4(position4)
+      .setDirection(direction.normalized())
+      .setAbsoluteMomentum(p);
+  return particle;
+}
+
+// Two interactions. The first one has a displaced secondary vertex, the
+// second one consists of a single particle.
+std::pair<SimParticleContainer, SimVertexContainer> makeEvent() {
+  const Acts::Vector4 origin1(1_mm, 2_mm, 3_mm, 4_ns);
+  const Acts::Vector4 origin2(0, 0, -10_mm, 0);
+  const Acts::Vector4 secondary(5_mm, 6_mm, 17_mm, 8_ns);
+
+  const SimBarcode p11 = SimBarcode{}.setVertexPrimary(1).setParticle(1);
+  const SimBarcode p12 = SimBarcode{}.setVertexPrimary(1).setParticle(2);
+  const SimBarcode p13 =
+      SimBarcode{}.setVertexPrimary(1).setVertexSecondary(1).setParticle(1);
+  const SimBarcode p21 = SimBarcode{}.setVertexPrimary(2).setParticle(1);
+
+  SimParticleContainer particles;
+  particles.insert(makeParticle(p11, Acts::PdgParticle::ePionMinus, origin1,
+                                {1, 0, 1}, 2_GeV));
+  particles.insert(makeParticle(p12, Acts::PdgParticle::eMuon, origin1,
+                                {-1, 2, -3}, 5_GeV));
+  particles.insert(makeParticle(p13, Acts::PdgParticle::eElectron, secondary,
+                                {0.5, -1, 4}, 0.7_GeV));
+  particles.insert(makeParticle(p21, Acts::PdgParticle::ePionMinus, origin2,
+                                {0, 1, -0.2}, 1.5_GeV));
+
+  SimVertexContainer vertices;
+  SimVertex primary1(SimVertexBarcode{}.setVertexPrimary(1), origin1);
+  primary1.outgoing = {p11, p12};
+  vertices.insert(primary1);
+  SimVertex secondary1(
+      SimVertexBarcode{}.setVertexPrimary(1).setVertexSecondary(1), secondary);
+  secondary1.incoming = {p12};
+  secondary1.outgoing = {p13};
+  vertices.insert(secondary1);
+  SimVertex primary2(SimVertexBarcode{}.setVertexPrimary(2), origin2);
+  primary2.outgoing = {p21};
+  vertices.insert(primary2);
+
+  return {particles, vertices};
+}
+
+// Check that identifiers are strictly increasing, as required to construct
+// the flat containers from ordered unique ranges.
+template <typename Range, typename Projection>
+bool isOrderedUnique(const Range& range, Projection proj) {
+  return std::adjacent_find(range.begin(), range.end(),
+                            [&](const auto& lhs, const auto& rhs) {
+                              return !(proj(lhs) < proj(rhs));
+                            }) == range.end();
+}
+
+auto particleId = [](const SimParticle& particle) {
+  return particle.particleId();
+};
+auto vertexId = [](const SimVertex& vertex) { return vertex.vertexId(); };
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PileupOverlaySuite)
+
+BOOST_AUTO_TEST_CASE(PileupLibraryPlace) {
+  const auto [inputParticles, inputVertices] = makeEvent();
+  PileupLibrary library;
+  library.add(inputParticles, inputVertices);
+  BOOST_CHECK_EQUAL(library.size(), 2u);
+  BOOST_CHECK_EQUAL(library.numParticles(), 4u);
+
+  const Acts::Vector4 origin = inputVertices.begin()->position4;
+  const Acts::Vector4 position4(10_mm, 20_mm, 30_mm, 40_ns);
+  const double phi = 0.5;
+  const SimBarcode::Value vertexPrimary = 7;
+
+  // Mirror in z, then rotate around the beam axis
+  const auto transform = [&](const Acts::Vector3& v) {
+    return Acts::Vector3(std::cos(phi) * v.x() - std::sin(phi) * v.y(),
+                         std::sin(phi) * v.x() + std::cos(phi) * v.y(),
+                         -v.z());
+  };
+
+  std::vector<SimParticle> particles;
+  std::vector<SimVertex> vertices;
+  library.place(0, vertexPrimary, position4, phi, true, particles, vertices);
+  BOOST_CHECK_THROW(
+      library.place(2, vertexPrimary, position4, phi, true, particles,
+                    vertices),
+      std::out_of_range);
+
+  const SimParticleContainer source(
+      inputParticles.begin(),
+      inputParticles.lower_bound(SimBarcode{}.setVertexPrimary(2)));
+  BOOST_REQUIRE_EQUAL(particles.size(), source.size());
+  for (const auto& [particle, ref] : Acts::zip(particles, source)) {
+    BOOST_CHECK_EQUAL(particle.particleId(),
+                      SimBarcode(ref.particleId())
+                          .setVertexPrimary(vertexPrimary));
+    BOOST_CHECK_EQUAL(particle.pdg(), ref.pdg());
+    BOOST_CHECK_EQUAL(particle.charge(), ref.charge());
+    BOOST_CHECK_EQUAL(particle.mass(), ref.mass());
+
+    const Acts::Vector4 relative = ref.fourPosition() - origin;
+    const Acts::Vector3 expected =
+        position4.head<3>() + transform(relative.head<3>());
+    CHECK_CLOSE_ABS(particle.position(), expected, 1e-9);
+    CHECK_CLOSE_ABS(particle.time(), position4[3] + relative[3], 1e-9);
+    CHECK_CLOSE_ABS(particle.direction(), transform(ref.direction()), 1e-12);
+    CHECK_CLOSE_REL(particle.absoluteMomentum(), ref.absoluteMomentum(),
+                    1e-12);
+    CHECK_CLOSE_REL(particle.transverseMomentum(), ref.transverseMomentum(),
+                    1e-12);
+  }
+
+  const std::vector<SimVertex> sourceVertices(inputVertices.begin(),
+                                              inputVertices.begin() + 2);
+  BOOST_REQUIRE_EQUAL(vertices.size(), sourceVertices.size());
+  for (const auto& [vertex, ref] : Acts::zip(vertices, sourceVertices)) {
+    BOOST_CHECK_EQUAL(vertex.vertexId(), SimVertexBarcode(ref.vertexId())
+                                             .setVertexPrimary(vertexPrimary));
+    const Acts::Vector4 relative = ref.position4 - origin;
+    CHECK_CLOSE_ABS(vertex.position(),
+                    position4.head<3>() + transform(relative.head<3>()),
+                    1e-9);
+    CHECK_CLOSE_ABS(vertex.time(), position4[3] + relative[3], 1e-9);
+    BOOST_CHECK_EQUAL(vertex.incoming.size(), ref.incoming.size());
+    BOOST_CHECK_EQUAL(vertex.outgoing.size(), ref.outgoing.size());
+    for (const auto& [id, refId] : Acts::zip(vertex.outgoing, ref.outgoing)) {
+      BOOST_CHECK_EQUAL(id, SimBarcode(refId).setVertexPrimary(vertexPrimary));
+    }
+    for (const auto& [id, refId] : Acts::zip(vertex.incoming, ref.incoming)) {
+      BOOST_CHECK_EQUAL(id, SimBarcode(refId).setVertexPrimary(vertexPrimary));
+    }
+  }
+  // The primary vertex is placed exactly at the requested position
+  BOOST_CHECK(vertices.front().position4 == position4);
+
+  // Appending a later primary vertex keeps the sequences ordered
+  library.place(1, vertexPrimary + 1, position4, -2.0, false, particles,
+                vertices);
+  BOOST_CHECK_EQUAL(particles.size(), 4u);
+  BOOST_CHECK_EQUAL(vertices.size(), 3u);
+  BOOST_CHECK(isOrderedUnique(particles, particleId));
+  BOOST_CHECK(isOrderedUnique(vertices, vertexId));
+}
+
+BOOST_AUTO_TEST_CASE(PileupOverlayExecute) {
+  auto [hardParticles, hardVertices] = makeEvent();
+
+  auto library = std::make_shared<PileupLibrary>();
+  library->add(hardParticles, hardVertices);
+
+  // An additional primary vertex without particles in the hard scatter
+  const Acts::Vector4 origin3(0, 0, 20_mm, 0);
+  hardVertices.insert(
+      SimVertex(SimVertexBarcode{}.setVertexPrimary(3), origin3));
+
+  const std::size_t nPileup = 20;
+  const Acts::Vector4 fixed(0.1_mm, -0.2_mm, 5_mm, 1_ns);
+
+  PileupOverlay::Config cfg;
+  cfg.inputParticles = "hard_particles";
+  cfg.inputVertices = "hard_vertices";
+  cfg.outputParticles = "particles";
+  cfg.outputVertices = "vertices";
+  cfg.library = library;
+  cfg.multiplicity = std::make_shared<FixedMultiplicityGenerator>(nPileup);
+  auto vertexGenerator =
+      std::make_shared<FixedPrimaryVertexPositionGenerator>();
+  vertexGenerator->fixed = fixed;
+  cfg.vertex = vertexGenerator;
+  cfg.randomNumbers = std::make_shared<RandomNumbers>(RandomNumbers::Config{});
+  PileupOverlay overlay(cfg, Acts::Logging::WARNING);
+
+  WhiteBoard board;
+  Acts::Test::addToWhiteBoard("hard_particles", hardParticles, board);
+  Acts::Test::addToWhiteBoard("hard_vertices", hardVertices, board);
+  AlgorithmContext ctx(0, 42, board, 0);
+  BOOST_REQUIRE(overlay.execute(ctx) == ProcessCode::SUCCESS);
+
+  const auto& particles =
+      Acts::Test::getFromWhiteBoard<SimParticleContainer>("particles", board);
+  const auto& vertices =
+      Acts::Test::getFromWhiteBoard<SimVertexContainer>("vertices", board);
+  BOOST_CHECK(isOrderedUnique(particles, particleId));
+  BOOST_CHECK(isOrderedUnique(vertices, vertexId));
+
+  // The hard scatter is kept unchanged
+  for (const SimParticle& ref : hardParticles) {
+    auto it = particles.find(ref.particleId());
+    BOOST_REQUIRE(it != particles.end());
+    BOOST_CHECK(it->fourPosition() == ref.fourPosition());
+    BOOST_CHECK(it->fourMomentum() == ref.fourMomentum());
+  }
+  for (const SimVertex& ref : hardVertices) {
+    auto it = vertices.find(ref.vertexId());
+    BOOST_REQUIRE(it != vertices.end());
+    BOOST_CHECK(it->position4 == ref.position4);
+  }
+
+  // The pileup is numbered after the last hard-scatter primary vertex
+  std::set<SimBarcode::Value> pileupPrimaries;
+  for (const SimParticle& particle :
+       std::ranges::subrange(particles.begin() + hardParticles.size(),
+                             particles.end())) {
+    const SimBarcode::Value vertexPrimary =
+        particle.particleId().vertexPrimary();
+    BOOST_CHECK_GT(vertexPrimary, 3u);
+    BOOST_CHECK_LE(vertexPrimary, 3u + nPileup);
+    pileupPrimaries.insert(vertexPrimary);
+
+    // Find the source interaction from the number of particles
+    const std::size_t groupSize = std::ranges::count_if(
+        particles, [&](const SimParticle& p) {
+          return p.particleId().vertexPrimary() == vertexPrimary;
+        });
+    BOOST_REQUIRE(groupSize == 3u || groupSize == 1u);
+    const SimBarcode::Value sourcePrimary = (groupSize == 3u) ? 1 : 2;
+    auto source = hardParticles.find(
+        SimBarcode(particle.particleId()).setVertexPrimary(sourcePrimary));
+    BOOST_REQUIRE(source != hardParticles.end());
+    const Acts::Vector4 origin =
+        hardVertices.find(SimVertexBarcode{}.setVertexPrimary(sourcePrimary))
+            ->position4;
+
+    // Shifted to the generated vertex, rotated and possibly mirrored
+    const Acts::Vector4 relative = particle.fourPosition() - fixed;
+    const Acts::Vector4 sourceRelative = source->fourPosition() - origin;
+    CHECK_CLOSE_ABS(relative.head<3>().norm(),
+                    sourceRelative.head<3>().norm(), 1e-9);
+    CHECK_CLOSE_ABS(relative.head<2>().norm(),
+                    sourceRelative.head<2>().norm(), 1e-9);
+    CHECK_CLOSE_ABS(std::abs(relative.z()), std::abs(sourceRelative.z()),
+                    1e-9);
+    CHECK_CLOSE_ABS(relative[3], sourceRelative[3], 1e-9);
+    BOOST_CHECK_EQUAL(particle.pdg(), source->pdg());
+    CHECK_CLOSE_REL(particle.absoluteMomentum(), source->absoluteMomentum(),
+                    1e-12);
+    CHECK_CLOSE_REL(particle.transverseMomentum(),
+                    source->transverseMomentum(), 1e-12);
+  }
+  BOOST_CHECK_EQUAL(pileupPrimaries.size(), nPileup);
+
+  // Every pileup interaction has its primary vertex at the generated position
+  std::size_t nPileupVertices = 0;
+  for (SimBarcode::Value vertexPrimary : pileupPrimaries) {
+    auto it = vertices.find(SimVertexBarcode{}.setVertexPrimary(vertexPrimary));
+    BOOST_REQUIRE(it != vertices.end());
+    BOOST_CHECK(it->position4 == fixed);
+    for (SimBarcode id : it->outgoing) {
+      BOOST_CHECK_EQUAL(id.vertexPrimary(), vertexPrimary);
+      BOOST_CHECK(particles.find(id) != particles.end());
+    }
+    nPileupVertices += (std::next(it) != vertices.end() &&
+                        std::next(it)->vertexId().vertexPrimary() ==
+                            vertexPrimary)
+                           ? 2
+                           : 1;
+  }
+  BOOST_CHECK_EQUAL(vertices.size(), hardVertices.size() + nPileupVertices);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+struct Thing {
+  GeometryIdentifier geoId;
+  std::size_t index = 0;
+
+  GeometryIdentifier geometryId() const { return geoId; }
+};
+
+GeometryIdentifier makeId(GeometryIdentifier::Value volume,
+                          GeometryIdentifier::Value layer,
+                          GeometryIdentifier::Value sensitive) {
+  return GeometryIdentifier()
+      .withVolume(volume)
+      .withLayer(layer)
+      .withSensitive(sensitive);
+}
+
+// elements in arbitrary order with gaps in all identifier components
+std::vector<Thing> makeThings() {
+  std::vector<GeometryIdentifier> ids = {
+      makeId(7, 4, 12),
+      makeId(2, 2, 1),
+      makeId(2, 6, 3),
+      makeId(2, 2, 1),
+      makeId(7, 4, 9),
+      GeometryIdentifier().withVolume(2).withBoundary(3),
+      makeId(2, 2, 5),
+      makeId(7, 4, 12),
+      makeId(2, 6, 3).withExtra(1),
+      makeId(7, 4, 12),
+  };
+  std::vector<Thing> things;
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    things.push_back({ids[i], i});
+  }
+  return things;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataGeometryContainers)
+
+BOOST_AUTO_TEST_CASE(IndexedMultisetEmpty) {
+  GeometryIdIndexedMultiset<Thing> container;
+
+  BOOST_CHECK(container.empty());
+  BOOST_CHECK_EQUAL(container.size(), 0u);
+  BOOST_CHECK(selectModule(container, makeId(1, 2, 3)).empty());
+  BOOST_CHECK(selectModule(container, GeometryIdentifier()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(IndexedMultisetMatchesMultiset) {
+  std::vector<Thing> things = makeThings();
+  GeometryIdMultiset<Thing> reference(things.begin(), things.end());
+  GeometryIdIndexedMultiset<Thing> container(things);
+
+  BOOST_CHECK_EQUAL(container.size(), things.size());
+  BOOST_CHECK(std::ranges::is_sorted(container, detail::CompareGeometryId{}));
+
+  // stored ids, ids in the gaps, and ids outside of the tables
+  std::vector<GeometryIdentifier> queries = {
+      makeId(2, 2, 1),
+      makeId(2, 2, 5),
+      makeId(2, 6, 3),
+      makeId(7, 4, 9),
+      makeId(7, 4, 12),
+      makeId(2, 6, 3).withExtra(1),
+      GeometryIdentifier().withVolume(2).withBoundary(3),
+      makeId(2, 2, 3),
+      makeId(2, 4, 1),
+      makeId(2, 6, 4),
+      makeId(2, 1, 1),
+      makeId(5, 4, 9),
+      makeId(7, 4, 8),
+      makeId(7, 4, 13),
+      makeId(8, 4, 12),
+      makeId(2, 2, 1).withApproach(1),
+      GeometryIdentifier(),
+  };
+  for (GeometryIdentifier geoId : queries) {
+    BOOST_TEST_INFO("geometry id " << geoId);
+    auto expected = selectModule(reference, geoId);
+    auto selected = selectModule(container, geoId);
+    BOOST_CHECK_EQUAL(selected.size(), expected.size());
+    BOOST_CHECK(std::ranges::equal(
+        selected, expected, [](const Thing& lhs, const Thing& rhs) {
+          return lhs.index == rhs.index;
+        }));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndexedMultisetKeepsOrder) {
+  std::vector<Thing> things = makeThings();
+  GeometryIdIndexedMultiset<Thing> container(things);
+
+  // elements of the same module keep their insertion order
+  auto selected = selectModule(container, makeId(7, 4, 12));
+  std::vector<std::size_t> indices;
+  std::ranges::transform(selected, std::back_inserter(indices),
+                         [](const Thing& thing) { return thing.index; });
+  std::vector<std::size_t> expected = {0, 7, 9};
+  BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(IndexedMultisetFromMultiset) {
+  std::vector<Thing> things = makeThings();
+  GeometryIdMultiset<Thing> reference(things.begin(), things.end());
+  GeometryIdIndexedMultiset<Thing> container(reference);
+
+  BOOST_CHECK_EQUAL(container.size(), reference.size());
+  for (const Thing& thing : reference) {
+    auto expected = selectModule(reference, thing.geometryId());
+    auto selected = selectModule(container, thing.geometryId());
+    BOOST_CHECK_EQUAL(selected.size(), expected.size());
+    BOOST_CHECK_EQUAL(std::distance(container.begin(), selected.begin()),
+                      std::distance(reference.cbegin(), expected.begin()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,67 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AsyncWriteQueue.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+
+BOOST_AUTO_TEST_SUITE(AsyncWriteQueueTest)
+
+BOOST_AUTO_TEST_CASE(ExecutesInOrder) {
+  std::vector<std::size_t> written;
+  AsyncWriteQueue queue(4);
+  for (std::size_t i = 0; i < 100; ++i) {
+    queue.push([&written, i]() { written.push_back(i); });
+  }
+  queue.flush();
+  BOOST_REQUIRE_EQUAL(written.size(), 100u);
+  for (std::size_t i = 0; i < written.size(); ++i) {
+    BOOST_CHECK_EQUAL(written[i], i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentProducers) {
+  // only the I/O thread touches the counter, no further locking needed
+  std::size_t counter = 0;
+  {
+    AsyncWriteQueue queue(8);
+    std::vector<std::thread> producers;
+    for (std::size_t t = 0; t < 4; ++t) {
+      producers.emplace_back([&]() {
+        for (std::size_t i = 0; i < 1000; ++i) {
+          queue.push([&counter]() { ++counter; });
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    // the destructor executes the remaining tasks
+  }
+  BOOST_CHECK_EQUAL(counter, 4000u);
+}
+
+BOOST_AUTO_TEST_CASE(RethrowsOnFlush) {
+  std::size_t counter = 0;
+  AsyncWriteQueue queue;
+  queue.push([]() { throw std::runtime_error("write failed"); });
+  queue.push([&counter]() { ++counter; });
+  BOOST_CHECK_THROW(queue.flush(), std::runtime_error);
+  BOOST_CHECK_EQUAL(counter, 1u);
+  // the error is only reported once
+  BOOST_CHECK_NO_THROW(queue.flush());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/PrefetchingReader.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+namespace {
+
+/// Reader writing the event number, counts how often it was called
+class CountingReader final : public IReader {
+ public:
+  CountingReader(std::size_t nEvents, std::size_t failingEvent)
+      : m_nEvents(nEvents), m_failingEvent(failingEvent) {
+    m_output.initialize("event");
+  }
+
+  std::string name() const override { return "CountingReader"; }
+
+  std::pair<std::size_t, std::size_t> availableEvents() const override {
+    return {0, m_nEvents};
+  }
+
+  ProcessCode read(const AlgorithmContext& ctx) override {
+    ++nReads;
+    if (ctx.eventNumber == m_failingEvent) {
+      return ProcessCode::ABORT;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    m_output(ctx, std::size_t{ctx.eventNumber});
+    return ProcessCode::SUCCESS;
+  }
+
+  std::atomic<std::size_t> nReads = 0;
+
+ private:
+  std::size_t m_nEvents;
+  std::size_t m_failingEvent;
+  WriteDataHandle<std::size_t> m_output{this, "Output"};
+};
+
+std::size_t readEvent(PrefetchingReader& reader, std::size_t event,
+                      ProcessCode expected = ProcessCode::SUCCESS) {
+  WhiteBoard board;
+  AlgorithmContext ctx(0, event, board, 0);
+  BOOST_REQUIRE(reader.read(ctx) == expected);
+  if (expected != ProcessCode::SUCCESS) {
+    return event;
+  }
+  return getFromWhiteBoard<std::size_t>("event", board);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PrefetchingReaderTest)
+
+BOOST_AUTO_TEST_CASE(ReadsEachEventOnce) {
+  auto upstream = std::make_shared<CountingReader>(50, 1000);
+  PrefetchingReader::Config cfg;
+  cfg.upstreamReader = upstream;
+  cfg.nThreads = 2;
+  cfg.readahead = 4;
+  PrefetchingReader reader(cfg, Acts::Logging::WARNING);
+  BOOST_CHECK_EQUAL(reader.name(), "PrefetchingCountingReader");
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, 50u);
+
+  BOOST_REQUIRE(reader.skip(10) == ProcessCode::SUCCESS);
+  for (std::size_t event = 10; event < 50; ++event) {
+    BOOST_CHECK_EQUAL(readEvent(reader, event), event);
+  }
+  // Events before the start of the readahead are read directly
+  BOOST_CHECK_EQUAL(readEvent(reader, 3), 3u);
+  BOOST_CHECK(reader.finalize() == ProcessCode::SUCCESS);
+  BOOST_CHECK_EQUAL(upstream->nReads, 41u);
+}
+
+BOOST_AUTO_TEST_CASE(BoundedReadahead) {
+  auto upstream = std::make_shared<CountingReader>(100, 1000);
+  PrefetchingReader::Config cfg;
+  cfg.upstreamReader = upstream;
+  cfg.nThreads = 4;
+  cfg.readahead = 5;
+  PrefetchingReader reader(cfg, Acts::Logging::WARNING);
+
+  BOOST_CHECK_EQUAL(readEvent(reader, 0), 0u);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  // At most the consumed event plus the full readahead window
+  BOOST_CHECK_LE(upstream->nReads, 6u);
+
+  // Jumping ahead reads the event directly and does not read it twice
+  BOOST_CHECK_EQUAL(readEvent(reader, 20), 20u);
+  for (std::size_t event = 1; event < 30; ++event) {
+    if (event != 20) {
+      BOOST_CHECK_EQUAL(readEvent(reader, event), event);
+    }
+  }
+  reader.finalize();
+  BOOST_CHECK_LE(upstream->nReads, 30u + cfg.readahead);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentConsumers) {
+  const std::size_t nEvents = 200;
+  auto upstream = std::make_shared<CountingReader>(nEvents, 1000);
+  PrefetchingReader::Config cfg;
+  cfg.upstreamReader = upstream;
+  cfg.nThreads = 2;
+  cfg.readahead = 8;
+  PrefetchingReader reader(cfg, Acts::Logging::WARNING);
+  BOOST_REQUIRE(reader.skip(0) == ProcessCode::SUCCESS);
+
+  // Events are picked in order but processed out of order, as in the
+  // sequencer event loop
+  std::atomic<std::size_t> nextEvent = 0;
+  std::atomic<std::size_t> nMismatches = 0;
+  std::vector<std::thread> consumers;
+  for (std::size_t t = 0; t < 4; ++t) {
+    consumers.emplace_back([&]() {
+      for (std::size_t event = nextEvent++; event < nEvents;
+           event = nextEvent++) {
+        WhiteBoard board;
+        AlgorithmContext ctx(0, event, board, 0);
+        if (reader.read(ctx) != ProcessCode::SUCCESS ||
+            getFromWhiteBoard<std::size_t>("event", board) != event) {
+          ++nMismatches;
+        }
+      }
+    });
+  }
+  for (auto& consumer : consumers) {
+    consumer.join();
+  }
+  reader.finalize();
+  BOOST_CHECK_EQUAL(nMismatches, 0u);
+  BOOST_CHECK_EQUAL(upstream->nReads, nEvents);
+}
+
+BOOST_AUTO_TEST_CASE(ForwardsFailures) {
+  auto upstream = std::make_shared<CountingReader>(10, 3);
+  PrefetchingReader::Config cfg;
+  cfg.upstreamReader = upstream;
+  PrefetchingReader reader(cfg, Acts::Logging::WARNING);
+  for (std::size_t event = 0; event < 10; ++event) {
+    readEvent(reader, event,
+              event == 3 ? ProcessCode::ABORT : ProcessCode::SUCCESS);
+  }
+
+  cfg.readahead = 0;
+  BOOST_CHECK_THROW(PrefetchingReader(cfg, Acts::Logging::WARNING),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+using namespace ActsExamples;
+
+namespace {
+
+constexpr std::size_t nStreams = 1000;
+
+// Draw from every stream of an event on the given number of threads, similar
+// to the digitization parallelized over modules
+std::vector<RandomEngine::result_type> drawStreams(
+    const RandomNumbers& randomNumbers, std::size_t event, int nThreads) {
+  WhiteBoard store;
+
+  std::vector<RandomEngine::result_type> draws(nStreams);
+  tbb::task_arena arena(nThreads);
+  arena.execute([&] {
+    tbb::parallel_for(std::size_t{0}, nStreams, [&](std::size_t stream) {
+      AlgorithmContext ctx(0, event, store,
+                           tbb::this_task_arena::current_thread_index());
+      RandomEngine rng =
+          randomNumbers.spawnGenerator(ctx, "Algorithm", stream * 0x10000u);
+      rng.discard(stream % 7);
+      draws[stream] = rng();
+    });
+  });
+  return draws;
+}
+
+// First uniform draw of each of the given number of streams
+std::vector<double> uniformDraws(const RandomNumbers& randomNumbers,
+                                 const AlgorithmContext& ctx,
+                                 std::string_view caller,
+                                 std::uint64_t firstStream) {
+  std::vector<double> draws;
+  for (std::uint64_t stream = firstStream; stream < firstStream + nStreams;
+       ++stream) {
+    RandomEngine rng = randomNumbers.spawnGenerator(ctx, caller, stream);
+    draws.push_back(std::uniform_real_distribution<double>(0., 1.)(rng));
+  }
+  return draws;
+}
+
+double correlation(const std::vector<double>& a, const std::vector<double>& b) {
+  const double n = static_cast<double>(a.size());
+  const double meanA = std::accumulate(a.begin(), a.end(), 0.) / n;
+  const double meanB = std::accumulate(b.begin(), b.end(), 0.) / n;
+  double covariance = 0.;
+  double varianceA = 0.;
+  double varianceB = 0.;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    covariance += (a[i] - meanA) * (b[i] - meanB);
+    varianceA += (a[i] - meanA) * (a[i] - meanA);
+    varianceB += (b[i] - meanB) * (b[i] - meanB);
+  }
+  return covariance / std::sqrt(varianceA * varianceB);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(RandomNumbersTests)
+
+BOOST_AUTO_TEST_CASE(StreamSeedsAreDistinct) {
+  RandomNumbers randomNumbers({});
+  WhiteBoard store;
+
+  // Two callers using the same stream identifiers, e.g. particle and module
+  // identifiers, in two consecutive events
+  std::set<RandomSeed> seeds;
+  std::size_t nSeeds = 0;
+  for (std::size_t event : {41u, 42u}) {
+    AlgorithmContext ctx(0, event, store, 0);
+    for (std::string_view caller : {"FatrasSimulation", "Digitization"}) {
+      for (std::uint64_t stream = 0; stream < nStreams; ++stream) {
+        seeds.insert(randomNumbers.generateSeed(ctx, caller, stream));
+        ++nSeeds;
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL(seeds.size(), nSeeds);
+}
+
+BOOST_AUTO_TEST_CASE(StreamsAreUncorrelated) {
+  RandomNumbers randomNumbers({});
+  WhiteBoard store;
+  AlgorithmContext ctx(0, 42, store, 0);
+  AlgorithmContext nextEvent(0, 43, store, 0);
+
+  const auto reference =
+      uniformDraws(randomNumbers, ctx, "FatrasSimulation", 0);
+  // The same streams of another caller, the neighbouring streams of the same
+  // caller, and the same streams in the next event. For independent streams
+  // the correlation is compatible with zero within 1/sqrt(nStreams) ~ 0.03.
+  const std::vector<std::vector<double>> others = {
+      uniformDraws(randomNumbers, ctx, "Digitization", 0),
+      uniformDraws(randomNumbers, ctx, "FatrasSimulation", 1),
+      uniformDraws(randomNumbers, nextEvent, "FatrasSimulation", 0),
+  };
+  for (const auto& other : others) {
+    BOOST_CHECK_LT(std::abs(correlation(reference, other)), 0.1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StreamsAreIndependentOfThreadCount) {
+  RandomNumbers randomNumbers({});
+
+  for (std::size_t event : {0u, 17u}) {
+    auto reference = drawStreams(randomNumbers, event, 1);
+    for (int nThreads : {2, 4, 8}) {
+      auto draws = drawStreams(randomNumbers, event, nThreads);
+      BOOST_CHECK_EQUAL_COLLECTIONS(draws.begin(), draws.end(),
+                                    reference.begin(), reference.end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
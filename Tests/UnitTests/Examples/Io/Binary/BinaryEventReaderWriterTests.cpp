@@ -0,0 +1,275 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventFormat.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryEventWriter.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <random>
+#include <vector>
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+namespace {
+
+struct Event {
+  SimHitContainer hits;
+  MeasurementContainer measurements;
+  SimSpacePointContainer spacePoints;
+};
+
+Event makeEvent(std::mt19937& gen, bool stripDetails) {
+  std::uniform_real_distribution<double> dist(-10., 10.);
+  std::uniform_int_distribution<std::uint64_t> volume(1, 5);
+  auto vector4 = [&]() {
+    return Acts::Vector4(dist(gen), dist(gen), dist(gen), dist(gen));
+  };
+  auto vector3 = [&]() {
+    return Acts::Vector3(dist(gen), dist(gen), dist(gen));
+  };
+
+  Event event;
+  for (std::size_t i = 0; i < 20; ++i) {
+    Acts::GeometryIdentifier geoId =
+        Acts::GeometryIdentifier().withVolume(volume(gen)).withSensitive(i);
+    event.hits.emplace(geoId, ActsFatras::Barcode(100u + i), vector4(),
+                       vector4(), vector4(), static_cast<std::int32_t>(i));
+
+    // Alternate between one and two dimensional measurements
+    std::uint8_t size = 1 + i % 2;
+    auto meas = event.measurements.makeMeasurement(size, geoId);
+    for (std::uint8_t j = 0; j < size; ++j) {
+      meas.subspaceIndexVector()[j] = 2 * j;
+      meas.parameters()[j] = dist(gen);
+      for (std::uint8_t k = 0; k < size; ++k) {
+        meas.covariance()(j, k) = dist(gen);
+      }
+    }
+
+    boost::container::static_vector<Acts::SourceLink, 2> sourceLinks;
+    sourceLinks.emplace_back(IndexSourceLink(geoId, i));
+    std::optional<double> t;
+    if (i % 3 == 0) {
+      t = dist(gen);
+    }
+    if (stripDetails && i % 2 == 1) {
+      sourceLinks.emplace_back(IndexSourceLink(geoId, i + 1));
+      event.spacePoints.emplace_back(
+          vector3(), t, dist(gen), dist(gen), std::nullopt, sourceLinks, 1.5f,
+          2.5f, vector3(), vector3(), vector3(), vector3());
+    } else {
+      event.spacePoints.emplace_back(vector3(), t, dist(gen), dist(gen), t,
+                                     sourceLinks);
+    }
+  }
+  return event;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BinaryEventRoundTrip) {
+  std::mt19937 gen(23);
+  std::vector<Event> events;
+  events.push_back(makeEvent(gen, false));
+  events.push_back(makeEvent(gen, true));
+
+  BinaryEventWriter::Config writerConfig;
+  writerConfig.inputSimHits = "simhits";
+  writerConfig.inputMeasurements = "measurements";
+  writerConfig.inputSpacePoints = "spacepoints";
+  writerConfig.filePath = "events-roundtrip.bin";
+  {
+    BinaryEventWriter writer(writerConfig, Acts::Logging::WARNING);
+    // Write the events out of order, the reader has to sort them
+    for (std::size_t ie : {1u, 0u}) {
+      GenericReadWriteTool<>()
+          .add(writerConfig.inputSimHits, events[ie].hits)
+          .add(writerConfig.inputMeasurements, events[ie].measurements)
+          .add(writerConfig.inputSpacePoints, events[ie].spacePoints)
+          .write(writer, ie);
+    }
+    writer.finalize();
+  }
+
+  BinaryEventReader::Config readerConfig;
+  readerConfig.outputSimHits = "simhits";
+  readerConfig.outputMeasurements = "measurements";
+  readerConfig.outputSpacePoints = "spacepoints";
+  readerConfig.filePath = writerConfig.filePath;
+  BinaryEventReader reader(readerConfig, Acts::Logging::WARNING);
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, events.size());
+
+  auto readTool =
+      GenericReadWriteTool<>()
+          .add(readerConfig.outputSimHits, SimHitContainer{})
+          .add(readerConfig.outputMeasurements, MeasurementContainer{})
+          .add(readerConfig.outputSpacePoints, SimSpacePointContainer{});
+  for (std::size_t ie = 0; ie < events.size(); ++ie) {
+    const Event& expected = events[ie];
+    const auto [hits, measurements, spacePoints] = readTool.read(reader, ie);
+
+    BOOST_REQUIRE_EQUAL(hits.size(), expected.hits.size());
+    for (auto it = hits.begin(), ref = expected.hits.begin(); it != hits.end();
+         ++it, ++ref) {
+      BOOST_CHECK_EQUAL(it->geometryId(), ref->geometryId());
+      BOOST_CHECK_EQUAL(it->particleId(), ref->particleId());
+      BOOST_CHECK_EQUAL(it->index(), ref->index());
+      BOOST_CHECK_EQUAL(it->fourPosition(), ref->fourPosition());
+      BOOST_CHECK_EQUAL(it->momentum4Before(), ref->momentum4Before());
+      BOOST_CHECK_EQUAL(it->momentum4After(), ref->momentum4After());
+    }
+
+    BOOST_REQUIRE_EQUAL(measurements.size(), expected.measurements.size());
+    for (std::size_t im = 0; im < measurements.size(); ++im) {
+      auto meas = measurements.getMeasurement(im);
+      auto ref = expected.measurements.getMeasurement(im);
+      BOOST_CHECK_EQUAL(meas.geometryId(), ref.geometryId());
+      BOOST_REQUIRE_EQUAL(meas.size(), ref.size());
+      BOOST_CHECK_EQUAL(meas.subspaceIndexVector(), ref.subspaceIndexVector());
+      BOOST_CHECK_EQUAL(meas.parameters(), ref.parameters());
+      BOOST_CHECK_EQUAL(meas.covariance(), ref.covariance());
+    }
+    BOOST_CHECK(std::ranges::equal(measurements.orderedIndices(),
+                                   expected.measurements.orderedIndices()));
+
+    BOOST_REQUIRE_EQUAL(spacePoints.size(), expected.spacePoints.size());
+    for (std::size_t is = 0; is < spacePoints.size(); ++is) {
+      const SimSpacePoint& sp = spacePoints[is];
+      const SimSpacePoint& ref = expected.spacePoints[is];
+      BOOST_CHECK(sp == ref);
+      BOOST_CHECK_EQUAL(sp.sourceLinks().size(), ref.sourceLinks().size());
+      BOOST_CHECK_EQUAL(sp.validDoubleMeasurementDetails(),
+                        ref.validDoubleMeasurementDetails());
+      BOOST_CHECK_EQUAL(sp.topHalfStripLength(), ref.topHalfStripLength());
+      BOOST_CHECK_EQUAL(sp.bottomHalfStripLength(),
+                        ref.bottomHalfStripLength());
+      BOOST_CHECK_EQUAL(sp.topStripDirection(), ref.topStripDirection());
+      BOOST_CHECK_EQUAL(sp.stripCenterDistance(), ref.stripCenterDistance());
+      BOOST_CHECK_EQUAL(sp.topStripCenterPosition(),
+                        ref.topStripCenterPosition());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryEventReaderMissingCollection) {
+  std::mt19937 gen(42);
+  Event event = makeEvent(gen, false);
+
+  BinaryEventWriter::Config writerConfig;
+  writerConfig.inputSimHits = "simhits";
+  writerConfig.filePath = "events-simhits.bin";
+  {
+    BinaryEventWriter writer(writerConfig, Acts::Logging::WARNING);
+    GenericReadWriteTool<>()
+        .add(writerConfig.inputSimHits, event.hits)
+        .write(writer, 0);
+    writer.finalize();
+  }
+
+  // Requesting a collection which was not written fails the event
+  BinaryEventReader::Config readerConfig;
+  readerConfig.outputMeasurements = "measurements";
+  readerConfig.filePath = writerConfig.filePath;
+  BinaryEventReader reader(readerConfig, Acts::Logging::FATAL);
+  WhiteBoard board;
+  AlgorithmContext ctx(0, 0, board, 0);
+  BOOST_CHECK(reader.read(ctx) == ProcessCode::ABORT);
+}
+
+namespace {
+
+void writeSingleMeasurement(const std::string& filePath) {
+  MeasurementContainer measurements;
+  auto meas = measurements.makeMeasurement(
+      2, Acts::GeometryIdentifier().withVolume(1).withSensitive(1));
+  meas.subspaceIndexVector()[0] = Acts::eBoundLoc0;
+  meas.subspaceIndexVector()[1] = Acts::eBoundPhi;
+  meas.parameters().setZero();
+  meas.covariance().setIdentity();
+
+  BinaryEventWriter::Config writerConfig;
+  writerConfig.inputMeasurements = "measurements";
+  writerConfig.filePath = filePath;
+  BinaryEventWriter writer(writerConfig, Acts::Logging::WARNING);
+  GenericReadWriteTool<>()
+      .add(writerConfig.inputMeasurements, measurements)
+      .write(writer, 0);
+  writer.finalize();
+}
+
+void overwrite(const std::string& filePath, std::size_t position,
+               std::uint8_t value) {
+  std::fstream file(filePath,
+                    std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(static_cast<std::streamoff>(position));
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+ProcessCode readMeasurements(const std::string& filePath) {
+  BinaryEventReader::Config readerConfig;
+  readerConfig.outputMeasurements = "measurements";
+  readerConfig.filePath = filePath;
+  BinaryEventReader reader(readerConfig, Acts::Logging::FATAL);
+  WhiteBoard board;
+  AlgorithmContext ctx(0, 0, board, 0);
+  return reader.read(ctx);
+}
+
+namespace Format = BinaryEventFormat;
+
+// The columns of the single measurement, each padded to 8 bytes
+constexpr std::size_t s_columnsBegin = sizeof(Format::FileHeader) +
+                                       sizeof(Format::BlockHeader) +
+                                       sizeof(Format::SectionHeader);
+constexpr std::size_t s_sizePosition = s_columnsBegin + 8;
+constexpr std::size_t s_subspacePosition = s_sizePosition + 8;
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BinaryEventReaderCorruptedMeasurements) {
+  const std::string filePath = "events-corrupted.bin";
+
+  writeSingleMeasurement(filePath);
+  BOOST_CHECK(readMeasurements(filePath) == ProcessCode::SUCCESS);
+
+  // A measurement larger than the bound parameters
+  overwrite(filePath, s_sizePosition, Acts::eBoundSize + 1);
+  BOOST_CHECK(readMeasurements(filePath) == ProcessCode::ABORT);
+
+  // A subspace index outside of the bound parameters
+  writeSingleMeasurement(filePath);
+  overwrite(filePath, s_subspacePosition + 1, Acts::eBoundSize);
+  BOOST_CHECK(readMeasurements(filePath) == ProcessCode::ABORT);
+
+  // A repeated subspace index
+  writeSingleMeasurement(filePath);
+  overwrite(filePath, s_subspacePosition + 1, Acts::eBoundLoc0);
+  BOOST_CHECK(readMeasurements(filePath) == ProcessCode::ABORT);
+
+  // A valid size whose values extend beyond the section
+  writeSingleMeasurement(filePath);
+  overwrite(filePath, s_sizePosition, Acts::eBoundSize);
+  BOOST_CHECK(readMeasurements(filePath) == ProcessCode::ABORT);
+}
@@ -0,0 +1,57 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/CompressedMaterialMap.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Utilities/AxisDefinitions.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "ActsExamples/Io/Binary/BinaryVolumeMaterial.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+using namespace ActsExamples;
+
+BOOST_AUTO_TEST_CASE(BinaryVolumeMaterialRoundTrip) {
+  Acts::BinUtility bu(4, -2., 2., Acts::open, Acts::AxisDirection::AxisX);
+  bu += Acts::BinUtility(3, -1., 1., Acts::open, Acts::AxisDirection::AxisY);
+  bu += Acts::BinUtility(2, -1., 1., Acts::open, Acts::AxisDirection::AxisZ);
+
+  std::function<Acts::Vector3(Acts::Vector3)> transfoGlobalToLocal;
+  Acts::Grid3D grid = Acts::createGrid3D(bu, transfoGlobalToLocal);
+  Acts::MaterialGrid3D matGrid = Acts::mapMaterialPoints(grid);
+  for (std::size_t index = 0; index < matGrid.size(); ++index) {
+    float n = 1.f + (index % 4);
+    matGrid.at(index) =
+        Acts::Material::fromMolarDensity(n, 2.f * n, 3.f * n, n, 0.5f * n)
+            .parameters();
+  }
+  Acts::InterpolatedMaterialMap<Acts::MaterialMapper<Acts::MaterialGrid3D>>
+      reference(Acts::MaterialMapper<Acts::MaterialGrid3D>(
+                    transfoGlobalToLocal, std::move(matGrid)),
+                bu);
+
+  Acts::CompressedMaterialMap map(
+      Acts::CompressedMaterialMap::encode(reference));
+  writeCompressedMaterialMap("volume-material.bin", map);
+  auto mapped = readCompressedMaterialMap("volume-material.bin");
+
+  BOOST_CHECK_EQUAL(mapped->nMaterials(), 4u);
+  BOOST_CHECK_EQUAL(mapped->buffer().size(), map.buffer().size());
+  for (double x : {-1.9, -0.4, 0.7, 1.5}) {
+    Acts::Vector3 position(x, 0.3 * x, -0.2 * x);
+    BOOST_CHECK_EQUAL(mapped->material(position), reference.material(position));
+  }
+}
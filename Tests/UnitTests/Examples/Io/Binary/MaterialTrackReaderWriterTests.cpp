@@ -0,0 +1,198 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialInteraction.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "ActsExamples/EventData/MaterialTrackBatch.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackFormat.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryMaterialTrackWriter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+using MaterialTrackCollection =
+    std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>;
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialTrackRoundTrip) {
+  std::mt19937 gen(23);
+  std::uniform_real_distribution<float> dist(0.5, 10.);
+  std::uniform_int_distribution<std::size_t> nSteps(0, 20);
+
+  // Two events with a few tracks of random material steps
+  std::vector<MaterialTrackCollection> events(2);
+  for (auto& event : events) {
+    for (std::size_t it = 0; it < 5; ++it) {
+      Acts::RecordedMaterialTrack mtrack;
+      mtrack.first.first = Acts::Vector3(dist(gen), dist(gen), dist(gen));
+      mtrack.first.second = Acts::Vector3(dist(gen), dist(gen), dist(gen));
+      std::size_t ns = nSteps(gen);
+      for (std::size_t is = 0; is < ns; ++is) {
+        Acts::MaterialInteraction mint;
+        mint.position = Acts::Vector3(dist(gen), dist(gen), dist(gen));
+        mint.direction = Acts::Vector3(dist(gen), dist(gen), dist(gen));
+        mint.materialSlab = Acts::MaterialSlab(
+            Acts::Material::fromMassDensity(dist(gen), dist(gen), dist(gen),
+                                            dist(gen), dist(gen)),
+            dist(gen));
+        mtrack.second.materialInteractions.push_back(mint);
+      }
+      event.emplace(it, mtrack);
+    }
+  }
+
+  BinaryMaterialTrackWriter::Config writerConfig;
+  writerConfig.inputMaterialTracks = "material-tracks";
+  writerConfig.filePath = "material-tracks-roundtrip.bin";
+  {
+    BinaryMaterialTrackWriter writer(writerConfig, Acts::Logging::WARNING);
+    // Write the events out of order, the reader has to sort them
+    for (std::size_t ie : {1u, 0u}) {
+      GenericReadWriteTool<>()
+          .add(writerConfig.inputMaterialTracks, events[ie])
+          .write(writer, ie);
+    }
+    writer.finalize();
+  }
+
+  BinaryMaterialTrackReader::Config readerConfig;
+  readerConfig.outputMaterialTrackBatch = "material-track-batch";
+  readerConfig.filePath = writerConfig.filePath;
+  BinaryMaterialTrackReader reader(readerConfig, Acts::Logging::WARNING);
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, events.size());
+
+  auto readTool = GenericReadWriteTool<>().add(
+      readerConfig.outputMaterialTrackBatch, MaterialTrackBatch{});
+  for (std::size_t ie = 0; ie < events.size(); ++ie) {
+    const auto [batch] = readTool.read(reader, ie);
+    BOOST_REQUIRE_EQUAL(batch.tracks.size(), events[ie].size());
+    // The tracks are written in the order of their identifiers
+    for (std::size_t it = 0; it < batch.tracks.size(); ++it) {
+      const Acts::MaterialTrackView& mtView = batch.tracks[it];
+      const auto& [start, recorded] = events[ie].at(it);
+      CHECK_CLOSE_REL(mtView.position, start.first, 1e-6);
+      CHECK_CLOSE_REL(mtView.momentum, start.second, 1e-6);
+      BOOST_REQUIRE_EQUAL(mtView.size(), recorded.materialInteractions.size());
+      for (std::size_t is = 0; is < mtView.size(); ++is) {
+        const auto& original = recorded.materialInteractions[is];
+        Acts::MaterialInteraction mint = mtView.interaction(is);
+        CHECK_CLOSE_REL(mint.position, original.position, 1e-6);
+        CHECK_CLOSE_REL(mint.direction, original.direction, 1e-6);
+        CHECK_CLOSE_REL(mint.materialSlab.thickness(),
+                        original.materialSlab.thickness(), 1e-6);
+        CHECK_CLOSE_REL(mint.materialSlab.material().X0(),
+                        original.materialSlab.material().X0(), 1e-6);
+        CHECK_CLOSE_REL(mint.materialSlab.material().Z(),
+                        original.materialSlab.material().Z(), 1e-6);
+        CHECK_CLOSE_REL(mint.materialSlab.material().molarDensity(),
+                        original.materialSlab.material().molarDensity(), 1e-5);
+      }
+    }
+  }
+}
+
+namespace {
+
+// Write a single event with two tracks of three steps each
+void writeSmallFile(const std::string& filePath) {
+  MaterialTrackCollection event;
+  for (std::size_t it = 0; it < 2; ++it) {
+    Acts::RecordedMaterialTrack mtrack;
+    for (std::size_t is = 0; is < 3; ++is) {
+      Acts::MaterialInteraction mint;
+      mint.materialSlab = Acts::MaterialSlab(
+          Acts::Material::fromMassDensity(1., 2., 3., 4., 5.), 1.);
+      mtrack.second.materialInteractions.push_back(mint);
+    }
+    event.emplace(it, mtrack);
+  }
+
+  BinaryMaterialTrackWriter::Config writerConfig;
+  writerConfig.inputMaterialTracks = "material-tracks";
+  writerConfig.filePath = filePath;
+  BinaryMaterialTrackWriter writer(writerConfig, Acts::Logging::WARNING);
+  GenericReadWriteTool<>()
+      .add(writerConfig.inputMaterialTracks, event)
+      .write(writer, 0);
+  writer.finalize();
+}
+
+void overwrite(const std::string& filePath, std::size_t position,
+               std::uint64_t value) {
+  std::fstream file(filePath,
+                    std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(static_cast<std::streamoff>(position));
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+BinaryMaterialTrackReader makeReader(const std::string& filePath) {
+  BinaryMaterialTrackReader::Config readerConfig;
+  readerConfig.outputMaterialTrackBatch = "material-track-batch";
+  readerConfig.filePath = filePath;
+  return BinaryMaterialTrackReader(readerConfig, Acts::Logging::WARNING);
+}
+
+namespace Format = BinaryMaterialTrackFormat;
+
+constexpr std::size_t s_blockBegin = sizeof(Format::FileHeader);
+constexpr std::size_t s_nStepsPosition =
+    s_blockBegin + offsetof(Format::BlockHeader, nSteps);
+constexpr std::size_t s_offsetsBegin =
+    s_blockBegin + sizeof(Format::BlockHeader) +
+    2 * Format::s_trackParameters * sizeof(float);
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialTrackCorruptedFiles) {
+  const std::string filePath = "material-tracks-corrupted.bin";
+
+  writeSmallFile(filePath);
+  BOOST_CHECK_NO_THROW(makeReader(filePath));
+
+  // An empty file has no file header
+  std::filesystem::resize_file(filePath, 0);
+  BOOST_CHECK_THROW(makeReader(filePath), std::ios_base::failure);
+
+  // Missing bytes at the end of the block
+  writeSmallFile(filePath);
+  std::filesystem::resize_file(filePath,
+                               std::filesystem::file_size(filePath) - 4);
+  BOOST_CHECK_THROW(makeReader(filePath), std::ios_base::failure);
+
+  // A block size that overflows
+  writeSmallFile(filePath);
+  overwrite(filePath, s_nStepsPosition,
+            std::numeric_limits<std::uint64_t>::max() / 4);
+  BOOST_CHECK_THROW(makeReader(filePath), std::ios_base::failure);
+
+  // Step ranges beyond the number of steps
+  writeSmallFile(filePath);
+  overwrite(filePath, s_offsetsBegin + 2 * sizeof(std::uint64_t), 7);
+  BOOST_CHECK_THROW(makeReader(filePath), std::ios_base::failure);
+
+  // Decreasing step ranges
+  writeSmallFile(filePath);
+  overwrite(filePath, s_offsetsBegin + 2 * sizeof(std::uint64_t), 2);
+  BOOST_CHECK_THROW(makeReader(filePath), std::ios_base::failure);
+}
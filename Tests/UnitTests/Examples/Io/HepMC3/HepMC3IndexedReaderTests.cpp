@@ -0,0 +1,207 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Zip.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3IndexedReader.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3InputConverter.hpp"
+#include "ActsExamples/Io/HepMC3/HepMC3Reader.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+// Two events in GeV and mm. The first event has an implicit vertex, which is
+// created by the reader for the decay products of particle 3. The second
+// event has a displaced, explicit secondary vertex.
+constexpr const char* kEvents = R"(HepMC::Version 3.02.06
+HepMC::Asciiv3-START_EVENT_LISTING
+E 0 2 7
+U GEV MM
+P 1 0 2212 0.0 0.0 6.5e3 6.5e3 0.938272 4
+P 2 0 2212 0.0 0.0 -6.5e3 6.5e3 0.938272 4
+V -1 0 [1,2] @ 0.01 -0.02 5.0 0.0
+P 3 -1 111 1.0 2.0 3.0 3.9 0.134977 2
+P 4 3 22 0.5 1.0 1.5 1.8708 0.0 1
+P 5 3 22 0.5 1.0 1.5 1.8708 0.0 1
+P 6 -1 211 -1.0 0.5 20.0 20.04 0.13957 1
+P 7 -1 13 3.0 -0.4 0.1 3.03 0.105658 1
+E 1 2 6
+U GEV MM
+P 1 0 2212 0.0 0.0 6.5e3 6.5e3 0.938272 4
+P 2 0 2212 0.0 0.0 -6.5e3 6.5e3 0.938272 4
+V -1 0 [1,2] @ 0.0 0.0 -12.0 3.0
+P 3 -1 310 2.0 1.0 5.0 5.5 0.497611 2
+V -2 0 [3] @ 4.0 2.0 -2.0 3.5
+P 4 -2 211 1.2 0.6 3.0 3.3 0.13957 1
+P 5 -2 -211 0.8 0.4 2.0 2.2 0.13957 1
+P 6 -1 2112 0.1 0.2 0.3 1.0 0.939565 1
+HepMC::Asciiv3-END_EVENT_LISTING
+)";
+
+void checkParticles(const SimParticleContainer& particles,
+                    const SimParticleContainer& reference) {
+  BOOST_REQUIRE_EQUAL(particles.size(), reference.size());
+  for (const auto& [particle, ref] : Acts::zip(particles, reference)) {
+    BOOST_CHECK_EQUAL(particle.particleId(), ref.particleId());
+    BOOST_CHECK_EQUAL(particle.pdg(), ref.pdg());
+    BOOST_CHECK_EQUAL(particle.charge(), ref.charge());
+    BOOST_CHECK_EQUAL(particle.mass(), ref.mass());
+    BOOST_CHECK(particle.fourPosition() == ref.fourPosition());
+    BOOST_CHECK(particle.fourMomentum() == ref.fourMomentum());
+  }
+}
+
+void checkVertices(const SimVertexContainer& vertices,
+                   const SimVertexContainer& reference) {
+  BOOST_REQUIRE_EQUAL(vertices.size(), reference.size());
+  for (const auto& [vertex, ref] : Acts::zip(vertices, reference)) {
+    BOOST_CHECK_EQUAL(vertex.vertexId(), ref.vertexId());
+    BOOST_CHECK(vertex.position4 == ref.position4);
+    BOOST_CHECK(vertex.incoming == ref.incoming);
+    BOOST_CHECK(vertex.outgoing == ref.outgoing);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(HepMC3IndexedReaderMatchesConverter) {
+  const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                     "HepMC3IndexedReaderTests.hepmc3";
+  {
+    std::ofstream file(path);
+    file << kEvents;
+  }
+  std::filesystem::path indexPath = path;
+  indexPath += ".idx";
+  std::filesystem::remove(indexPath);
+  const std::size_t nEvents = 2;
+
+  // Reference from the sequential reader and the converter
+  HepMC3Reader::Config readerCfg;
+  readerCfg.inputPath = path;
+  readerCfg.outputEvent = "event";
+  readerCfg.numEvents = nEvents;
+  HepMC3Reader reader(readerCfg, Acts::Logging::WARNING);
+
+  HepMC3InputConverter::Config converterCfg;
+  converterCfg.inputEvent = readerCfg.outputEvent;
+  converterCfg.outputParticles = "particles";
+  converterCfg.outputVertices = "vertices";
+  HepMC3InputConverter converter(converterCfg, Acts::Logging::WARNING);
+
+  std::vector<std::pair<SimParticleContainer, SimVertexContainer>> reference;
+  for (std::size_t iEvent = 0; iEvent < nEvents; ++iEvent) {
+    WhiteBoard board;
+    AlgorithmContext ctx(0, iEvent, board, 0);
+    BOOST_REQUIRE(reader.read(ctx) == ProcessCode::SUCCESS);
+    BOOST_REQUIRE(converter.execute(ctx) == ProcessCode::SUCCESS);
+    reference.emplace_back(
+        getFromWhiteBoard<SimParticleContainer>("particles", board),
+        getFromWhiteBoard<SimVertexContainer>("vertices", board));
+  }
+  reader.finalize();
+
+  // The file values are taken in the native units
+  const auto& [particles0, vertices0] = reference.at(0);
+  BOOST_REQUIRE_EQUAL(particles0.size(), 4u);
+  BOOST_REQUIRE_EQUAL(vertices0.size(), 1u);
+  CHECK_CLOSE_REL(vertices0.begin()->position4.x(), 0.01_mm, 1e-9);
+  CHECK_CLOSE_REL(vertices0.begin()->position4.z(), 5_mm, 1e-9);
+  CHECK_CLOSE_REL(particles0.begin()->absoluteMomentum(),
+                  std::hypot(1., 2., 3.) * 0.5_GeV, 1e-9);
+  // The secondary vertex of the second event is kept
+  BOOST_CHECK_EQUAL(reference.at(1).first.size(), 3u);
+  BOOST_CHECK_EQUAL(reference.at(1).second.size(), 2u);
+
+  HepMC3IndexedReader::Config indexedCfg;
+  indexedCfg.inputPath = path;
+  indexedCfg.outputParticles = "indexed_particles";
+  indexedCfg.outputVertices = "indexed_vertices";
+
+  // The second reader re-uses the stored index
+  for (std::size_t iReader = 0; iReader < 2; ++iReader) {
+    HepMC3IndexedReader indexed(indexedCfg, Acts::Logging::WARNING);
+    BOOST_CHECK(std::filesystem::exists(indexPath));
+    BOOST_REQUIRE_EQUAL(indexed.availableEvents().second, nEvents);
+
+    // Random access in reverse order
+    for (std::size_t iEvent = nEvents; iEvent-- > 0;) {
+      auto [particles, vertices] = indexed.readEvent(iEvent);
+      checkParticles(particles, reference.at(iEvent).first);
+      checkVertices(vertices, reference.at(iEvent).second);
+    }
+
+    // Reading through the event store gives the same result
+    WhiteBoard board;
+    AlgorithmContext ctx(0, 1, board, 0);
+    BOOST_REQUIRE(indexed.read(ctx) == ProcessCode::SUCCESS);
+    checkParticles(
+        getFromWhiteBoard<SimParticleContainer>("indexed_particles", board),
+        reference.at(1).first);
+    checkVertices(
+        getFromWhiteBoard<SimVertexContainer>("indexed_vertices", board),
+        reference.at(1).second);
+  }
+
+  std::filesystem::remove(path);
+  std::filesystem::remove(indexPath);
+}
+
+BOOST_AUTO_TEST_CASE(HepMC3IndexedReaderRejectsOtherFormats) {
+  const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                     "HepMC3IndexedReaderTests.hepmc2";
+  std::filesystem::path indexPath = path;
+  indexPath += ".idx";
+
+  HepMC3IndexedReader::Config cfg;
+  cfg.inputPath = path;
+  cfg.outputParticles = "particles";
+  cfg.outputVertices = "vertices";
+
+  // The HepMC2 event records also start with 'E'
+  {
+    std::ofstream file(path);
+    file << "HepMC::Version 2.06.09\n"
+            "HepMC::IO_GenEvent-START_EVENT_LISTING\n"
+            "E 0 -1 -1 -1 -1 0 1 2 0 0 0 0\n"
+            "HepMC::IO_GenEvent-END_EVENT_LISTING\n";
+  }
+  BOOST_CHECK_THROW(HepMC3IndexedReader(cfg, Acts::Logging::WARNING),
+                    std::invalid_argument);
+
+  // Events without the HepMC3 header
+  {
+    std::ofstream file(path);
+    file << "E 0 2 7\nU GEV MM\n";
+  }
+  BOOST_CHECK_THROW(HepMC3IndexedReader(cfg, Acts::Logging::WARNING),
+                    std::invalid_argument);
+  BOOST_CHECK(!std::filesystem::exists(indexPath));
+
+  std::filesystem::remove(path);
+}
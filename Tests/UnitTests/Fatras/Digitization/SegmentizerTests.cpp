@@ -23,8 +23,10 @@
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 
 #include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <memory>
+#include <random>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -84,6 +86,60 @@ BOOST_AUTO_TEST_CASE(SegmentizerCartesian) {
   BOOST_CHECK_EQUAL(ixySegments.size(), 18);
 }
 
+BOOST_AUTO_TEST_CASE(SegmentizerCartesianLookup) {
+  Acts::GeometryContext geoCtx;
+
+  auto rectangleBounds = std::make_shared<Acts::RectangleBounds>(1., 1.);
+  auto planeSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Transform3::Identity(), rectangleBounds);
+
+  // Equidistant pixels and variable strips
+  Acts::BinUtility pixelated(20, -1., 1., Acts::open,
+                             Acts::AxisDirection::AxisX);
+  pixelated +=
+      Acts::BinUtility(20, -1., 1., Acts::open, Acts::AxisDirection::AxisY);
+  std::vector<float> stripEdges = {-1., -0.7, -0.2, 0., 0.15, 0.6, 1.};
+  Acts::BinUtility strips(stripEdges, Acts::open, Acts::AxisDirection::AxisX);
+  strips +=
+      Acts::BinUtility(1, -1., 1., Acts::open, Acts::AxisDirection::AxisY);
+
+  Segmentizer cl;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-0.99, 0.99);
+
+  for (const auto& segmentation : {pixelated, strips}) {
+    Segmentizer::SegmentationLookup lookup(segmentation);
+    BOOST_CHECK(lookup.cartesian);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+      Acts::Vector2 start(uniform(rng), uniform(rng));
+      Acts::Vector2 end(uniform(rng), uniform(rng));
+
+      auto generic =
+          cl.segments(geoCtx, *planeSurface, segmentation, {start, end});
+      auto traversed = cl.segments(geoCtx, *planeSurface, lookup, {start, end});
+
+      BOOST_REQUIRE_EQUAL(generic.size(), traversed.size());
+      for (std::size_t j = 0; j < generic.size(); ++j) {
+        BOOST_CHECK_EQUAL(generic[j].bin[0], traversed[j].bin[0]);
+        BOOST_CHECK_EQUAL(generic[j].bin[1], traversed[j].bin[1]);
+        BOOST_CHECK_SMALL(generic[j].activation - traversed[j].activation,
+                          1e-12);
+        for (std::size_t k = 0; k < 2; ++k) {
+          BOOST_CHECK_SMALL(
+              (generic[j].path2D[k] - traversed[j].path2D[k]).norm(), 1e-12);
+        }
+      }
+    }
+  }
+
+  // Non-cartesian segmentations fall back to the generic method
+  Acts::BinUtility polar(2, 0.5, 1., Acts::open, Acts::AxisDirection::AxisR);
+  polar += Acts::BinUtility(10, -0.5, 0.5, Acts::open,
+                            Acts::AxisDirection::AxisPhi);
+  BOOST_CHECK(!Segmentizer::SegmentationLookup(polar).cartesian);
+}
+
 BOOST_AUTO_TEST_CASE(SegmentizerPolarRadial) {
   Acts::GeometryContext geoCtx;
 
@@ -146,6 +202,7 @@ BOOST_DATA_TEST_CASE(
   auto testBeds = pstd(1.);
 
   DigitizationCsvOutput csvHelper;
+  const auto outputDir = std::filesystem::temp_directory_path();
 
   for (const auto& tb : testBeds) {
     const auto& name = std::get<0>(tb);
@@ -158,7 +215,7 @@ BOOST_DATA_TEST_CASE(
       std::ofstream grid;
       const auto centerXY = surface->center(geoCtx).segment<2>(0);
       // 0 - write the shape
-      shape.open("Segmentizer" + name + "Borders.csv");
+      shape.open(outputDir / ("Segmentizer" + name + "Borders.csv"));
       if (surface->type() == Acts::Surface::Plane) {
         const auto* pBounds =
             static_cast<const Acts::PlanarBounds*>(&(surface->bounds()));
@@ -169,7 +226,7 @@ BOOST_DATA_TEST_CASE(
         csvHelper.writePolygon(shape, dBounds->vertices(72), -centerXY);
       }
       // 1 - write the grid
-      grid.open("Segmentizer" + name + "Grid.csv");
+      grid.open(outputDir / ("Segmentizer" + name + "Grid.csv"));
       if (segmentation.binningData()[0].binvalue ==
               Acts::AxisDirection::AxisX &&
           segmentation.binningData()[1].binvalue ==
@@ -212,12 +269,12 @@ BOOST_DATA_TEST_CASE(
     auto end = randomizer(endR0, endR1);
 
     std::ofstream segments;
-    segments.open("Segmentizer" + name + "Segments_n" + std::to_string(index) +
-                  ".csv");
+    segments.open(outputDir / ("Segmentizer" + name + "Segments_n" +
+                               std::to_string(index) + ".csv"));
 
     std::ofstream cluster;
-    cluster.open("Segmentizer" + name + "Cluster_n" + std::to_string(index) +
-                 ".csv");
+    cluster.open(outputDir / ("Segmentizer" + name + "Cluster_n" +
+                              std::to_string(index) + ".csv"));
 
     /// Run the Segmentizer
     auto cSegments = cl.segments(geoCtx, *surface, segmentation, {start, end});
@@ -34,3 +34,26 @@ BOOST_DATA_TEST_CASE(FatrasBetheBloch, Dataset::parameters, pdg, phi, theta, p,
   // energy loss creates no new particles
   BOOST_CHECK(outgoing.empty());
 }
+
+BOOST_DATA_TEST_CASE(FatrasBetheBlochBatch, Dataset::parameters, pdg, phi,
+                     theta, p, seed) {
+  ActsFatras::Particle before = Dataset::makeParticle(pdg, phi, theta, p);
+  std::array<ActsFatras::Particle, 4> batch = {before, before, before, before};
+  std::array<ActsFatras::Particle, 4> single = batch;
+
+  ActsFatras::BetheBloch process;
+  Generator batchGen(seed);
+  process.batch(batchGen, Acts::Test::makeUnitSlab(), batch);
+  Generator singleGen(seed);
+  for (auto& particle : single) {
+    process(singleGen, Acts::Test::makeUnitSlab(), particle);
+  }
+
+  // the batch consumes the same random numbers as the single-particle calls
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    BOOST_CHECK_LT(batch[i].energy(), before.energy());
+    BOOST_CHECK_EQUAL(batch[i].energy(), single[i].energy());
+    BOOST_CHECK_EQUAL(batch[i].absoluteMomentum(),
+                      single[i].absoluteMomentum());
+  }
+}
@@ -20,6 +20,7 @@
 #include <array>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "Dataset.hpp"
 
@@ -61,3 +62,38 @@ BOOST_DATA_TEST_CASE(
                   p0.template segment<3>(Acts::eMom0).norm();
   CHECK_CLOSE_OR_SMALL(s, s0, 1e-2, 1e-2);
 }
+
+BOOST_DATA_TEST_CASE(
+    FatrasBetheHeitlerBatch,
+    Dataset::momentumPhi* Dataset::momentumTheta* Dataset::momentumAbs ^
+        Dataset::rngSeed,
+    phi, theta, p, seed) {
+  Generator gen(seed);
+  ActsFatras::Particle before =
+      Dataset::makeParticle(Acts::PdgParticle::eElectron, phi, theta, p);
+  std::array<ActsFatras::Particle, 4> particles = {before, before, before,
+                                                   before};
+  std::vector<ActsFatras::Particle> photons;
+
+  ActsFatras::BetheHeitler process;
+  process.batch(gen, Acts::Test::makeUnitSlab(), particles, photons);
+  // one photon per particle
+  BOOST_REQUIRE_EQUAL(photons.size(), particles.size());
+
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    const auto& after = particles[i];
+    const auto& photon = photons[i];
+    BOOST_CHECK_LT(after.absoluteMomentum(), before.absoluteMomentum());
+    BOOST_CHECK_LT(after.energy(), before.energy());
+    BOOST_CHECK_GT(photon.absoluteMomentum(), 0.);
+
+    // Test for similar invariant masses
+    Acts::Vector4 sum = after.fourMomentum() + photon.fourMomentum();
+    Acts::Vector4 p0 = before.fourMomentum();
+    double s = sum(Acts::eEnergy) * sum(Acts::eEnergy) -
+               sum.template segment<3>(Acts::eMom0).squaredNorm();
+    double s0 = p0(Acts::eEnergy) * p0(Acts::eEnergy) -
+                p0.template segment<3>(Acts::eMom0).squaredNorm();
+    CHECK_CLOSE_OR_SMALL(s, s0, 1e-2, 1e-2);
+  }
+}
@@ -0,0 +1,110 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/Physics/FusedElectroMagneticInteractions.hpp"
+#include "ActsFatras/Physics/StandardInteractions.hpp"
+
+#include <random>
+#include <vector>
+
+#include "Dataset.hpp"
+
+using namespace Acts::UnitLiterals;
+
+using Generator = std::ranlux48;
+
+namespace {
+
+void checkSameParticle(const ActsFatras::Particle& fused,
+                       const ActsFatras::Particle& standard) {
+  CHECK_CLOSE_REL(fused.absoluteMomentum(), standard.absoluteMomentum(), 1e-6);
+  CHECK_CLOSE_REL(fused.energy(), standard.energy(), 1e-6);
+  CHECK_CLOSE_ABS(fused.direction(), standard.direction(), 1e-9);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasFusedElectroMagneticInteractions)
+
+BOOST_DATA_TEST_CASE(SameAsStandardList, Dataset::parameters, pdg, phi, theta,
+                     p, seed) {
+  const ActsFatras::Particle before = Dataset::makeParticle(pdg, phi, theta, p);
+  const Acts::MaterialSlab slab = Acts::Test::makePercentSlab();
+
+  const auto standard =
+      ActsFatras::makeStandardChargedElectroMagneticInteractions(100_MeV);
+  const auto fused =
+      ActsFatras::makeFusedChargedElectroMagneticInteractions(100_MeV);
+
+  // run several steps to check the random number sequences stay in sync
+  Generator standardGen(seed);
+  Generator fusedGen(seed);
+  ActsFatras::Particle standardParticle = before;
+  ActsFatras::Particle fusedParticle = before;
+  std::vector<ActsFatras::Particle> standardGenerated;
+  std::vector<ActsFatras::Particle> fusedGenerated;
+  for (int step = 0; step < 4; ++step) {
+    bool standardBreak = standard.runContinuous(
+        standardGen, slab, standardParticle, standardGenerated);
+    bool fusedBreak =
+        fused.runContinuous(fusedGen, slab, fusedParticle, fusedGenerated);
+    BOOST_CHECK_EQUAL(fusedBreak, standardBreak);
+    checkSameParticle(fusedParticle, standardParticle);
+    if (standardBreak) {
+      break;
+    }
+  }
+  BOOST_CHECK_EQUAL(fusedGenerated.size(), standardGenerated.size());
+  for (std::size_t i = 0; i < fusedGenerated.size(); ++i) {
+    checkSameParticle(fusedGenerated[i], standardGenerated[i]);
+  }
+  BOOST_CHECK(standardGen() == fusedGen());
+}
+
+BOOST_AUTO_TEST_CASE(NeutralParticle) {
+  Generator gen(23);
+  const auto fused =
+      ActsFatras::makeFusedChargedElectroMagneticInteractions(100_MeV);
+  const ActsFatras::Particle before = Dataset::makeParticle(
+      Acts::PdgParticle::eGamma, 0_degree, 45_degree, 1_GeV);
+  ActsFatras::Particle after = before;
+  std::vector<ActsFatras::Particle> generated;
+
+  BOOST_CHECK(!fused.runContinuous(gen, Acts::Test::makeUnitSlab(), after,
+                                   generated));
+  BOOST_CHECK_EQUAL(after.energy(), before.energy());
+  BOOST_CHECK_EQUAL(after.direction(), before.direction());
+  BOOST_CHECK(generated.empty());
+}
+
+BOOST_AUTO_TEST_CASE(DisabledProcesses) {
+  Generator gen(23);
+  const ActsFatras::FusedChargedElectroMagneticInteractions<true, false, false>
+      scatteringOnly;
+  const ActsFatras::Particle before = Dataset::makeParticle(
+      Acts::PdgParticle::eElectron, 0_degree, 45_degree, 1_GeV);
+  ActsFatras::Particle after = before;
+  std::vector<ActsFatras::Particle> generated;
+
+  BOOST_CHECK(!scatteringOnly.runContinuous(gen, Acts::Test::makeUnitSlab(),
+                                            after, generated));
+  // only the direction changes
+  BOOST_CHECK_EQUAL(after.energy(), before.energy());
+  BOOST_CHECK_NE(after.direction(), before.direction());
+  BOOST_CHECK(generated.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -108,4 +108,43 @@ BOOST_AUTO_TEST_CASE(HighlandRms) {
   CHECK_CLOSE_REL(rmsTheta3D, std::numbers::sqrt2 * theta0, 0.02);
 }
 
+BOOST_AUTO_TEST_CASE(HighlandRmsBatch) {
+  auto scattering = ActsFatras::HighlandScattering();
+  auto particle = Dataset::makeParticle(Acts::PdgParticle::eMuon, 0, 0, 1);
+  auto materialSlab = Acts::Test::makePercentSlab();
+
+  auto theta0 = Acts::computeMultipleScatteringTheta0(
+      materialSlab, particle.absolutePdg(), particle.mass(), particle.qOverP(),
+      particle.absoluteCharge());
+
+  std::ranlux48 gen(0);
+
+  std::vector<ActsFatras::Particle> particles(10000, particle);
+  scattering.batch(gen, materialSlab, particles);
+
+  std::vector<double> thetaYZs;
+  std::vector<double> theta3Ds;
+
+  for (const auto& newParticle : particles) {
+    // scattering leaves absolute energy/momentum unchanged
+    CHECK_CLOSE_REL(newParticle.absoluteMomentum(),
+                    particle.absoluteMomentum(), eps);
+    CHECK_CLOSE_REL(newParticle.direction().norm(), 1., 1e-12);
+
+    double thetaYZ =
+        std::atan2(newParticle.direction().y(), newParticle.direction().z());
+    double theta3d =
+        std::acos(newParticle.direction().dot(particle.direction()));
+
+    thetaYZs.push_back(thetaYZ);
+    theta3Ds.push_back(theta3d);
+  }
+
+  double rmsThetaYZ = rms(thetaYZs, 0);
+  double rmsTheta3D = rms(theta3Ds, 0);
+
+  CHECK_CLOSE_REL(rmsThetaYZ, theta0, 0.02);
+  CHECK_CLOSE_REL(rmsTheta3D, std::numbers::sqrt2 * theta0, 0.02);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
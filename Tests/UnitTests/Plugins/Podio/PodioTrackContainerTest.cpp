@@ -309,6 +309,116 @@ BOOST_AUTO_TEST_CASE(ConvertTrack) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ClearAndReuse) {
+  MapHelper helper;
+
+  auto free = Acts::Surface::makeShared<PlaneSurface>(
+      Transform3::Identity(), std::make_shared<RectangleBounds>(15, 20));
+
+  Acts::MutablePodioTrackStateContainer tsc{helper};
+  Acts::MutablePodioTrackContainer ptc{helper};
+  Acts::TrackContainer tc{ptc, tsc};
+  tc.addColumn<std::int32_t>("int_column");
+
+  ptc.reserve(10);
+  tsc.reserve(100);
+
+  for (std::size_t run = 0; run < 3; ++run) {
+    tc.clear();
+    BOOST_CHECK_EQUAL(tc.size(), 0);
+    BOOST_CHECK_EQUAL(tsc.size(), 0);
+
+    for (std::int32_t i = 0; i < 10; ++i) {
+      auto t = tc.makeTrack();
+      BOOST_CHECK(!t.hasReferenceSurface());
+      t.setReferenceSurface(free);
+      t.parameters().setConstant(i);
+      t.component<std::int32_t, "int_column"_hash>() = i;
+
+      for (std::int32_t j = 0; j <= i; ++j) {
+        auto ts = t.appendTrackState();
+        ts.predicted().setConstant(j);
+        ts.jacobian().setIdentity();
+      }
+    }
+
+    BOOST_CHECK_EQUAL(tc.size(), 10);
+    BOOST_CHECK_EQUAL(tsc.size(), 55);
+
+    for (std::int32_t i = 0; i < 10; ++i) {
+      auto t = tc.getTrack(i);
+      BOOST_CHECK(t.hasReferenceSurface());
+      BOOST_CHECK_EQUAL(t.parameters()[eBoundLoc0], i);
+      BOOST_CHECK_EQUAL((t.component<std::int32_t, "int_column"_hash>()), i);
+      BOOST_CHECK_EQUAL(t.nTrackStates(), static_cast<std::size_t>(i + 1));
+      BOOST_CHECK_EQUAL(t.outermostTrackState().predicted()[eBoundLoc0], i);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CachedDataAcrossGrowthAndRelease) {
+  MapHelper helper;
+
+  podio::Frame frame;
+
+  constexpr std::int32_t nTracks = 1000;
+  constexpr std::int32_t nStates = 3;
+
+  {
+    Acts::MutablePodioTrackStateContainer tsc{helper};
+    Acts::MutablePodioTrackContainer ptc{helper};
+    Acts::TrackContainer tc{ptc, tsc};
+
+    // No reserve, so that the collections and the cached pointers have to
+    // grow several times while the tracks are filled
+    for (std::int32_t i = 0; i < nTracks; ++i) {
+      auto t = tc.makeTrack();
+      t.parameters().setConstant(i);
+      t.covariance().setConstant(-i);
+
+      for (std::int32_t j = 0; j < nStates; ++j) {
+        auto ts = t.appendTrackState();
+        ts.predicted().setConstant(i * nStates + j);
+        ts.jacobian().setConstant(j);
+      }
+    }
+
+    const ActsPodioEdm::TrackCollection& tracks = ptc.trackCollection();
+    BOOST_REQUIRE_EQUAL(tracks.size(), static_cast<std::size_t>(nTracks));
+    for (std::int32_t i = 0; i < nTracks; ++i) {
+      auto t = tc.getTrack(i);
+      BOOST_CHECK_EQUAL(t.parameters().data(),
+                        tracks[i].getData().parameters.data());
+      BOOST_CHECK_EQUAL(t.covariance().data(),
+                        tracks[i].getData().covariance.data());
+      BOOST_CHECK_EQUAL(t.parameters()[eBoundLoc0], i);
+    }
+
+    // Asserts on the cached pointers in debug builds
+    ptc.releaseInto(frame);
+    tsc.releaseInto(frame);
+  }
+
+  Acts::ConstPodioTrackStateContainer tsc{helper, frame};
+  Acts::ConstPodioTrackContainer ptc{helper, frame};
+  Acts::TrackContainer tc{ptc, tsc};
+
+  BOOST_REQUIRE_EQUAL(tc.size(), static_cast<std::size_t>(nTracks));
+  for (std::int32_t i = 0; i < nTracks; ++i) {
+    auto t = tc.getTrack(i);
+    BOOST_CHECK_EQUAL(t.parameters()[eBoundLoc0], i);
+    BOOST_CHECK_EQUAL(t.covariance()(eBoundQOverP, eBoundTime), -i);
+    BOOST_REQUIRE_EQUAL(t.nTrackStates(), static_cast<std::size_t>(nStates));
+
+    std::int32_t j = nStates;
+    for (const auto& ts : t.trackStatesReversed()) {
+      --j;
+      BOOST_CHECK_EQUAL(ts.predicted()[eBoundLoc1], i * nStates + j);
+      BOOST_CHECK_EQUAL(ts.jacobian()(eBoundPhi, eBoundTheta), j);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(CopyTracksIncludingDynamicColumnsDifferentBackends) {
   MapHelper helper;
 